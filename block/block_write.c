@@ -48,6 +48,7 @@ int __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf
 	size_t align_size;
 	wt_off_t offset;
 	int local_locked;
+	struct timespec start;
 
 	blk = WT_BLOCK_HEADER_REF(buf->mem);
 	fh = block->fh;
@@ -71,6 +72,8 @@ int __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf
 		WT_RET_MSG(session, EINVAL, "buffer size check: write buffer too large to write");
 	}
 
+	WT_LATENCY_BEGIN(session, start);
+
 	/*padingbufferλý0*/
 	memset((uint8_t*)buf->mem + buf->size, 0, align_size - buf->size);
 
@@ -156,6 +159,7 @@ extend_truncate:
 	}
 #endif
 
+	WT_LATENCY_END(session, WT_LATENCY_BLOCK_WRITE, start);
 	WT_STAT_FAST_CONN_INCR(session, block_write);
 	WT_STAT_FAST_CONN_INCRV(session, block_byte_write, align_size);
 
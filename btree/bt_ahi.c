@@ -0,0 +1,228 @@
+/***************************************************************************
+*Ӧhash(adaptive hash index)¼ȵҶpagekeyλã
+*ѯʱҪrootʼ
+***************************************************************************/
+
+#include "wt_internal.h"
+
+/*
+ * WT_AHI_PAGE_HOT --
+ *	Each time a page is found in the cache its read generation is pushed
+ * WT_READGEN_STEP past the cache's read generation; a page with more than
+ * half of that step left was read during the last few eviction passes.
+ */
+#define	WT_AHI_PAGE_HOT(session, page)						\
+	((page)->read_gen != WT_READGEN_OLDEST &&				\
+	(page)->read_gen > __wt_cache_read_gen(session) + WT_READGEN_STEP / 2)
+
+/*ΪbtreeһentriesλӦhashλȡ2ݴ*/
+int __wt_ahi_create(WT_SESSION_IMPL* session, uint32_t entries)
+{
+	WT_AHI *ahi;
+	WT_BTREE *btree;
+	WT_DECL_RET;
+
+	btree = S2BT(session);
+
+	WT_RET(__wt_calloc_one(session, &ahi));
+	ahi->mask = __wt_nlpo2_round(entries) - 1;
+	WT_ERR(__wt_calloc_def(session, (size_t)ahi->mask + 1, &ahi->entries));
+	WT_ERR(__wt_rwlock_alloc(session, &ahi->lock, "btree adaptive hash index"));
+
+	btree->ahi = ahi;
+	return 0;
+
+err:
+	__wt_free(session, ahi->entries);
+	__wt_free(session, ahi);
+	return ret;
+}
+
+/*ͷbtreeӦhashbtreeرʱеpageѾ*/
+int __wt_ahi_destroy(WT_SESSION_IMPL* session)
+{
+	WT_AHI *ahi;
+	WT_BTREE *btree;
+	WT_DECL_RET;
+
+	btree = S2BT(session);
+	if ((ahi = btree->ahi) == NULL)
+		return 0;
+
+	btree->ahi = NULL;
+	WT_TRET(__wt_rwlock_destroy(session, &ahi->lock));
+	__wt_free(session, ahi->entries);
+	__wt_free(session, ahi);
+
+	return ret;
+}
+
+/*
+ * __wt_ahi_search --
+ *	Look up a key in the adaptive hash index.  On a hit, the cursor is
+ * positioned on the key exactly as a full search would have left it, with a
+ * hazard pointer on the leaf page.
+ */
+int __wt_ahi_search(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* srch_key, uint64_t hash, int* foundp)
+{
+	WT_AHI *ahi;
+	WT_AHI_ENTRY *e, entry;
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_ITEM *item;
+	WT_PAGE *page;
+	int acquired, cmp;
+
+	btree = S2BT(session);
+	ahi = btree->ahi;
+	*foundp = 0;
+
+	/*Ȳһۣλƥʱȥ*/
+	e = &ahi->entries[hash & ahi->mask];
+	if (e->hash != hash || e->page == NULL) {
+		WT_STAT_FAST_DATA_INCR(session, btree_ahi_miss);
+		return 0;
+	}
+
+	/*
+	 * Page discard and splits clear the page's entries under the write lock
+	 * before the page or its WT_REF can be freed, the entry is safe to use
+	 * while we hold the read lock.  Only take a hazard pointer on a page
+	 * that's already in memory: don't wait and don't evict, the page-out
+	 * path needs the write lock.
+	 */
+	acquired = 0;
+	WT_RET(__wt_readlock(session, ahi->lock));
+	entry = *e;
+	if (entry.hash == hash && entry.page != NULL) {
+		ret = __wt_page_in(session, entry.ref, WT_READ_CACHE | WT_READ_NO_EVICT | WT_READ_NO_WAIT);
+		if (ret == 0)
+			acquired = 1;
+		else if (ret == WT_NOTFOUND || ret == WT_RESTART)
+			ret = 0;
+	}
+	WT_TRET(__wt_readunlock(session, ahi->lock));
+	if (!acquired) {
+		WT_STAT_FAST_DATA_INCR(session, btree_ahi_miss);
+		return ret;
+	}
+	WT_ERR(ret);
+
+	page = entry.page;
+	WT_ASSERT(session, entry.ref->page == page);
+
+	/*hashܳͻȽkey*/
+	item = &cbt->search_key;
+	if (entry.ins != NULL) {
+		item->data = WT_INSERT_KEY(entry.ins);
+		item->size = WT_INSERT_KEY_SIZE(entry.ins);
+	}
+	else
+		WT_ERR(__wt_row_leaf_key(session, page, page->pg_row_d + entry.slot, item, 1));
+
+	WT_ERR(__wt_compare(session, btree->collator, srch_key, item, &cmp));
+	if (cmp != 0) {
+		WT_STAT_FAST_DATA_INCR(session, btree_ahi_miss);
+		return (__wt_page_release(session, entry.ref, 0));
+	}
+
+	cbt->ref = entry.ref;
+	cbt->slot = entry.slot;
+	cbt->compare = 0;
+	if (entry.ins != NULL) {
+		cbt->ins = entry.ins;
+		if (entry.smallest) {
+			F_SET(cbt, WT_CBT_SEARCH_SMALLEST);
+			cbt->ins_head = WT_ROW_INSERT_SMALLEST(page);
+		}
+		else
+			cbt->ins_head = WT_ROW_INSERT_SLOT(page, entry.slot);
+	}
+
+	*foundp = 1;
+	WT_STAT_FAST_DATA_INCR(session, btree_ahi_hit);
+	return 0;
+
+err:
+	WT_TRET(__wt_page_release(session, entry.ref, 0));
+	return ret;
+}
+
+/*
+ * __wt_ahi_insert --
+ *	Remember where a full search found its key, if the leaf page is hot.
+ * The index is only a cache: collisions replace the older entry and the
+ * insert is skipped when another thread holds the lock.
+ */
+void __wt_ahi_insert(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, uint64_t hash)
+{
+	WT_AHI *ahi;
+	WT_AHI_ENTRY *e;
+	WT_PAGE *page;
+	uint32_t slot;
+
+	ahi = S2BT(session)->ahi;
+	page = cbt->ref->page;
+
+	if (!WT_AHI_PAGE_HOT(session, page))
+		return;
+
+	slot = (uint32_t)(hash & ahi->mask);
+	e = &ahi->entries[slot];
+	if (e->hash == hash && e->page == page)
+		return;
+
+	if (__wt_try_writelock(session, ahi->lock) != 0)
+		return;
+
+	/*λһָpageʱǵpageĲλбУpageʧЧʱֻЩλ*/
+	if (e->page != page) {
+		if (page->ahi_nslots >= WT_AHI_PAGE_SLOTS_MAX ||
+		    __wt_realloc_def(session, &page->ahi_slots_alloc, page->ahi_nslots + 1, &page->ahi_slots) != 0)
+			goto done;
+		page->ahi_slots[page->ahi_nslots++] = slot;
+	}
+
+	e->hash = hash;
+	e->ref = cbt->ref;
+	e->page = page;
+	e->ins = cbt->ins;
+	e->slot = cbt->slot;
+	e->smallest = F_ISSET(cbt, WT_CBT_SEARCH_SMALLEST) ? 1 : 0;
+
+done:
+	(void)__wt_writeunlock(session, ahi->lock);
+}
+
+/*
+ * __wt_ahi_page_invalidate --
+ *	Clear the entries referencing a leaf page that's being discarded or
+ * split, before the page or its WT_REF can be freed.  Only the slots the page
+ * recorded are visited; a slot since taken over by another page is left alone.
+ */
+void __wt_ahi_page_invalidate(WT_SESSION_IMPL* session, WT_PAGE* page)
+{
+	WT_AHI *ahi;
+	WT_AHI_ENTRY *e;
+	WT_BTREE *btree;
+	uint32_t i;
+
+	/*ѾͷʱֻҪͷpageĲλб*/
+	if ((btree = S2BT_SAFE(session)) == NULL || (ahi = btree->ahi) == NULL) {
+		__wt_free(session, page->ahi_slots);
+		page->ahi_slots_alloc = 0;
+		page->ahi_nslots = 0;
+		return;
+	}
+
+	(void)__wt_writelock(session, ahi->lock);
+	for (i = 0; i < page->ahi_nslots; ++i) {
+		e = &ahi->entries[page->ahi_slots[i]];
+		if (e->page == page)
+			memset(e, 0, sizeof(*e));
+	}
+	__wt_free(session, page->ahi_slots);
+	page->ahi_slots_alloc = 0;
+	page->ahi_nslots = 0;
+	(void)__wt_writeunlock(session, ahi->lock);
+}
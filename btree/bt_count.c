@@ -0,0 +1,431 @@
+/***************************************************************************
+*ͳһkeyΧڵļ¼(WT_SESSION::count_range)internal pageм¼
+*ʱȫڷΧڵҪڴ棻кŶλcursor
+*(WT_SESSION::position_rank)ҲЩ
+***************************************************************************/
+
+#include "wt_internal.h"
+
+static int __count_page(WT_SESSION_IMPL *, WT_PAGE *, WT_ITEM *, WT_ITEM *, int, uint64_t *);
+
+/*
+ * __count_key --
+ *	Check a key against the range: *inp is set if the key is in the range,
+ * *pastp if the key is past the stop key, nothing after it can be counted.
+ */
+static int __count_key(WT_SESSION_IMPL* session, WT_ITEM* key, WT_ITEM* start, WT_ITEM* stop, int* inp, int* pastp)
+{
+	WT_BTREE *btree;
+	int cmp;
+
+	btree = S2BT(session);
+	*inp = 1;
+	*pastp = 0;
+
+	if (start != NULL) {
+		WT_RET(__wt_compare(session, btree->collator, key, start, &cmp));
+		if (cmp < 0)
+			*inp = 0;
+	}
+	if (stop != NULL) {
+		WT_RET(__wt_compare(session, btree->collator, key, stop, &cmp));
+		if (cmp > 0) {
+			*inp = 0;
+			*pastp = 1;
+		}
+	}
+	return 0;
+}
+
+/*ͳinsert listڷΧڲҶԵǰɼļ¼*/
+static int __count_insert_list(WT_SESSION_IMPL* session, WT_INSERT_HEAD* ins_head, WT_ITEM* start, WT_ITEM* stop, uint64_t* countp, int* pastp)
+{
+	WT_INSERT *ins;
+	WT_ITEM key;
+	WT_UPDATE *upd;
+	int in;
+
+	WT_SKIP_FOREACH(ins, ins_head) {
+		if ((upd = __wt_txn_read(session, ins->upd)) == NULL || WT_UPDATE_DELETED_ISSET(upd))
+			continue;
+
+		if (start != NULL || stop != NULL) {
+			key.data = WT_INSERT_KEY(ins);
+			key.size = WT_INSERT_KEY_SIZE(ins);
+			WT_RET(__count_key(session, &key, start, stop, &in, pastp));
+			if (*pastp)
+				return 0;
+			if (!in)
+				continue;
+		}
+		++*countp;
+	}
+	return 0;
+}
+
+/*
+ * __count_leaf --
+ *	Count the rows of a leaf page between start and stop, either bound may
+ * be NULL.  A page that was never modified holds exactly the rows read from
+ * disk, unless older versions of its keys are in the history store; an
+ * approximate count of a modified page adds the page's row delta rather than
+ * checking the visibility of every update.
+ */
+static int __count_leaf(WT_SESSION_IMPL* session, WT_PAGE* page, WT_ITEM* start, WT_ITEM* stop, int approximate, uint64_t* countp)
+{
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	WT_ROW *rip;
+	WT_UPDATE *hs_upd, *upd;
+	int64_t rows;
+	uint32_t i;
+	int hs_lookup, in, past;
+
+	hs_lookup = __wt_hs_page_lookup(session, page);
+	if (start == NULL && stop == NULL) {
+		if (page->modify == NULL && (approximate || !hs_lookup)) {
+			*countp += page->pg_row_entries;
+			return 0;
+		}
+		if (approximate && S2BT(session)->subtree_counts) {
+			rows = (int64_t)page->pg_row_entries + page->modify->rows_delta;
+			*countp += rows > 0 ? (uint64_t)rows : 0;
+			return 0;
+		}
+	}
+
+	WT_RET(__wt_scr_alloc(session, 0, &key));
+
+	hs_upd = NULL;
+	past = 0;
+	WT_ERR(__count_insert_list(session, WT_ROW_INSERT_SMALLEST(page), start, stop, countp, &past));
+	WT_ROW_FOREACH(page, rip, i) {
+		if (past)
+			break;
+
+		upd = __wt_txn_read(session, WT_ROW_UPDATE(page, rip));
+		if (upd == NULL && hs_lookup) {
+			__wt_free(session, hs_upd);
+			WT_ERR(__wt_row_leaf_key(session, page, rip, key, 0));
+			WT_ERR(__wt_hs_search(session, key, &hs_upd));
+			upd = hs_upd;
+		}
+		if (upd == NULL || !WT_UPDATE_DELETED_ISSET(upd)) {
+			in = 1;
+			if (start != NULL || stop != NULL) {
+				WT_ERR(__wt_row_leaf_key(session, page, rip, key, 0));
+				WT_ERR(__count_key(session, key, start, stop, &in, &past));
+				if (past)
+					break;
+			}
+			if (in)
+				++*countp;
+		}
+
+		WT_ERR(__count_insert_list(session, WT_ROW_INSERT(page, rip), start, stop, countp, &past));
+	}
+
+err:
+	__wt_free(session, hs_upd);
+	__wt_scr_free(session, &key);
+	return ret;
+}
+
+/*
+ * __count_child --
+ *	Count the rows of a child page.  A subtree entirely inside the range
+ * that isn't in memory is counted from the row count in its address, it's
+ * only read if the count isn't known or older versions the transaction reads
+ * may be in the history store.
+ */
+static int __count_child(WT_SESSION_IMPL* session, WT_REF* ref, WT_ITEM* start, WT_ITEM* stop, int approximate, uint64_t* countp)
+{
+	WT_DECL_RET;
+	uint64_t rows;
+
+	if (start == NULL && stop == NULL && (approximate || __wt_hs_skip(session, S2C(session)->hs_max_txn)))
+		switch (ref->state) {
+		case WT_REF_DISK:
+			if ((rows = __wt_ref_rows(ref)) != 0) {
+				*countp += rows - 1;
+				WT_STAT_FAST_DATA_INCR(session, btree_count_subtree_skip);
+				return 0;
+			}
+			break;
+		case WT_REF_DELETED:
+			if (__wt_delete_page_skip(session, ref))
+				return 0;
+			break;
+		default:
+			break;
+		}
+
+	/*pageֻΪһͳʹãread generation*/
+	WT_RET(__wt_page_in(session, ref, WT_READ_WONT_NEED));
+	ret = __count_page(session, ref->page, start, stop, approximate, countp);
+	WT_TRET(__wt_page_release(session, ref, 0));
+	return ret;
+}
+
+/*
+ * __count_page --
+ *	Count the rows of a page between start and stop.  A bound is dropped as
+ * soon as a separator key shows it can't exclude anything in a child, child
+ * subtrees with no bounds left are counted without looking at their keys.
+ */
+static int __count_page(WT_SESSION_IMPL* session, WT_PAGE* page, WT_ITEM* start, WT_ITEM* stop, int approximate, uint64_t* countp)
+{
+	WT_BTREE *btree;
+	WT_ITEM key, *child_start, *child_stop;
+	WT_PAGE_INDEX *pindex;
+	uint32_t i;
+	int cmp;
+
+	btree = S2BT(session);
+
+	if (page->type == WT_PAGE_ROW_LEAF)
+		return (__count_leaf(session, page, start, stop, approximate, countp));
+
+	WT_INTL_INDEX_GET(session, page, pindex);
+	for (i = 0; i < pindex->entries; ++i) {
+		child_start = start;
+		child_stop = stop;
+
+		/*iеkeyСڵiָkeyСڵi+1ָkey0ָkeyû*/
+		if (i > 0 && (start != NULL || stop != NULL)) {
+			__wt_ref_key(page, pindex->index[i], &key.data, &key.size);
+			if (stop != NULL) {
+				WT_RET(__wt_compare(session, btree->collator, &key, stop, &cmp));
+				if (cmp > 0)
+					break;
+			}
+			if (start != NULL) {
+				WT_RET(__wt_compare(session, btree->collator, &key, start, &cmp));
+				if (cmp >= 0)
+					child_start = NULL;
+			}
+		}
+		if (i + 1 < pindex->entries && (child_start != NULL || child_stop != NULL)) {
+			__wt_ref_key(page, pindex->index[i + 1], &key.data, &key.size);
+			if (child_start != NULL) {
+				WT_RET(__wt_compare(session, btree->collator, &key, child_start, &cmp));
+				if (cmp <= 0)
+					continue;
+			}
+			if (child_stop != NULL) {
+				WT_RET(__wt_compare(session, btree->collator, &key, child_stop, &cmp));
+				if (cmp <= 0)
+					child_stop = NULL;
+			}
+		}
+
+		WT_RET(__count_child(session, pindex->index[i], child_start, child_stop, approximate, countp));
+	}
+
+	return 0;
+}
+
+/*
+ * __wt_btree_count_range --
+ *	Count the rows of the session's row-store btree between two keys, either
+ * key may be NULL.  With approximate set, modified leaf pages entirely in the
+ * range are counted from their row delta, the count may include changes that
+ * aren't visible to the session's transaction.
+ */
+int __wt_btree_count_range(WT_SESSION_IMPL* session, WT_ITEM* start, WT_ITEM* stop, int approximate, uint64_t* countp)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	uint64_t count;
+
+	btree = S2BT(session);
+	*countp = 0;
+
+	if (btree->type != BTREE_ROW)
+		WT_RET_MSG(session, ENOTSUP, "count_range is only supported for row-store objects");
+
+	/*splitʹñindexʱ´rootʼͳ*/
+	do {
+		count = 0;
+		WT_WITH_PAGE_INDEX(session, ret = __count_page(session, btree->root.page, start, stop, approximate, &count));
+	} while (ret == WT_RESTART);
+	WT_RET(ret);
+
+	*countp = count;
+	return 0;
+}
+
+/*
+ * __wt_btcur_count_range --
+ *	Count the rows between the keys of the start and stop cursors, either
+ * cursor may be NULL.
+ */
+int __wt_btcur_count_range(WT_CURSOR_BTREE* start, WT_CURSOR_BTREE* stop, int approximate, uint64_t* countp)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)((start != NULL) ? start : stop)->iface.session;
+
+	/*ûеʱȡһsnapshotcursorĶһ*/
+	__wt_txn_cursor_op(session);
+
+	return (__wt_btree_count_range(session, start == NULL ? NULL : &start->iface.key, stop == NULL ? NULL : &stop->iface.key, approximate, countp));
+}
+
+/*insert listвҵ*rankpУ*lastp¼һɼWT_INSERT*/
+static void __rank_insert_list(WT_SESSION_IMPL* session, WT_INSERT_HEAD* ins_head, uint64_t* rankp, WT_INSERT** lastp, int* foundp)
+{
+	WT_INSERT *ins;
+	WT_UPDATE *upd;
+
+	WT_SKIP_FOREACH(ins, ins_head) {
+		if ((upd = __wt_txn_read(session, ins->upd)) == NULL || WT_UPDATE_DELETED_ISSET(upd))
+			continue;
+
+		*lastp = ins;
+		if (*rankp == 0) {
+			*foundp = 1;
+			return;
+		}
+		--*rankp;
+	}
+}
+
+/*
+ * __rank_leaf --
+ *	Find the row with the given rank on a leaf page, in the same order and
+ * with the same visibility rules as __count_leaf, and copy its key.  If the
+ * parent's count was approximate and the page holds fewer rows, the page's
+ * last row is returned.
+ */
+static int __rank_leaf(WT_SESSION_IMPL* session, WT_PAGE* page, uint64_t* rankp, int approximate, WT_ITEM* key, int* foundp)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_INSERT *ins;
+	WT_ROW *last, *rip;
+	WT_UPDATE *hs_upd, *upd;
+	uint32_t i;
+	int hs_lookup;
+
+	WT_RET(__wt_scr_alloc(session, 0, &tmp));
+
+	hs_lookup = __wt_hs_page_lookup(session, page);
+	hs_upd = NULL;
+	ins = NULL;
+	last = NULL;
+	__rank_insert_list(session, WT_ROW_INSERT_SMALLEST(page), rankp, &ins, foundp);
+	WT_ROW_FOREACH(page, rip, i) {
+		if (*foundp)
+			break;
+
+		upd = __wt_txn_read(session, WT_ROW_UPDATE(page, rip));
+		if (upd == NULL && hs_lookup) {
+			__wt_free(session, hs_upd);
+			WT_ERR(__wt_row_leaf_key(session, page, rip, tmp, 0));
+			WT_ERR(__wt_hs_search(session, tmp, &hs_upd));
+			upd = hs_upd;
+		}
+		if (upd == NULL || !WT_UPDATE_DELETED_ISSET(upd)) {
+			ins = NULL;
+			last = rip;
+			if (*rankp == 0) {
+				*foundp = 1;
+				break;
+			}
+			--*rankp;
+		}
+
+		__rank_insert_list(session, WT_ROW_INSERT(page, rip), rankp, &ins, foundp);
+	}
+
+	if (!*foundp && approximate && (ins != NULL || last != NULL))
+		*foundp = 1;
+
+	/*pageڷغᱻͷţkeyҪ*/
+	if (*foundp) {
+		if (ins != NULL)
+			WT_ERR(__wt_buf_set(session, key, WT_INSERT_KEY(ins), WT_INSERT_KEY_SIZE(ins)));
+		else {
+			WT_ERR(__wt_row_leaf_key(session, page, last, tmp, 0));
+			WT_ERR(__wt_buf_set(session, key, tmp->data, tmp->size));
+		}
+	}
+
+err:
+	__wt_free(session, hs_upd);
+	__wt_scr_free(session, &tmp);
+	return ret;
+}
+
+/*
+ * __rank_page --
+ *	Descend to the row with the given rank: children are counted as
+ * count_range counts them, children entirely before the row are skipped.
+ * Subtrees that aren't in memory are skipped by the row count in their
+ * address without being read, the cost is O(log n) unless much of the tree
+ * is in memory and must be counted page by page.
+ */
+static int __rank_page(WT_SESSION_IMPL* session, WT_PAGE* page, uint64_t* rankp, int approximate, WT_ITEM* key, int* foundp)
+{
+	WT_DECL_RET;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *ref;
+	uint64_t rows;
+	uint32_t i;
+
+	if (page->type == WT_PAGE_ROW_LEAF)
+		return (__rank_leaf(session, page, rankp, approximate, key, foundp));
+
+	WT_INTL_INDEX_GET(session, page, pindex);
+	for (i = 0; i < pindex->entries && !*foundp; ++i) {
+		ref = pindex->index[i];
+
+		rows = 0;
+		WT_RET(__count_child(session, ref, NULL, NULL, approximate, &rows));
+		if (*rankp >= rows) {
+			*rankp -= rows;
+			continue;
+		}
+
+		WT_RET(__wt_page_in(session, ref, WT_READ_WONT_NEED));
+		ret = __rank_page(session, ref->page, rankp, approximate, key, foundp);
+		WT_TRET(__wt_page_release(session, ref, 0));
+		WT_RET(ret);
+
+		/*ӵǽֵûһʱһӵĵһпʼ*/
+		*rankp = 0;
+	}
+
+	return 0;
+}
+
+/*
+ * __wt_btree_rank_key --
+ *	Return the key of the row with the given rank, counting from 0, in the
+ * session's row-store btree.  WT_NOTFOUND if the tree has no more rows.
+ */
+int __wt_btree_rank_key(WT_SESSION_IMPL* session, uint64_t rank, int approximate, WT_ITEM* key)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	uint64_t remain;
+	int found;
+
+	btree = S2BT(session);
+
+	if (btree->type != BTREE_ROW)
+		WT_RET_MSG(session, ENOTSUP, "position_rank is only supported for row-store objects");
+
+	/*ûеʱȡһsnapshotcursorĶһ*/
+	__wt_txn_cursor_op(session);
+
+	do {
+		remain = rank;
+		found = 0;
+		WT_WITH_PAGE_INDEX(session, ret = __rank_page(session, btree->root.page, &remain, approximate, key, &found));
+	} while (ret == WT_RESTART);
+	WT_RET(ret);
+
+	return (found ? 0 : WT_NOTFOUND);
+}
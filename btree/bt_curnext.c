@@ -308,6 +308,9 @@ new_insert:
 		rip = &page->pg_row_d[cbt->slot];
 
 		upd = __wt_txn_read(session, WT_ROW_UPDATE(page, rip));
+		/*pageϵİ汾Եǰ񲻿ɼʱhistory storeȡ*/
+		if (upd == NULL && __wt_hs_page_lookup(session, page))
+			WT_RET(__wt_hs_cursor_read(session, cbt, rip, &upd));
 		if (upd != NULL && WT_UPDATE_DELETED_ISSET(upd)) {
 			++cbt->page_deleted_count;
 			continue;
@@ -332,6 +335,7 @@ void __wt_btcur_iterate_setup(WT_CURSOR_BTREE* cbt, int next)
 
 	/*ʼdel countڼĹҪͳdel count*/
 	cbt->page_deleted_count = 0;
+	cbt->scan_pages = 0;
 
 	if (cbt->ref == NULL)
 		return;
@@ -449,6 +453,10 @@ int __wt_btcur_next(WT_CURSOR_BTREE *cbt, int truncating)
 
 		cbt->page_deleted_count = 0;
 
+		/*page㹻ʱɨ裬pageȱ̭*/
+		if (++cbt->scan_pages >= WT_BTCUR_SCAN_PAGES)
+			LF_SET(WT_READ_SCAN);
+
 		/*btree cursorתһpage*/
 		WT_ERR(__wt_tree_walk(session, &cbt->ref, NULL, flags));
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
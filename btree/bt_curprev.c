@@ -437,7 +437,10 @@ new_insert:
 		cbt->slot = cbt->row_iteration_slot / 2 - 1;
 		rip = &page->pg_row_d[cbt->slot];
 		upd = __wt_txn_read(session, WT_ROW_UPDATE(page, rip));
-		if (upd != NULL && WT_UPDATE_DELETED_SET(upd)){
+		/*pageϵİ汾Եǰ񲻿ɼʱhistory storeȡ*/
+		if (upd == NULL && __wt_hs_page_lookup(session, page))
+			WT_RET(__wt_hs_cursor_read(session, cbt, rip, &upd));
+		if (upd != NULL && WT_UPDATE_DELETED_ISSET(upd)){
 			++cbt->page_deleted_count;
 			continue;
 		}
@@ -520,6 +523,10 @@ int __wt_btcur_prev(WT_CURSOR_BTREE *cbt, int truncating)
 			__wt_page_evict_soon(page);
 		cbt->page_deleted_count = 0;
 
+		/*page㹻ʱɨ裬pageȱ̭*/
+		if (++cbt->scan_pages >= WT_BTCUR_SCAN_PAGES)
+			LF_SET(WT_READ_SCAN);
+
 		WT_ERR(__wt_tree_walk(session, &cbt->ref, NULL, flags));
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
 	}
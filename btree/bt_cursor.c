@@ -54,7 +54,7 @@ static inline int __cursor_fix_implicit(WT_BTREE* btree, WT_CURSOR_BTREE* cbt)
 * __cursor_valid --
 *	Return if the cursor references an valid key/value pair.
 */
-static inline int __cursor_valid(WT_CURSOR_BTREE* cbt, WT_UPDATE** updp)
+static inline int __cursor_valid(WT_CURSOR_BTREE* cbt, WT_UPDATE** updp, int* validp)
 {
 	WT_BTREE *btree;
 	WT_CELL *cell;
@@ -66,6 +66,7 @@ static inline int __cursor_valid(WT_CURSOR_BTREE* cbt, WT_UPDATE** updp)
 	btree = cbt->btree;
 	page = cbt->ref->page;
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
+	*validp = 0;
 	if (updp != NULL)
 		*updp = NULL;
 
@@ -118,7 +119,8 @@ static inline int __cursor_valid(WT_CURSOR_BTREE* cbt, WT_UPDATE** updp)
 			return 0;
 		if (updp != NULL)
 			*updp = upd;
-		return 1;
+		*validp = 1;
+		return 0;
 	}
 	/*
 	* If we don't have an insert object, or in the case of column-store,
@@ -177,8 +179,15 @@ static inline int __cursor_valid(WT_CURSOR_BTREE* cbt, WT_UPDATE** updp)
 		if (cbt->slot >= page->pg_row_entries)
 			return 0;
 
-		/* Updates are stored on the page, check for a delete. */
-		if (page->pg_row_upd != NULL && (upd = __wt_txn_read(session, page->pg_row_upd[cbt->slot])) != NULL) {
+		/*
+		 * Updates are stored on the page, check for a delete.  If none
+		 * of the updates are visible, the version on the page may have
+		 * replaced the one we read, check the history store.
+		 */
+		upd = page->pg_row_upd == NULL ? NULL : __wt_txn_read(session, page->pg_row_upd[cbt->slot]);
+		if (upd == NULL && __wt_hs_page_lookup(session, page))
+			WT_RET(__wt_hs_cursor_read(session, cbt, page->pg_row_d + cbt->slot, &upd));
+		if (upd != NULL) {
 			if (WT_UPDATE_DELETED_ISSET(upd))
 				return 0;
 			if (updp != NULL)
@@ -187,7 +196,8 @@ static inline int __cursor_valid(WT_CURSOR_BTREE* cbt, WT_UPDATE** updp)
 		break;
 	}
 
-	return 1;
+	*validp = 1;
+	return 0;
 }
 
 /*btree cursorʽ*/
@@ -229,6 +239,7 @@ int _wt_btcur_reset(WT_CURSOR_BTREE* cbt)
 	WT_STAT_FAST_CONN_INCR(session, cursor_reset);
 	WT_STAT_FAST_DATA_INCR(session, cursor_reset);
 
+	cbt->sample_cnt = 0;
 	return __cursor_reset(cbt);
 }
 
@@ -240,6 +251,7 @@ int __wt_btcur_search(WT_CURSOR_BTREE* cbt)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	WT_UPDATE *upd;
+	int valid;
 
 	btree = cbt->btree;
 	cursor = &cbt->iface;
@@ -258,7 +270,10 @@ int __wt_btcur_search(WT_CURSOR_BTREE* cbt)
 
 	/*м¼λ*/
 	WT_ERR(btree->type == BTREE_ROW ? __cursor_row_search(session, cbt, 0) : __cursor_col_search(session, cbt));
-	if (cbt->compare == 0 && __cursor_valid(cbt, &upd)) /*¼ҵˣvalue*/
+	valid = 0;
+	if (cbt->compare == 0)
+		WT_ERR(__cursor_valid(cbt, &upd, &valid));
+	if (valid) /*¼ҵˣvalue*/
 		ret = __wt_kv_return(session, cbt, upd);
 	else if (__cursor_fix_implicit(btree, cbt)){
 		/*
@@ -288,7 +303,7 @@ int __wt_btcur_search_near(WT_CURSOR_BTREE* cbt, int* exactp)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	WT_UPDATE *upd;
-	int exact;
+	int exact, valid;
 
 	btree = cbt->btree;
 	cursor = &cbt->iface;
@@ -324,7 +339,8 @@ int __wt_btcur_search_near(WT_CURSOR_BTREE* cbt, int* exactp)
 	*/
 
 	/*exact = 0 ʾȷλkeyڵλã=1ʾλKEYλõĺһ¼ = -1ʾλKEYλõǰһ¼*/
-	if (__cursor_valid(cbt, &upd)){ /*keyӦkvǺϷȷģֱӷ*/
+	WT_ERR(__cursor_valid(cbt, &upd, &valid));
+	if (valid){ /*keyӦkvǺϷȷģֱӷ*/
 		exact = cbt->compare;
 		ret = __wt_kv_return(session, cbt, upd);
 	}
@@ -341,7 +357,8 @@ int __wt_btcur_search_near(WT_CURSOR_BTREE* cbt, int* exactp)
 	else{
 		/*ٴζλѯλãǰһ¼Ϊļ¼btreeǲڵģָֻǰһ¼*/
 		WT_ERR(btree->type == BTREE_ROW ? __cursor_row_search(session, cbt, 1) : __cursor_col_search(session, cbt));
-		if (__cursor_valid(cbt, &upd)) {
+		WT_ERR(__cursor_valid(cbt, &upd, &valid));
+		if (valid) {
 			exact = cbt->compare;
 			ret = __wt_kv_return(session, cbt, upd);
 		}
@@ -365,6 +382,7 @@ int __wt_btcur_insert(WT_CURSOR_BTREE* cbt)
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	int valid;
 
 	btree = cbt->btree;
 	cursor = &cbt->iface;
@@ -404,9 +422,15 @@ retry:
 			cbt->iface.recno = 0;
 
 		/*append insert,Ҫжϼֵظ*/
-		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) &&
-			((cbt->compare == 0 && __cursor_valid(cbt, NULL)) || (cbt->compare != 0 && __cursor_fix_implicit(btree, cbt))))
-			WT_ERR(WT_DUPLICATE_KEY);
+		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE)) {
+			valid = 0;
+			if (cbt->compare == 0)
+				WT_ERR(__cursor_valid(cbt, NULL, &valid));
+			else
+				valid = __cursor_fix_implicit(btree, cbt);
+			if (valid)
+				WT_ERR(WT_DUPLICATE_KEY);
+		}
 
 		WT_ERR(__cursor_col_modify(session, cbt, 0));
 		if (F_ISSET(cursor, WT_CURSTD_APPEND)) /*cbt faceλָոռеλ*/
@@ -416,8 +440,11 @@ retry:
 	case BTREE_ROW:
 		WT_ERR(__cursor_row_search(session, cbt, 1));
 		/*ֵظж*/
-		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) && cbt->compare == 0 && __cursor_valid(cbt, NULL))
-			WT_ERR(WT_DUPLICATE_KEY);
+		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) && cbt->compare == 0) {
+			WT_ERR(__cursor_valid(cbt, NULL, &valid));
+			if (valid)
+				WT_ERR(WT_DUPLICATE_KEY);
+		}
 
 		ret = __cursor_row_modify(session, cbt, 0);
 		break;
@@ -435,6 +462,344 @@ err:
 	return ret;
 }
 
+/*ÿ䵽һµҶpageԤֵpage*/
+#define	WT_BTCUR_BATCH_PREFETCH	8
+
+/*
+ * __cursor_batch_sort --
+ *	Fill order with the indexes of a batch of keys in key order.  The merge
+ * sort is stable: duplicate keys keep their input order, the last insert of a
+ * key wins.  Batches are often already sorted, check that first.
+ */
+static int __cursor_batch_sort(WT_SESSION_IMPL* session, WT_COLLATOR* collator, const WT_ITEM* keys, uint32_t* order, uint32_t* tmp, uint32_t n)
+{
+	uint32_t *dst, *src, *t;
+	uint32_t i, j, k, hi, lo, mid, width;
+	int cmp;
+
+	for (i = 0; i < n; ++i)
+		order[i] = i;
+
+	for (i = 1; i < n; ++i) {
+		WT_RET(__wt_compare(session, collator, &keys[i - 1], &keys[i], &cmp));
+		if (cmp > 0)
+			break;
+	}
+	if (i >= n)
+		return 0;
+
+	src = order;
+	dst = tmp;
+	for (width = 1; width < n; width *= 2) {
+		for (lo = 0; lo < n; lo += 2 * width) {
+			mid = WT_MIN(lo + width, n);
+			hi = WT_MIN(lo + 2 * width, n);
+			for (i = lo, j = mid, k = lo; k < hi; ++k) {
+				if (i == mid)
+					cmp = 1;
+				else if (j == hi)
+					cmp = -1;
+				else
+					WT_RET(__wt_compare(session, collator, &keys[src[i]], &keys[src[j]], &cmp));
+				dst[k] = (cmp <= 0) ? src[i++] : src[j++];
+			}
+		}
+		t = src;
+		src = dst;
+		dst = t;
+	}
+
+	if (src != order)
+		memcpy(order, src, n * sizeof(uint32_t));
+	return 0;
+}
+
+/*
+ * __cursor_batch_leaf_max --
+ *	Return the largest key on the cursor's leaf page.  A key no smaller than
+ * one already found on the page and no larger than this one belongs to the
+ * page, it can be searched for without a descent from the root.
+ */
+static int __cursor_batch_leaf_max(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* max, int* have_maxp)
+{
+	WT_INSERT *ins;
+	WT_INSERT_HEAD *ins_head;
+	WT_PAGE *page;
+
+	page = cbt->ref->page;
+	*have_maxp = 1;
+
+	/*keyһslotinsert listβ߾һslotkey*/
+	ins_head = (page->pg_row_entries == 0) ? WT_ROW_INSERT_SMALLEST(page) : WT_ROW_INSERT_SLOT(page, page->pg_row_entries - 1);
+	if ((ins = WT_SKIP_LAST(ins_head)) != NULL) {
+		max->data = WT_INSERT_KEY(ins);
+		max->size = WT_INSERT_KEY_SIZE(ins);
+		return 0;
+	}
+	if (page->pg_row_entries == 0) {
+		*have_maxp = 0;
+		return 0;
+	}
+
+	return (__wt_row_leaf_key(session, page, page->pg_row_d + (page->pg_row_entries - 1), max, 1));
+}
+
+/*
+ * __cursor_batch_prefetch --
+ *	The cursor descended to a new leaf page: start reading the sibling leaf
+ * pages the next keys of the batch fall into, they'll be in the OS cache by
+ * the time the walk gets there.  *nextp is the first key not yet considered,
+ * keys are only looked at once no matter how many leaf pages the walk visits.
+ */
+static int __cursor_batch_prefetch(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, const WT_ITEM* keys, const uint32_t* order, uint32_t* nextp, uint32_t n)
+{
+	WT_BM *bm;
+	WT_BTREE *btree;
+	WT_ITEM sep;
+	WT_PAGE *parent;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *ref;
+	size_t addr_size;
+	uint32_t i, j, last, slot;
+	int cmp, issued;
+	const uint8_t *addr;
+
+	btree = S2BT(session);
+	bm = btree->bm;
+
+	/*splitref_hintѾʱҲǰpageʱԤ*/
+	parent = cbt->ref->home;
+	WT_INTL_INDEX_GET(session, parent, pindex);
+	slot = cbt->ref->ref_hint;
+	if (slot >= pindex->entries || pindex->index[slot] != cbt->ref)
+		return 0;
+
+	issued = 0;
+	for (i = last = slot, j = *nextp; j < n && issued < WT_BTCUR_BATCH_PREFETCH; ++j) {
+		for (; i + 1 < pindex->entries; ++i) {
+			__wt_ref_key(parent, pindex->index[i + 1], &sep.data, &sep.size);
+			WT_RET(__wt_compare(session, btree->collator, &keys[order[j]], &sep, &cmp));
+			if (cmp < 0)
+				break;
+		}
+		if (i == last)
+			continue;
+
+		last = i;
+		ref = pindex->index[i];
+		if (ref->state == WT_REF_DISK) {
+			WT_RET(__wt_ref_info(session, ref, &addr, &addr_size, NULL));
+			if (addr != NULL) {
+				WT_RET(bm->preload(bm, session, addr, addr_size));
+				WT_STAT_FAST_DATA_INCR(session, cursor_batch_prefetch);
+				++issued;
+			}
+		}
+
+		/*keyѾ˸ڵķΧߵһڵٿ*/
+		if (i + 1 == pindex->entries)
+			break;
+	}
+
+	*nextp = j;
+	return 0;
+}
+
+/*
+ * __cursor_batch_search --
+ *	Position the cursor on key i of a sorted batch.  If the key can't be past
+ * the largest key on the leaf page the cursor holds, search that page only;
+ * otherwise descend from the root and prefetch ahead of the walk.
+ */
+static int __cursor_batch_search(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, const WT_ITEM* keys, const uint32_t* order, uint32_t i, uint32_t n, uint32_t* nextp, WT_ITEM* maxkey, int* have_maxp, int insert)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	int cmp;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+
+	/*pageѾ̫ʱ´root__wt_page_inлsplit*/
+	if (cbt->ref != NULL && *have_maxp && cbt->ref->page->memory_footprint < btree->maxmempage) {
+		WT_RET(__wt_compare(session, btree->collator, &cursor->key, maxkey, &cmp));
+		if (cmp <= 0) {
+			/*Ҷpageļʧʱͷpagehazard pointer*/
+			if ((ret = __wt_row_search(session, &cursor->key, cbt->ref, cbt, insert)) != 0) {
+				cbt->ref = NULL;
+				return ret;
+			}
+			WT_STAT_FAST_DATA_INCR(session, cursor_batch_leaf_reuse);
+			return 0;
+		}
+	}
+
+	WT_RET(__cursor_func_init(cbt, 1));
+	WT_RET(__cursor_row_search(session, cbt, insert));
+	WT_RET(__cursor_batch_leaf_max(session, cbt, maxkey, have_maxp));
+
+	if (*nextp <= i)
+		*nextp = i + 1;
+	WT_WITH_PAGE_INDEX(session, ret = __cursor_batch_prefetch(session, cbt, keys, order, nextp, n));
+	return ret;
+}
+
+/*
+ * __wt_btcur_search_batch --
+ *	Search a row-store tree for a batch of keys.  The keys are searched in
+ * key order, consecutive keys on the same leaf page share one descent from
+ * the root.
+ */
+int __wt_btcur_search_batch(WT_CURSOR_BTREE* cbt, const WT_ITEM* keys, WT_ITEM* values, int* results, uint32_t count)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(maxkey);
+	WT_DECL_ITEM(sortbuf);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
+	uint32_t i, next, *order, slot;
+	int have_max, valid;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_RET(__wt_buf_init(session, &cursor->batch_values, 0));
+	if (count == 0)
+		return 0;
+
+	WT_RET(__wt_scr_alloc(session, 2 * count * sizeof(uint32_t), &sortbuf));
+	WT_ERR(__wt_scr_alloc(session, 0, &maxkey));
+	order = sortbuf->mem;
+	WT_ERR(__cursor_batch_sort(session, btree->collator, keys, order, order + count, count));
+
+	have_max = 0;
+	next = 0;
+	for (i = 0; i < count; ++i) {
+		slot = order[i];
+
+		WT_STAT_FAST_CONN_INCR(session, cursor_search);
+		WT_STAT_FAST_DATA_INCR(session, cursor_search);
+
+		cursor->key.data = keys[slot].data;
+		cursor->key.size = keys[slot].size;
+		WT_ERR(__cursor_size_chk(session, &cursor->key));
+
+		WT_ERR(__cursor_batch_search(session, cbt, keys, order, i, count, &next, maxkey, &have_max, 0));
+		valid = 0;
+		if (cbt->compare == 0)
+			WT_ERR(__cursor_valid(cbt, &upd, &valid));
+		if (valid) {
+			/*valueָpageڴ棬뿪page֮ǰ*/
+			WT_ERR(__wt_kv_return(session, cbt, upd));
+			WT_ERR(__wt_cursor_batch_value(session, cursor, &cursor->value, &values[slot]));
+			results[slot] = 0;
+		}
+		else {
+			values[slot].data = NULL;
+			values[slot].size = 0;
+			results[slot] = WT_NOTFOUND;
+		}
+	}
+	__wt_cursor_batch_fixup(cursor, values, results, order, count);
+
+err:
+	WT_TRET(__cursor_reset(cbt));
+	__wt_scr_free(session, &maxkey);
+	__wt_scr_free(session, &sortbuf);
+
+	return ret;
+}
+
+/*
+ * __wt_btcur_insert_batch --
+ *	Insert a batch of key/value pairs into a row-store tree, in key order
+ * and sharing descents the same way as a batch search.  The caller wraps the
+ * batch in a single transaction.
+ */
+int __wt_btcur_insert_batch(WT_CURSOR_BTREE* cbt, const WT_ITEM* keys, const WT_ITEM* values, uint32_t count)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(maxkey);
+	WT_DECL_ITEM(sortbuf);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	uint32_t i, next, *order, slot;
+	int cmp, have_max, valid;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	if (count == 0)
+		return 0;
+
+	if (btree->bulk_load_ok){
+		btree->bulk_load_ok = 0;
+		__wt_btree_evictable(session, 1);
+	}
+
+	WT_RET(__wt_scr_alloc(session, 2 * count * sizeof(uint32_t), &sortbuf));
+	WT_ERR(__wt_scr_alloc(session, 0, &maxkey));
+	order = sortbuf->mem;
+	WT_ERR(__cursor_batch_sort(session, btree->collator, keys, order, order + count, count));
+
+	have_max = 0;
+	next = 0;
+	for (i = 0; i < count; ++i) {
+		slot = order[i];
+
+		WT_STAT_FAST_CONN_INCR(session, cursor_insert);
+		WT_STAT_FAST_DATA_INCR(session, cursor_insert);
+		WT_STAT_FAST_DATA_INCRV(session, cursor_insert_bytes, keys[slot].size + values[slot].size);
+
+		cursor->key.data = keys[slot].data;
+		cursor->key.size = keys[slot].size;
+		cursor->value.data = values[slot].data;
+		cursor->value.size = values[slot].size;
+		WT_ERR(__cursor_size_chk(session, &cursor->key));
+		WT_ERR(__cursor_size_chk(session, &cursor->value));
+
+		/*pageڼ֮˱仯´root*/
+		for (;; have_max = 0) {
+			if ((ret = __cursor_batch_search(session, cbt, keys, order, i, count, &next, maxkey, &have_max, 1)) == 0) {
+				valid = 0;
+				if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) && cbt->compare == 0)
+					ret = __cursor_valid(cbt, NULL, &valid);
+				if (ret == 0)
+					ret = valid ? WT_DUPLICATE_KEY : __cursor_row_modify(session, cbt, 0);
+			}
+			if (ret != WT_RESTART)
+				break;
+		}
+		WT_ERR(ret);
+
+		/*²keypageԭkeyΪpagekey*/
+		cmp = 1;
+		if (have_max)
+			WT_ERR(__wt_compare(session, btree->collator, &cursor->key, maxkey, &cmp));
+		if (cmp > 0) {
+			maxkey->data = cursor->key.data;
+			maxkey->size = cursor->key.size;
+			have_max = 1;
+		}
+	}
+
+err:
+	if (ret == 0)
+		WT_TRET(__curfile_leave(cbt));
+	if (ret != 0)
+		WT_TRET(__cursor_reset(cbt));
+	__wt_scr_free(session, &maxkey);
+	__wt_scr_free(session, &sortbuf);
+
+	return ret;
+}
+
 /*
 * __curfile_update_check --
 *	Check whether an update would conflict.
@@ -513,6 +878,7 @@ int __wt_btcur_remove(WT_CURSOR_BTREE* cbt)
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	int valid;
 
 	btree = cbt->btree;
 	cursor = &cbt->iface;
@@ -533,7 +899,10 @@ retry:
 		WT_ERR(__cursor_col_search(session, cbt));
 		/*ҵƥļ¼Ҫڵ__cursor_valid֮ǰ³ͻ*/
 		WT_ERR(__curfile_update_check(cbt));
-		if (cbt->compare != 0 || !__cursor_valid(cbt, NULL)){ /*¼δҵ߲Ϸ*/
+		valid = 0;
+		if (cbt->compare == 0)
+			WT_ERR(__cursor_valid(cbt, NULL, &valid));
+		if (!valid){ /*¼δҵ߲Ϸ*/
 			if (!__cursor_fix_implicit(btree, cbt))
 				WT_ERR(WT_NOTFOUND);
 			cbt->recno = cursor->recno;
@@ -546,7 +915,10 @@ retry:
 		WT_ERR(__cursor_row_search(session, cbt, 0));
 		WT_ERR(__curfile_update_check(cbt));
 
-		if (cbt->compare != 0 || !__cursor_valid(cbt, NULL))
+		valid = 0;
+		if (cbt->compare == 0)
+			WT_ERR(__cursor_valid(cbt, NULL, &valid));
+		if (!valid)
 			WT_ERR(WT_NOTFOUND);
 
 		ret = __cursor_row_modify(session, cbt, 1);
@@ -573,6 +945,7 @@ int __wt_btcur_update(WT_CURSOR_BTREE* cbt)
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	int valid;
 
 	btree = cbt->btree;
 	cursor = &cbt->iface;
@@ -601,7 +974,10 @@ retry:
 		WT_ERR(__cursor_col_search(session, cbt));
 		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE)){
 			WT_ERR(__curfile_update_check(cbt));
-			if ((cbt->compare != 0 || !__cursor_valid(cbt, NULL)) && __cursor_fix_implicit(btree, cbt))
+			valid = 0;
+			if (cbt->compare == 0)
+				WT_ERR(__cursor_valid(cbt, NULL, &valid));
+			if (!valid && __cursor_fix_implicit(btree, cbt))
 				return WT_NOTFOUND;
 		}
 		/*¼޸*/
@@ -612,7 +988,10 @@ retry:
 		WT_ERR(__cursor_row_search(session, cbt, 1));
 		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE)){
 			WT_ERR(__curfile_update_check(cbt));
-			if (cbt->compare != 0 || !__cursor_valid(cbt, NULL))
+			valid = 0;
+			if (cbt->compare == 0)
+				WT_ERR(__cursor_valid(cbt, NULL, &valid));
+			if (!valid)
 				WT_ERR(WT_NOTFOUND);
 		}
 		/*¼޸*/
@@ -633,6 +1012,9 @@ err:
 	return ret;
 }
 
+/*next_random_sampleαѡвɼļ¼ʱѡ*/
+#define	WT_BTCUR_SAMPLE_RETRY	10
+
 /*λƶ*/
 int __wt_btcur_next_random(WT_CURSOR_BTREE* cbt)
 {
@@ -640,7 +1022,10 @@ int __wt_btcur_next_random(WT_CURSOR_BTREE* cbt)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	WT_UPDATE *upd;
+	u_int i;
+	int valid;
 
+	btree = cbt->btree;
 	session = (WT_SESSION_IMPL*)cbt->iface.session;
 
 	/*ֻ֧row store洢ʽ*/
@@ -652,12 +1037,45 @@ int __wt_btcur_next_random(WT_CURSOR_BTREE* cbt)
 
 	WT_RET(__cursor_func_init(cbt, 1));
 
-	WT_WITH_PAGE_INDEX(session, ret = __wt_row_random(session, cbt));
-	WT_ERR(ret);
-	if (__cursor_valid(cbt, &upd))
+	if (cbt->sample_size == 0) {
+		WT_WITH_PAGE_INDEX(session, ret = __wt_row_random(session, cbt));
+		WT_ERR(ret);
+	}
+	else {
+		/*һnext_random_sample¼󷵻WT_NOTFOUNDһεÿʼµ*/
+		if (cbt->sample_cnt >= cbt->sample_size) {
+			cbt->sample_cnt = 0;
+			WT_ERR(WT_NOTFOUND);
+		}
+
+		/*
+		 * Records that aren't visible are rejected and another record is
+		 * chosen, that keeps the sample uniform over the visible records.
+		 * After a few misses, fall back to the nearest visible record.
+		 */
+		for (i = 0;; ++i) {
+			WT_WITH_PAGE_INDEX(session, ret = __wt_row_random_sample(session, cbt));
+			WT_ERR(ret);
+			if (i >= WT_BTCUR_SAMPLE_RETRY)
+				break;
+			WT_ERR(__cursor_valid(cbt, &upd, &valid));
+			if (valid)
+				break;
+
+			WT_ERR(__wt_page_release(session, cbt->ref, 0));
+			cbt->ref = NULL;
+		}
+		++cbt->sample_cnt;
+	}
+
+	WT_ERR(__cursor_valid(cbt, &upd, &valid));
+	if (valid)
 		WT_ERR(__wt_kv_return(session, cbt, upd));
-	else
+	else {
+		/*search_keyõpageϵڴ棬search nearͷpageȿ*/
+		WT_ERR(__wt_buf_set(session, &cbt->iface.key, cbt->search_key.data, cbt->search_key.size));
 		WT_ERR(__wt_btcur_search_near(cbt, 0));
+	}
 
 err:
 	if (ret != 0)
@@ -872,6 +1290,7 @@ int __wt_btcur_close(WT_CURSOR_BTREE* cbt)
 	ret = __curfile_leave(cbt);
 	__wt_buf_free(session, &cbt->search_key);
 	__wt_buf_free(session, &cbt->tmp);
+	__wt_free(session, cbt->hs_upd);
 
 	return ret;
 }
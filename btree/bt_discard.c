@@ -38,6 +38,10 @@ void __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 	WT_ASSERT(session, !F_ISSET_ATOMIC(page, WT_PAGE_EVICT_LRU));
 	WT_ASSERT(session, !F_ISSET_ATOMIC(page, WT_PAGE_SPLITTING));
 
+	/*ӦhashָpageentryʧЧ*/
+	if (page->ahi_slots != NULL)
+		__wt_ahi_page_invalidate(session, page);
+
 	switch(page->type){
 	case WT_PAGE_COL_INT:
 	case WT_PAGE_ROW_INT:
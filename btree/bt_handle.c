@@ -109,6 +109,7 @@ int __wt_btree_close(WT_SESSION_IMPL* session)
 	__wt_btree_huffman_close(session);
 
 	/*ͷŵlatchbtreekvڴcollator*/
+	WT_TRET(__wt_ahi_destroy(session));
 	WT_TRET(__wt_rwlock_destroy(session, &btree->ovfl_lock));
 	__wt_spin_destroy(session, &btree->flush_lock);
 
@@ -224,6 +225,9 @@ static int __btree_conf(WT_SESSION_IMPL* sssion, WT_CKPT* ckpt)
 		WT_RET(__wt_config_gets(session, cfg, "internal_key_truncate", &cval));
 		btree->internal_key_truncate = cval.val == 0 ? 0 : 1;
 
+		WT_RET(__wt_config_gets(session, cfg, "subtree_counts", &cval));
+		btree->subtree_counts = cval.val == 0 ? 0 : 1;
+
 		WT_RET(__wt_config_gets(session, cfg, "prefix_compression", &cval));
 		btree->prefix_compression = cval.val == 0 ? 0 : 1;
 
@@ -235,6 +239,13 @@ static int __btree_conf(WT_SESSION_IMPL* sssion, WT_CKPT* ckpt)
 		btree->dictionary = (u_int)cval.val;
 		break;
 	}
+	/*ȵҶpageϵӦhash0ʾر*/
+	if (btree->type == BTREE_ROW && !F_ISSET(btree, WT_BTREE_SPECIAL_FLAGS)) {
+		WT_RET(__wt_config_gets(session, cfg, "adaptive_hash", &cval));
+		if (cval.val != 0)
+			WT_RET(__wt_ahi_create(session, (uint32_t)cval.val));
+	}
+
 	/*ʼѹ*/
 	WT_RET(__wt_config_gets_none(session, cfg, "block_compressor", &cval));
 	WT_RET(__wt_compressor_config(session, &cval, &btree->compressor));
@@ -489,6 +500,10 @@ static int __btree_page_sizes(WT_SESSION_IMPL* session)
 	intl_split_size = __wt_split_page_size(btree, btree->maxintlpage);
 	leaf_split_size = __wt_split_page_size(btree, btree->maxleafpage);
 
+	/*cachehuge pageڴṩΪbtreepage size׼slab size class*/
+	WT_RET(__wt_cache_mem_register(session, btree->maxintlpage));
+	WT_RET(__wt_cache_mem_register(session, btree->maxleafpage));
+
 	/*ȷdeep min/max childС*/
 	if (__wt_config_gets(session, cfg, "split_deepen_min_child", &cval) == WT_NOTFOUND || cval.val == 0)
 		btree->split_deepen_min_child = WT_SPLIT_DEEPEN_MIN_CHILD_DEF;
@@ -9,6 +9,7 @@ int __wt_bt_read(WT_SESSION_IMPL* session, WT_ITEM* buf, const uint8_t* addr, si
 {
 	WT_BM* bm;
 	WT_BTREE* btree;
+	WT_DECL_ITEM(etmp);
 	WT_DECL_ITEM(tmp);
 	WT_DECL_RET;
 
@@ -18,13 +19,16 @@ int __wt_bt_read(WT_SESSION_IMPL* session, WT_ITEM* buf, const uint8_t* addr, si
 	btree = S2BT(session);
 	bm = btree->bm;
 
-	/*btreeһѹ͵ݴ洢Ƚѹ,ôȡݱȴһʱУȻѹbuf*/
+	/*
+	 * btreeһѹ͵ݴ洢ȡȴsessionеĶI/O,
+	 * Ȼֱӽѹbuf(յpage image)
+	 */
 	if (btree->compressor == NULL){
 		WT_RET(bm->read(bm, session, buf, addr, addr_size));
 		dsk = buf->data;
 	}
 	else{
-		WT_RET(__wt_scr_alloc(session, 0, &tmp));
+		WT_RET(__wt_io_buf_get(session, &tmp));
 		WT_ERR(bm->read(bm, session, tmp, addr, addr_size));
 		dsk = tmp->data;
 	}
@@ -59,18 +63,33 @@ int __wt_bt_read(WT_SESSION_IMPL* session, WT_ITEM* buf, const uint8_t* addr, si
 			* This should be rare, but happens with small blocks
 			* that aren't worth compressing.
 			* ̫ǲѹ
+			*
+			* If the destination has no memory of its own and doesn't
+			* have to come from the cache's memory, hand it the I/O
+			* buffer's memory instead of copying the page; the pool
+			* allocates a new buffer on the next read.
 			*/
-			WT_ERR(__wt_buf_set(session, buf, tmp->data, dsk->mem_size));
+			if (buf->mem == NULL && !F_ISSET(buf, WT_ITEM_CACHE)) {
+				buf->mem = tmp->mem;
+				buf->memsize = tmp->memsize;
+				buf->data = buf->mem;
+				buf->size = dsk->mem_size;
+				F_SET(buf, WT_ITEM_ALIGNED);
+
+				tmp->mem = NULL;
+				tmp->memsize = 0;
+				tmp->data = NULL;
+			}
+			else
+				WT_ERR(__wt_buf_set(session, buf, tmp->data, dsk->mem_size));
 		}
 	}
 
 	/*У*/
 	if (F_ISSET(btree, WT_BTREE_VERIFY)) {
-		if (tmp == NULL)
-			WT_ERR(__wt_scr_alloc(session, 0, &tmp));
-
-		WT_ERR(bm->addr_string(bm, session, tmp, addr, addr_size));
-		WT_ERR(__wt_verify_dsk(session, (const char *)tmp->data, buf));
+		WT_ERR(__wt_scr_alloc(session, 0, &etmp));
+		WT_ERR(bm->addr_string(bm, session, etmp, addr, addr_size));
+		WT_ERR(__wt_verify_dsk(session, (const char *)etmp->data, buf));
 	}
 
 	/*޸ͳϢ*/
@@ -82,7 +101,9 @@ int __wt_bt_read(WT_SESSION_IMPL* session, WT_ITEM* buf, const uint8_t* addr, si
 	WT_STAT_FAST_DATA_INCRV(session, cache_bytes_read, dsk->mem_size);
 
 err:
-	__wt_scr_free(session, &tmp);
+	__wt_io_buf_put(session, &tmp);
+	__wt_scr_free(session, &etmp);
+	return ret;
 }
 
 /*bufед뵽addrӦpageеblock*/
@@ -42,7 +42,7 @@ int __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 	WT_DECL_RET;
 	WT_PAGE *page;
 	u_int sleep_cnt, wait_cnt;
-	int busy, force_attempts, oldgen;
+	int busy, force_attempts, in_epoch, oldgen;
 
 	for (force_attempts = oldgen = 0, wait_cnt = 0;;){
 		switch (ref->state){
@@ -114,13 +114,17 @@ int __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 			/*pageûevictread_genһʼ״̬ôһevictж̬evict*/
 			if (oldgen && page->read_gen == WT_READGEN_NOTSET)
 				__wt_page_evict_soon(page);
-			else if (!LF_ISSET(WT_READ_NO_GEN) && page->read_gen != WT_READGEN_OLDEST && page->read_gen < __wt_cache_read_gen(session))
-				page->read_gen = __wt_cache_read_gen_set(session); /*Ϊڴеpageһlru read_gen汾*/
+			else if (!LF_ISSET(WT_READ_NO_GEN))
+				__wt_cache_read_gen_bump(session, page, flags); /*Ϊڴеpageһlru read_gen汾*/
 
 			return 0;
 			WT_ILLEGAL_VALUE(session);
 		}
 
+		/*ȴڼ뿪hazard epochevictpage߳̿ڵȴsession*/
+		if ((in_epoch = (session->hazard_gen != 0)) != 0)
+			__wt_hazard_gen_leave(session);
+
 		/*spin waiting*/
 		if (++wait_cnt < 1000)
 			__wt_yield();
@@ -130,6 +134,9 @@ int __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 			WT_STAT_FAST_CONN_INCRV(session, page_sleep, sleep_cnt);
 			__wt_sleep(0, sleep_cnt);
 		}
+
+		if (in_epoch)
+			__wt_hazard_gen_enter(session);
 	}
 }
 
@@ -169,7 +176,7 @@ int __wt_page_alloc(WT_SESSION_IMPL* session, uint8_t type, uint64_t recno, uint
 	}
 
 	/*pageռ䲢page*/
-	WT_RET(__wt_calloc(session, 1, size, &page));
+	WT_RET(__wt_cache_mem_calloc(session, 1, size, &page));
 	page->type = type;
 	/*һʼread_genֵ*/
 	page->read_gen = WT_READGEN_NOTSET;
@@ -184,7 +191,7 @@ int __wt_page_alloc(WT_SESSION_IMPL* session, uint8_t type, uint64_t recno, uint
 	case WT_PAGE_ROW_INT:
 		page->pg_intl_recno = recno;
 		/*ڴеWT_REFͶӦref slot arrayռ*/
-		WT_ERR(__wt_calloc(session, 1, sizeof(WT_PAGE_INDEX)+alloc_entries * sizeof(WT_REF *), &p));
+		WT_ERR(__wt_cache_mem_calloc(session, 1, sizeof(WT_PAGE_INDEX)+alloc_entries * sizeof(WT_REF *), &p));
 		size += sizeof(WT_PAGE_INDEX)+alloc_entries * sizeof(WT_REF *);
 		pindex = p;
 		pindex->index = (WT_REF **)((WT_PAGE_INDEX *)p + 1);
@@ -11,10 +11,15 @@ int __wt_cache_read(WT_SESSION_IMPL* session, WT_REF* ref)
 	WT_PAGE_STATE previous_state;
 	size_t addr_size;
 	const uint8_t *addr;
+	int in_epoch;
+	struct timespec start;
 
 	page = NULL;
 
 	WT_CLEAR(tmp);
+	/*huge pageڴṩ, page imageֱӴcacheڴз*/
+	if (S2C(session)->cache->mem != NULL)
+		F_SET(&tmp, WT_ITEM_CACHE);
 
 	/*refǷѾʼpageĴݽжȡ,ڴϵpageһWT_REF_DISKWT_REF_DELETED״̬ڴ*/
 	if (WT_ATOMIC_CAS4(ref->state, WT_REF_DISK, WT_REF_READING)) /*óreading,߳pageʱpageȫڴв*/
@@ -24,6 +29,8 @@ int __wt_cache_read(WT_SESSION_IMPL* session, WT_REF* ref)
 	else
 		return 0;
 
+	WT_LATENCY_BEGIN(session, start);
+
 	/*pageblock address*/
 	WT_ERR(__wt_ref_info(session, ref, &addr, &addr_size, NULL));
 	if (addr == NULL){ /*ûҵblock addr,ֱ½һpage*/
@@ -33,8 +40,13 @@ int __wt_cache_read(WT_SESSION_IMPL* session, WT_REF* ref)
 		ref->page = page;
 	}
 	else{
-		/*ӴļϽpageݶڴ*/
-		WT_ERR(__wt_bt_read(session, &tmp, addr, addr_size));
+		/*ӴļϽpageݶڴ, IOڼ뿪hazard epoch, eviction*/
+		if ((in_epoch = (session->hazard_gen != 0)) != 0)
+			__wt_hazard_gen_leave(session);
+		ret = __wt_bt_read(session, &tmp, addr, addr_size);
+		if (in_epoch)
+			__wt_hazard_gen_enter(session);
+		WT_ERR(ret);
 		/*page֯ṹͶ*/
 		WT_ERR(__wt_page_inmem(session, ref, tmp.data, tmp.memsize, WT_DATA_IN_ITEM(&tmp) ? WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED, &page));
 		tmp.mem = NULL;
@@ -48,6 +60,7 @@ int __wt_cache_read(WT_SESSION_IMPL* session, WT_REF* ref)
 	/*pageڴ״̬Чҳ*/
 	WT_PUBLISH(ref->state, WT_REF_MEM);
 
+	WT_LATENCY_END(session, WT_LATENCY_CACHE_READ, start);
 	return 0;
 
 err:
@@ -253,6 +253,8 @@ static int __split_ref_deepen_move(WT_SESSION_IMPL* session, WT_PAGE* parent, WT
 		}
 		addr->size = (uint8_t)unpack.size;
 		addr->type = unpack.raw == WT_CELL_ADDR_INT ? WT_ADDR_INT : WT_ADDR_LEAF;
+		if (parent->type == WT_PAGE_ROW_INT)
+			addr->rows = unpack.v;
 		ref->addr = addr;
 	}
 
@@ -595,6 +597,7 @@ int __wt_multi_to_ref(WT_SESSION_IMPL* session, WT_PAGE* page, WT_MULTI* multi,
 		ref->addr = addr;
 		addr->size = multi->addr.size;
 		addr->type = multi->addr.type;
+		addr->rows = multi->addr.rows;
 		WT_RET(__wt_strndup(session, multi->addr.addr, addr->size, &addr->addr));
 	}
 	else
@@ -643,6 +646,10 @@ static int __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_ne
 	parent_entries = 0;
 	complete = hazard = 0;
 
+	/*Ӧhashеentry˼ͷŵrefʧЧ*/
+	if (ref->page != NULL && ref->page->ahi_slots != NULL)
+		__wt_ahi_page_invalidate(session, ref->page);
+
 	/*
 	* Get a page-level lock on the parent to single-thread splits into the
 	* page because we need to single-thread sizing/growing the page index.
@@ -873,8 +880,9 @@ int __wt_split_insert(WT_SESSION_IMPL* session, WT_REF* ref, int* splitp)
 	WT_INSERT_HEAD *ins_head;
 	WT_PAGE *page, *right;
 	WT_REF *child, *split_ref[2] = { NULL, NULL };
-	size_t page_decr, parent_incr, right_incr;
+	size_t cnt, key_size, len, page_decr, parent_incr, right_incr;
 	int i;
+	const uint8_t *pa, *pb;
 
 	*splitp = 0;
 
@@ -974,8 +982,34 @@ int __wt_split_insert(WT_SESSION_IMPL* session, WT_REF* ref, int* splitp)
 	child = split_ref[1];
 	child->page = right;
 	child->state = WT_REF_MEM;
-	WT_ERR(__wt_row_ikey(session, 0, WT_INSERT_KEY(moved_ins), WT_INSERT_KEY_SIZE(moved_ins), child));
-	parent_incr += sizeof(WT_REF) + sizeof(WT_IKEY) + WT_INSERT_KEY_SIZE(moved_ins);
+
+	/*
+	 * Suffix truncation, the same as reconciliation does when it promotes
+	 * keys from leaf pages: the right page's key only has to sort after the
+	 * largest key staying on the original page, the key moved before it in
+	 * the insert list.  Promote the shortest prefix of the moved key that
+	 * does, the shorter parent key is all searches need.
+	 */
+	key_size = WT_INSERT_KEY_SIZE(moved_ins);
+	if (btree->collator == NULL && btree->internal_key_truncate) {
+		prev_ins = NULL;
+		for (i = WT_SKIP_MAXDEPTH - 1; i >= 0; --i)
+			for (ins = (prev_ins == NULL) ? ins_head->head[i] : prev_ins->next[i]; ins != NULL && ins != moved_ins; ins = ins->next[i])
+				prev_ins = ins;
+		WT_ASSERT(session, prev_ins != NULL);
+
+		pa = WT_INSERT_KEY(prev_ins);
+		pb = WT_INSERT_KEY(moved_ins);
+		len = WT_MIN(WT_INSERT_KEY_SIZE(prev_ins), key_size);
+		for (cnt = 0; cnt < len && pa[cnt] == pb[cnt]; ++cnt)
+			;
+		if (cnt + 1 < key_size) {
+			WT_STAT_FAST_DATA_INCRV(session, rec_suffix_compression, key_size - (cnt + 1));
+			key_size = cnt + 1;
+		}
+	}
+	WT_ERR(__wt_row_ikey(session, 0, WT_INSERT_KEY(moved_ins), key_size, child));
+	parent_incr += sizeof(WT_REF) + sizeof(WT_IKEY) + key_size;
 
 	/*½pageʾΪҳ*/
 	WT_ERR(__wt_page_modify_init(session, right));
@@ -990,6 +1024,12 @@ int __wt_split_insert(WT_SESSION_IMPL* session, WT_REF* ref, int* splitp)
 	*/
 	right->modify->first_dirty_txn = WT_TXN_FIRST;
 
+	/*moved_insӦһתƵright page*/
+	if (btree->subtree_counts && !WT_UPDATE_DELETED_ISSET(moved_ins->upd)) {
+		right->modify->rows_delta = 1;
+		(void)WT_ATOMIC_SUB8(page->modify->rows_delta, 1);
+	}
+
 	/*Ҫƶռݵright*/
 	for (i = 0; i < WT_SKIP_MAXDEPTH && ins_head->tail[i] == moved_ins; ++i)
 		;
@@ -1080,6 +1120,8 @@ int __wt_split_insert(WT_SESSION_IMPL* session, WT_REF* ref, int* splitp)
 		right->pg_row_ins[0]->head[0] = right->pg_row_ins[0]->tail[0] = NULL;
 		ins_head->tail[0]->next[0] = moved_ins;
 		ins_head->tail[0] = moved_ins;
+		if (right->modify->rows_delta != 0)
+			(void)WT_ATOMIC_ADD8(ref->page->modify->rows_delta, right->modify->rows_delta);
 
 		right->modify->write_gen = 0;
 		__wt_cache_dirty_decr(session, right);
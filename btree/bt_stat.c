@@ -7,6 +7,14 @@ static int  __stat_page(WT_SESSION_IMPL *session, WT_PAGE *page, WT_DSRC_STATS *
 static void __stat_page_col_var(WT_PAGE *page, WT_DSRC_STATS *cst);
 static void __stat_page_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, WT_DSRC_STATS *cst);
 static void __stat_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page, WT_DSRC_STATS *cst);
+static int  __stat_sample(WT_SESSION_IMPL *session, WT_DSRC_STATS *stats);
+
+/*ͳƵɼڿpageʱԵı*/
+#define	WT_BTREE_STAT_SAMPLES		1000
+#define	WT_BTREE_STAT_SAMPLE_RETRY	4
+
+/*ڹ㲻ͬkeyǰ׺ǰ׺*/
+#define	WT_BTREE_STAT_PREFIX		8
 
 /*ʼbtreeͳ״̬Ϣ*/
 int __wt_btree_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
@@ -30,6 +38,11 @@ int __wt_btree_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
 	WT_STAT_SET(stats, btree_maxleafpage, btree->maxleafpage);
 	WT_STAT_SET(stats, btree_maxleafkey, btree->maxleafkey);
 	WT_STAT_SET(stats, btree_maxleafvalue, btree->maxleafvalue);
+
+	/*ͳƣȡļ¼key/valueĴСֲ*/
+	if (F_ISSET(cst, WT_CONN_STAT_SAMPLE))
+		return (__stat_sample(session, stats));
+
 	/*ҪͳȫϢΪֹ*/
 	if (!F_ISSET(cst, WT_CONN_STAT_ALL))
 		return 0;
@@ -225,3 +238,178 @@ static void __stat_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page, WT_DSR
 
 
 
+
+/*ƽȡ*/
+static uint64_t __stat_isqrt(uint64_t v)
+{
+	uint64_t r;
+
+	if (v < 2)
+		return v;
+
+	/*ţٵһСڽֵʼݼ*/
+	r = v / 2 + 1;
+	while (r > v / r)
+		r = (r + v / r) / 2;
+	return r;
+}
+
+/*մСһkeyvalueķֱֲͼ*/
+#define	WT_STAT_SAMPLE_SIZE(stats, name, size) do {			\
+	if ((size) <= 16)						\
+		WT_STAT_INCR(stats, btree_sample_##name##_le16);	\
+	else if ((size) <= 64)						\
+		WT_STAT_INCR(stats, btree_sample_##name##_le64);	\
+	else if ((size) <= 256)						\
+		WT_STAT_INCR(stats, btree_sample_##name##_le256);	\
+	else if ((size) <= 1024)					\
+		WT_STAT_INCR(stats, btree_sample_##name##_le1k);	\
+	else								\
+		WT_STAT_INCR(stats, btree_sample_##name##_gt1k);	\
+} while (0)
+
+/*
+ * __stat_sample_value --
+ *	Return the size of the value a sampled cursor is positioned on, *skipp
+ * is set if the record isn't visible.  Overflow values are counted as one
+ * byte larger than the largest on-page value, they're never read.
+ */
+static void __stat_sample_value(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, size_t* sizep, int* skipp)
+{
+	WT_BTREE *btree;
+	WT_CELL *cell;
+	WT_CELL_UNPACK unpack;
+	WT_ITEM value;
+	WT_PAGE *page;
+	WT_ROW *rip;
+	WT_UPDATE *upd;
+
+	btree = cbt->btree;
+	page = cbt->ref->page;
+	rip = page->pg_row_d + cbt->slot;
+	*sizep = 0;
+	*skipp = 0;
+
+	upd = (cbt->ins != NULL) ? cbt->ins->upd : WT_ROW_UPDATE(page, rip);
+	if ((upd = __wt_txn_read(session, upd)) != NULL) {
+		if (WT_UPDATE_DELETED_ISSET(upd))
+			*skipp = 1;
+		else
+			*sizep = upd->size;
+		return;
+	}
+
+	/*insert listϵļ¼Եǰ񶼲ɼ*/
+	if (cbt->ins != NULL) {
+		*skipp = 1;
+		return;
+	}
+
+	if (__wt_row_leaf_value(page, rip, &value)) {
+		*sizep = value.size;
+		return;
+	}
+	if ((cell = __wt_row_leaf_value_cell(page, rip, NULL)) == NULL)
+		return;
+
+	__wt_cell_unpack(cell, &unpack);
+	*sizep = unpack.ovfl ? btree->maxleafvalue + 1 : unpack.size;
+}
+
+/*
+ * __stat_sample --
+ *	Fill in the sampled statistics of a row-store tree: the key and value
+ * size distributions of up to WT_BTREE_STAT_SAMPLES records chosen at random,
+ * and an estimate of the distinct key prefixes.  The distinct estimate scales
+ * the prefixes seen once in the sample by the square root of the ratio of the
+ * tree's rows to the sample size (the GEE estimator), the tree's rows are only
+ * known when the tree keeps subtree counts, otherwise the distinct prefixes in
+ * the sample are reported.
+ */
+static int __stat_sample(WT_SESSION_IMPL* session, WT_DSRC_STATS* stats)
+{
+	WT_BTREE *btree;
+	WT_CURSOR_BTREE cbt;
+	WT_DECL_RET;
+	size_t vsize;
+	uint64_t *hashes, distinct, once, records, run;
+	uint32_t attempts, i, n;
+	int skip;
+
+	btree = S2BT(session);
+	hashes = NULL;
+
+	WT_STAT_SET(stats, btree_sample_entries, 0);
+	WT_STAT_SET(stats, btree_sample_key_gt1k, 0);
+	WT_STAT_SET(stats, btree_sample_key_le16, 0);
+	WT_STAT_SET(stats, btree_sample_key_le1k, 0);
+	WT_STAT_SET(stats, btree_sample_key_le256, 0);
+	WT_STAT_SET(stats, btree_sample_key_le64, 0);
+	WT_STAT_SET(stats, btree_sample_prefix_distinct, 0);
+	WT_STAT_SET(stats, btree_sample_records, 0);
+	WT_STAT_SET(stats, btree_sample_value_gt1k, 0);
+	WT_STAT_SET(stats, btree_sample_value_le16, 0);
+	WT_STAT_SET(stats, btree_sample_value_le1k, 0);
+	WT_STAT_SET(stats, btree_sample_value_le256, 0);
+	WT_STAT_SET(stats, btree_sample_value_le64, 0);
+
+	if (btree->type != BTREE_ROW)
+		return 0;
+
+	/*ûеʱȡһsnapshotֻɼļ¼*/
+	__wt_txn_cursor_op(session);
+
+	records = 0;
+	if (btree->subtree_counts)
+		WT_RET(__wt_btree_count_range(session, NULL, NULL, 1, &records));
+	WT_STAT_SET(stats, btree_sample_records, records);
+
+	WT_RET(__wt_calloc_def(session, WT_BTREE_STAT_SAMPLES, &hashes));
+
+	WT_CLEAR(cbt);
+	cbt.btree = btree;
+	cbt.iface.session = &session->iface;
+
+	n = 0;
+	for (attempts = 0; n < WT_BTREE_STAT_SAMPLES && attempts < WT_BTREE_STAT_SAMPLES * WT_BTREE_STAT_SAMPLE_RETRY; ++attempts) {
+		WT_WITH_PAGE_INDEX(session, ret = __wt_row_random_sample(session, &cbt));
+		if (ret == WT_NOTFOUND) {
+			ret = 0;
+			continue;
+		}
+		WT_ERR(ret);
+
+		__stat_sample_value(session, &cbt, &vsize, &skip);
+		if (!skip) {
+			WT_STAT_SAMPLE_SIZE(stats, key, cbt.search_key.size);
+			WT_STAT_SAMPLE_SIZE(stats, value, vsize);
+			hashes[n++] = __wt_hash_city64(cbt.search_key.data, WT_MIN(cbt.search_key.size, WT_BTREE_STAT_PREFIX));
+		}
+
+		ret = __wt_page_release(session, cbt.ref, 0);
+		cbt.ref = NULL;
+		WT_ERR(ret);
+	}
+	WT_STAT_SET(stats, btree_sample_entries, n);
+
+	/*ͳвͬǰ׺ĸԼֻһεǰ׺*/
+	distinct = once = 0;
+	if (n > 0) {
+		qsort(hashes, n, sizeof(uint64_t), __wt_txnid_cmp);
+		for (i = 0, run = 1; i < n; ++i, ++run)
+			if (i + 1 == n || hashes[i + 1] != hashes[i]) {
+				++distinct;
+				if (run == 1)
+					++once;
+				run = 0;
+			}
+	}
+	if (n > 0 && records > n)
+		distinct = __stat_isqrt(records / n) * once + (distinct - once);
+	WT_STAT_SET(stats, btree_sample_prefix_distinct, distinct);
+
+err:
+	__wt_buf_free(session, &cbt.search_key);
+	__wt_free(session, hashes);
+	return ret;
+}
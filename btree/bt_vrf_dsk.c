@@ -64,7 +64,8 @@ int __wt_verify_dsk_image(WT_SESSION_IMPL *session, const char *addr, const WT_P
 	case WT_PAGE_OVFL:
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
-		if (dsk->recno == 0)
+		/*history store汾row leaf pagerecno¼滻ID*/
+		if (dsk->recno == 0 || (dsk->type == WT_PAGE_ROW_LEAF && F_ISSET(dsk, WT_PAGE_HS)))
 			break;
 		WT_RET_VRFY(session, "%s page at %s has a non-zero record number", __wt_page_type_string(dsk->type), addr);
 	}
@@ -83,6 +84,9 @@ int __wt_verify_dsk_image(WT_SESSION_IMPL *session, const char *addr, const WT_P
 
 		if (LF_ISSET(WT_PAGE_EMPTY_V_NONE))
 			LF_CLR(WT_PAGE_EMPTY_V_NONE);
+
+		if (LF_ISSET(WT_PAGE_HS))
+			LF_CLR(WT_PAGE_HS);
 	}
 
 	if (flags != 0)
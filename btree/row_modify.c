@@ -35,6 +35,7 @@ int __wt_row_modify(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* key
 	WT_PAGE *page;
 	WT_UPDATE *old_upd, **upd_entry;
 	size_t ins_size, upd_size;
+	int64_t rows_delta;
 	uint32_t ins_slot;
 	u_int i, skipdepth;
 	int logged;
@@ -42,6 +43,7 @@ int __wt_row_modify(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* key
 	ins = NULL;
 	page = cbt->ref->page;
 	logged = 0;
+	rows_delta = 0;
 
 	if(is_remove)
 		value = NULL;
@@ -62,6 +64,9 @@ int __wt_row_modify(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* key
 		if(upd == NULL){
 			/*ȷǷԽи²*/
 			WT_ERR(__wt_txn_update_check(session, old_upd = *upd_entry));
+			/*pageϵİ汾snapshot֮ύ*/
+			if (old_upd == NULL && cbt->ins == NULL)
+				WT_ERR(__wt_hs_update_check(session, page, key));
 
 			WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
 			WT_ERR(__wt_txn_modify(session, upd));
@@ -83,6 +88,12 @@ int __wt_row_modify(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* key
 		 */
 		upd->next = old_upd;
 
+		/*pageı仯µupdateǵupdateǷɾ*/
+		if (old_upd == NULL || !WT_UPDATE_DELETED_ISSET(old_upd))
+			--rows_delta;
+		if (!WT_UPDATE_DELETED_ISSET(upd))
+			++rows_delta;
+
 		/*ди²*/
 		WT_ERR(__wt_update_serial(session, page, upd_entry, &upd, upd_size));
 	}
@@ -120,6 +131,8 @@ int __wt_row_modify(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* key
 
 		ins->upd = upd;
 		ins_size += upd_size;
+		if (!WT_UPDATE_DELETED_ISSET(upd))
+			++rows_delta;
 
 		if (WT_SKIP_FIRST(ins_head) == NULL)
 			for (i = 0; i < skipdepth; i++) {
@@ -133,6 +146,9 @@ int __wt_row_modify(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM* key
 		/* Insert the WT_INSERT structure. */
 		WT_ERR(__wt_insert_serial(session, page, cbt->ins_head, cbt->ins_stack, &ins, ins_size, skipdepth));
 	}
+
+	if (rows_delta != 0 && S2BT(session)->subtree_counts)
+		(void)WT_ATOMIC_ADD8(page->modify->rows_delta, rows_delta);
 	
 	if(logged)
 		WT_ERR(__wt_txn_log_op(session, cbt));
@@ -193,23 +209,32 @@ int __wt_update_alloc(WT_SESSION_IMPL* session, WT_ITEM* value, WT_UPDATE** updp
 	return 0;
 }
 
-/* ڷupdateֻһsessionܿupdate汾ǰ洦rollbackİ汾Ϊ */
-WT_UPDATE* __wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+/*
+ * ڷupdateֻһsessionܿupdate汾ǰ洦rollbackİ汾Ϊ
+ * ض֮µupdate listȻܳʱpageȴ̵̭߳ĺ̨
+ */
+WT_UPDATE* __wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd)
 {
 	WT_UPDATE *first, *next;
+	u_int count, kept;
 
-
-	for(first = NULL; upd != NULL; upd = upd->next){
+	for(first = NULL, count = kept = 0; upd != NULL; upd = upd->next){
+		++count;
 		if(__wt_txn_visible_all(session, upd->txnid)){
-			if(first == NULL)
+			if(first == NULL){
 				first = upd;
+				kept = count;
+			}
 		}
 		else if(upd->txnid != WT_TXN_ABORTED)
 			first = NULL;
 	}
 
+	if((first == NULL ? count : kept) > WT_UPDATE_GC_CHAIN && page->modify != NULL)
+		page->modify->update_gc_pending = 1;
+
 	/*صһΪյupdTXNID = WT_TXN_ABORTEDupd񲻿ɼ*/
-	if(first != NULL &&& (next = first->next) != NULL && WT_ATOMIC_CAS8(first->next, next, NULL))
+	if(first != NULL && (next = first->next) != NULL && WT_ATOMIC_CAS8(first->next, next, NULL))
 		return next;
 
 	return NULL;
@@ -232,8 +257,94 @@ void __wt_update_obsolete_free(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDAT
 		__wt_cache_page_inmem_decr(session, page, size);
 }
 
+/*һupdate listжѾڵupdateͷŵupdate list*/
+static u_int __update_obsolete_chain(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd, WT_UPDATE **freep)
+{
+	WT_UPDATE *obsolete, *last;
+
+	if (upd == NULL || upd->next == NULL || (obsolete = __wt_update_obsolete_check(session, page, upd)) == NULL)
+		return 0;
+
+	/*ȹҵͷŵϣpagescanningʶ֮ͷ*/
+	for (last = obsolete; last->next != NULL; last = last->next)
+		;
+	last->next = *freep;
+	*freep = obsolete;
+	return 1;
+}
+
+/*
+ * __wt_update_obsolete_page --
+ *	Background version GC, called by the eviction walk for leaf pages it
+ * passes over.  Pages where an update left a long chain are rescanned once
+ * the oldest transaction ID has moved since their last pass, every chain on
+ * the page is trimmed to the newest update visible to all transactions, so
+ * hot keys that are read far more than they're updated don't keep their
+ * readers walking obsolete versions until the next update or reconciliation.
+ */
+void __wt_update_obsolete_page(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_INSERT *ins;
+	WT_INSERT_HEAD **heads;
+	WT_PAGE_MODIFY *mod;
+	WT_UPDATE *freelist;
+	uint64_t oldest;
+	uint32_t entries, i;
+	u_int trimmed;
+	int ret;
+
+	mod = page->modify;
+	oldest = S2C(session)->txn_global.oldest_id;
+	if (mod == NULL || !mod->update_gc_pending || mod->update_gc_oldest == oldest)
+		return;
+
+	/*дĹڼԼreconcile⣬pageڱɨʱһα*/
+	F_CAS_ATOMIC(page, WT_PAGE_SCANNING, ret);
+	if (ret != 0)
+		return;
+
+	/*ɨµĳupdate listʶ*/
+	mod->update_gc_pending = 0;
+	mod->update_gc_oldest = oldest;
+
+	freelist = NULL;
+	trimmed = 0;
+	heads = NULL;
+	entries = 0;
+	switch (page->type) {
+	case WT_PAGE_ROW_LEAF:
+		if (page->pg_row_upd != NULL)
+			for (i = 0; i < page->pg_row_entries; ++i)
+				trimmed += __update_obsolete_chain(session, page, page->pg_row_upd[i], &freelist);
+		heads = page->pg_row_ins;
+		entries = page->pg_row_entries + 1;
+		break;
+	case WT_PAGE_COL_FIX:
+		heads = mod->mod_update;
+		entries = 1;
+		break;
+	case WT_PAGE_COL_VAR:
+		heads = mod->mod_update;
+		entries = page->pg_var_entries;
+		break;
+	default:
+		break;
+	}
 
+	if (heads != NULL)
+		for (i = 0; i < entries; ++i)
+			WT_SKIP_FOREACH(ins, heads[i])
+				trimmed += __update_obsolete_chain(session, page, ins->upd, &freelist);
 
+	if (page->type != WT_PAGE_ROW_LEAF && (heads = mod->mod_append) != NULL)
+		WT_SKIP_FOREACH(ins, heads[0])
+			trimmed += __update_obsolete_chain(session, page, ins->upd, &freelist);
 
+	F_CLR_ATOMIC(page, WT_PAGE_SCANNING);
 
+	/*ͷŵڴpagecacheڴͳмȥ*/
+	__wt_update_obsolete_free(session, page, freelist);
 
+	WT_STAT_FAST_CONN_INCR(session, cache_update_gc_pages);
+	WT_STAT_FAST_CONN_INCRV(session, cache_update_gc, trimmed);
+}
@@ -122,8 +122,8 @@ int __wt_search_insert(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ITEM*
 	return 0;
 }
 
-/* ָkeyrefӦpageвҶλ洢ʽΪrow storeʽ */
-int __wt_row_search(WT_SESSION_IMPL* session, WT_ITEM* srch_key, WT_REF* leaf, WT_CURSOR_BTREE* cbt, int insert)
+/* rootʼָkeyrefӦpageвҶλ洢ʽΪrow storeʽ */
+static int __row_search_descent(WT_SESSION_IMPL* session, WT_ITEM* srch_key, WT_REF* leaf, WT_CURSOR_BTREE* cbt, int insert)
 {
 	WT_BTREE *btree;
 	WT_COLLATOR *collator;
@@ -384,6 +384,38 @@ err:
 	return ret;
 }
 
+/*
+ * __wt_row_search --
+ *	Search a row-store tree for a key.  Trees with an adaptive hash index
+ * try it first, and remember where full searches on hot leaf pages found
+ * their keys.
+ */
+int __wt_row_search(WT_SESSION_IMPL* session, WT_ITEM* srch_key, WT_REF* leaf, WT_CURSOR_BTREE* cbt, int insert)
+{
+	WT_BTREE *btree;
+	uint64_t hash;
+	int found;
+
+	btree = S2BT(session);
+
+	/*splitֻҶӽڵ㣬ʹhash*/
+	if (leaf != NULL || btree->ahi == NULL)
+		return (__row_search_descent(session, srch_key, leaf, cbt, insert));
+
+	__cursor_pos_clear(cbt);
+
+	hash = __wt_hash_city64(srch_key->data, srch_key->size);
+	WT_RET(__wt_ahi_search(session, cbt, srch_key, hash, &found));
+	if (found)
+		return 0;
+
+	WT_RET(__row_search_descent(session, srch_key, leaf, cbt, insert));
+	if (cbt->compare == 0)
+		__wt_ahi_insert(session, cbt, hash);
+
+	return 0;
+}
+
 /* btree cursorλbtreeһ¼λ */
 int __wt_row_random(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt)
 {
@@ -468,5 +500,176 @@ err:
 	return ret;
 }
 
+/*һ64λ*/
+static inline uint64_t __row_random64(WT_SESSION_IMPL* session)
+{
+	return ((uint64_t)__wt_random(session->rnd) << 32 | __wt_random(session->rnd));
+}
+
+/*
+ * __row_random_rows --
+ *	Return the rows in a child's subtree plus one, or 0 if the child has no
+ * address recording them.  Eviction frees the address of an in-memory page
+ * when it writes the page, so it's only read under a hazard pointer; a
+ * modified leaf page adds its row delta.
+ */
+static inline uint64_t __row_random_rows(WT_SESSION_IMPL* session, WT_REF* ref)
+{
+	WT_PAGE *page;
+	int64_t delta;
+	uint64_t rows;
+
+	switch (ref->state) {
+	case WT_REF_DELETED:
+		return 1;
+	case WT_REF_DISK:
+		return (__wt_ref_rows(ref));
+	case WT_REF_MEM:
+		/*ֻѾڴеpageȴ̭Ҳread generation*/
+		if (__wt_page_in(session, ref, WT_READ_CACHE | WT_READ_NO_EVICT | WT_READ_NO_GEN | WT_READ_NO_WAIT) != 0)
+			return 0;
+		page = ref->page;
+		if ((rows = __wt_ref_rows(ref)) != 0 && page->type == WT_PAGE_ROW_LEAF && page->modify != NULL) {
+			delta = (int64_t)rows + page->modify->rows_delta;
+			rows = delta > 1 ? (uint64_t)delta : 1;
+		}
+		(void)__wt_page_release(session, ref, WT_READ_NO_EVICT);
+		return rows;
+	default:
+		return 0;
+	}
+}
+
+/*insert listеĵ*rp¼listеļ¼ʱ*rpмȥlistĳȲNULL*/
+static inline WT_INSERT* __row_random_ins(WT_INSERT_HEAD* ins_head, uint64_t* rp)
+{
+	WT_INSERT *ins;
+
+	WT_SKIP_FOREACH(ins, ins_head) {
+		if (*rp == 0)
+			return ins;
+		--*rp;
+	}
+	return NULL;
+}
+
+/*
+ * __wt_row_random_sample --
+ *	Position the cursor on a record chosen with uniform probability.  The
+ * descent picks each child with probability proportional to the rows in its
+ * subtree (children without an address recording it weigh the average of
+ * their siblings), the leaf page picks uniformly among its on-page and inserted
+ * records.  Without subtree counts the descent is uniform over the children.
+ */
+int __wt_row_random_sample(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt)
+{
+	WT_BTREE *btree;
+	WT_DECL_ITEM(weights);
+	WT_DECL_RET;
+	WT_INSERT *ins;
+	WT_INSERT_HEAD *ins_head;
+	WT_PAGE *page;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *current, *descent;
+	uint64_t avg, known, r, total, *w;
+	uint32_t i, nknown, slot;
+
+	btree = S2BT(session);
+
+	__cursor_pos_clear(cbt);
+	WT_RET(__wt_scr_alloc(session, 0, &weights));
+
+restart:
+	current = &btree->root;
+	for (;;) {
+		page = current->page;
+		if (page->type != WT_PAGE_ROW_INT)
+			break;
+
+		WT_INTL_INDEX_GET(session, page, pindex);
+
+		/*ÿӵֻȡһΣû¼ĺм¼ĺӵƽΪȨ*/
+		WT_ERR(__wt_buf_init(session, weights, pindex->entries * sizeof(uint64_t)));
+		w = weights->mem;
+		known = 0;
+		nknown = 0;
+		for (i = 0; i < pindex->entries; ++i)
+			if ((w[i] = __row_random_rows(session, pindex->index[i])) != 0) {
+				known += w[i] - 1;
+				++nknown;
+			}
+		avg = (nknown == 0 || known < nknown) ? 1 : known / nknown;
+
+		total = 0;
+		for (i = 0; i < pindex->entries; ++i) {
+			w[i] = w[i] == 0 ? avg : w[i] - 1;
+			total += w[i];
+		}
+
+		if (total == 0)
+			descent = pindex->index[__wt_random(session->rnd) % pindex->entries];
+		else {
+			r = __row_random64(session) % total;
+			for (i = 0; r >= w[i]; ++i)
+				r -= w[i];
+			descent = pindex->index[i];
+		}
+
+		if ((ret = __wt_page_swap(session, current, descent, 0)) == 0) {
+			current = descent;
+			continue;
+		}
+
+		if (ret == WT_RESTART && (ret = __wt_page_release(session, current, 0)) == 0)
+			goto restart;
+
+		goto done;
+	}
 
+	/*Ҷpageϵļ¼ҳkeyСinsert listȻÿλϵļ¼insert list*/
+	total = page->pg_row_entries;
+	if (page->pg_row_ins != NULL)
+		for (i = 0; i <= page->pg_row_entries; ++i)
+			WT_SKIP_FOREACH(ins, page->pg_row_ins[i])
+				++total;
+	if (total == 0)
+		WT_ERR(WT_NOTFOUND);
 
+	r = __row_random64(session) % total;
+	ins = NULL;
+	ins_head = NULL;
+	slot = 0;
+	if (page->pg_row_ins == NULL)
+		slot = (uint32_t)r;
+	else if ((ins = __row_random_ins(ins_head = WT_ROW_INSERT_SMALLEST(page), &r)) != NULL)
+		F_SET(cbt, WT_CBT_SEARCH_SMALLEST);
+	else
+		for (;; ++slot) {
+			if (r == 0)
+				break;
+			--r;
+			if ((ins = __row_random_ins(ins_head = WT_ROW_INSERT_SLOT(page, slot), &r)) != NULL)
+				break;
+		}
+
+	if (ins == NULL)
+		WT_ERR(__wt_row_leaf_key(session, page, page->pg_row_d + slot, &cbt->search_key, 0));
+	else {
+		cbt->ins_head = ins_head;
+		cbt->ins = ins;
+		cbt->search_key.data = WT_INSERT_KEY(ins);
+		cbt->search_key.size = WT_INSERT_KEY_SIZE(ins);
+	}
+
+	cbt->ref = current;
+	cbt->compare = 0;
+	cbt->slot = slot;
+
+	if (0) {
+err:
+		WT_TRET(__wt_page_release(session, current, 0));
+	}
+done:
+	__wt_scr_free(session, &weights);
+	return ret;
+}
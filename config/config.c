@@ -499,9 +499,15 @@ static int __config_getraw(WT_CONFIG *cparser, WT_CONFIG_ITEM *key, WT_CONFIG_IT
 int __wt_config_get(WT_SESSION_IMPL *session, const char **cfg, WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value)
 {
 	WT_CONFIG cparser;
+	WT_CONFIG_COMPILED *cc;
 	WT_DECL_RET;
 	int found;
 
+	/*APIõ{method defaults, config}ջconfigǱãֱӲkey*/
+	if (cfg[0] != NULL && cfg[1] != NULL && cfg[2] == NULL &&
+	    (cc = __wt_config_compiled_find(session, cfg[1])) != NULL && cc->base == cfg[0])
+		return (__wt_config_compiled_get(session, cc, key, value));
+
 	for (found = 0; *cfg != NULL; cfg++) {
 		WT_RET(__wt_config_init(session, &cparser, *cfg));
 		if ((ret = __config_getraw(&cparser, key, value, 1)) == 0)
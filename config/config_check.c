@@ -159,6 +159,15 @@ err:
 /**/
 int __wt_config_check(WT_SESSION_IMPL *session, const WT_CONFIG_ENTRY *entry, const char *config, size_t config_len)
 {
+	WT_CONFIG_COMPILED *cc;
+
+	/*ڱʱѾ*/
+	if (config_len == 0 && (cc = __wt_config_compiled_find(session, config)) != NULL) {
+		if (strcmp(cc->entry->method, entry->method) != 0)
+			WT_RET_MSG(session, EINVAL, "configuration compiled for %s used with %s", cc->entry->method, entry->method);
+		return 0;
+	}
+
 	return (config == NULL || entry->checks == NULL ? 0 : config_check(session, entry->checks, entry->checks_entries, config, config_len));
 }
 
@@ -0,0 +1,233 @@
+/****************************************************************************
+*ַ(compiled configuration)Ӽû
+****************************************************************************/
+
+#include "wt_internal.h"
+
+/*ָconfig_compiledеʼλ*/
+#define	WT_CONFIG_COMPILED_PTR_SLOT(p)										\
+	((u_int)(((uintptr_t)(p) >> 4) * 0x9e3779b1U) & (WT_CONFIG_COMPILED_SLOTS - 1))
+
+/*ڱõkeyвkey, ҲNULL, insertΪ0ʱؿԲĿղ*/
+static WT_CONFIG_COMPILED_KEY* __config_compiled_key(WT_CONFIG_COMPILED* cc, const char* name, size_t len, int insert)
+{
+	WT_CONFIG_COMPILED_KEY *kp;
+	u_int mask, slot;
+
+	mask = cc->key_slots - 1;
+	for (slot = (u_int)__wt_hash_fnv64(name, len) & mask;; slot = (slot + 1) & mask) {
+		kp = &cc->keys[slot];
+		if (kp->name == NULL)
+			return (insert ? kp : NULL);
+
+		if (kp->len == len && strncmp(kp->name, name, len) == 0)
+			return kp;
+	}
+	/* NOTREACHED */
+}
+
+/*һַеĶkey뵽keyУֵֵȳֵֵ*/
+static int __config_compiled_load(WT_SESSION_IMPL* session, WT_CONFIG_COMPILED* cc, const char* config, int user)
+{
+	WT_CONFIG cparser;
+	WT_CONFIG_COMPILED_KEY *kp;
+	WT_CONFIG_ITEM k, v;
+	WT_DECL_RET;
+
+	WT_RET(__wt_config_init(session, &cparser, config));
+	while ((ret = __wt_config_next(&cparser, &k, &v)) == 0) {
+		if (k.type != WT_CONFIG_ITEM_STRING && k.type != WT_CONFIG_ITEM_ID)
+			continue;
+
+		kp = __config_compiled_key(cc, k.str, k.len, 1);
+		kp->name = k.str;
+		kp->len = k.len;
+		if (user) {
+			kp->user = v;
+			kp->user_set = 1;
+		}
+		else
+			kp->base = v;
+	}
+
+	return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*ַжkeyĸ*/
+static int __config_compiled_count(WT_SESSION_IMPL* session, const char* config, u_int* cntp)
+{
+	WT_CONFIG cparser;
+	WT_CONFIG_ITEM k, v;
+	WT_DECL_RET;
+
+	WT_RET(__wt_config_init(session, &cparser, config));
+	while ((ret = __wt_config_next(&cparser, &k, &v)) == 0)
+		++*cntp;
+
+	return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*ͷһ*/
+static void __config_compiled_free(WT_SESSION_IMPL* session, WT_CONFIG_COMPILED* cc)
+{
+	__wt_free(session, cc->config);
+	__wt_free(session, cc->keys);
+	__wt_free(session, cc);
+}
+
+/*
+ * __wt_config_compile --
+ *	WT_CONNECTION::compile_configuration.  Identical strings compiled for the
+ * same method share one entry in the configuration cache.
+ */
+int __wt_config_compile(WT_SESSION_IMPL* session, const char* method, const char* config, const char** compiledp)
+{
+	WT_CONFIG_COMPILED *cc;
+	const WT_CONFIG_ENTRY **epp;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	uint64_t hash;
+	u_int bucket, cnt, slot;
+	int locked;
+
+	conn = S2C(session);
+	cc = NULL;
+	locked = 0;
+	*compiledp = NULL;
+
+	if (method == NULL)
+		WT_RET_MSG(session, EINVAL, "no method specified");
+	if (config == NULL)
+		config = "";
+
+	/*ҵmethodӦ*/
+	for (epp = conn->config_entries; *epp != NULL && (*epp)->method != NULL; ++epp)
+		if (strcmp((*epp)->method, method) == 0)
+			break;
+	if (*epp == NULL || (*epp)->method == NULL)
+		WT_RET_MSG(session, WT_NOTFOUND, "no method matching %s found", method);
+
+	hash = __wt_hash_city64(config, strlen(config));
+	bucket = (u_int)(hash % WT_CONFIG_CACHE_BUCKETS);
+
+	__wt_spin_lock(session, &conn->config_cache_lock);
+	locked = 1;
+
+	/*ûѾͬıֱӷ*/
+	SLIST_FOREACH(cc, &conn->config_cache[bucket], hashl)
+		if (cc->hash == hash && cc->entry == *epp && cc->base == (*epp)->base && strcmp(cc->config, config) == 0) {
+			*compiledp = cc->config;
+			goto err;
+		}
+
+	if (conn->config_compiled_cnt >= WT_CONFIG_COMPILED_MAX)
+		WT_ERR_MSG(session, ENOMEM, "too many compiled configurations, the maximum is %d", WT_CONFIG_COMPILED_MAX);
+
+	/*ֻڱʱһãʹñAPIòټ*/
+	WT_ERR(__wt_config_check(session, *epp, config, 0));
+
+	WT_ERR(__wt_calloc_one(session, &cc));
+	WT_ERR(__wt_strdup(session, config, &cc->config));
+	cc->entry = *epp;
+	cc->base = (*epp)->base;
+	cc->hash = hash;
+
+	/*keyĴСkey֤Ѱַ̽ⳤȺܶ*/
+	cnt = 0;
+	WT_ERR(__config_compiled_count(session, cc->base, &cnt));
+	WT_ERR(__config_compiled_count(session, cc->config, &cnt));
+	cc->key_slots = __wt_nlpo2_round(2 * cnt + 2);
+	WT_ERR(__wt_calloc_def(session, cc->key_slots, &cc->keys));
+	WT_ERR(__config_compiled_load(session, cc, cc->base, 0));
+	WT_ERR(__config_compiled_load(session, cc, cc->config, 1));
+
+	/*Ĺٷָ*/
+	for (slot = WT_CONFIG_COMPILED_PTR_SLOT(cc->config); conn->config_compiled[slot] != NULL; slot = (slot + 1) & (WT_CONFIG_COMPILED_SLOTS - 1))
+		;
+	WT_PUBLISH(conn->config_compiled[slot], cc);
+	++conn->config_compiled_cnt;
+
+	SLIST_INSERT_HEAD(&conn->config_cache[bucket], cc, hashl);
+	*compiledp = cc->config;
+	cc = NULL;
+
+err:
+	if (locked)
+		__wt_spin_unlock(session, &conn->config_cache_lock);
+	if (cc != NULL && *compiledp == NULL)
+		__config_compiled_free(session, cc);
+
+	return ret;
+}
+
+/*ͨӦôַָұǱ÷NULL*/
+WT_CONFIG_COMPILED* __wt_config_compiled_find(WT_SESSION_IMPL* session, const char* config)
+{
+	WT_CONFIG_COMPILED *cc;
+	WT_CONNECTION_IMPL *conn;
+	u_int slot;
+
+	conn = S2C(session);
+	if (config == NULL || conn->config_compiled_cnt == 0)
+		return NULL;
+
+	for (slot = WT_CONFIG_COMPILED_PTR_SLOT(config);; slot = (slot + 1) & (WT_CONFIG_COMPILED_SLOTS - 1)) {
+		if ((cc = conn->config_compiled[slot]) == NULL)
+			return NULL;
+		if (cc->config == config)
+			return cc;
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __wt_config_compiled_get --
+ *	Look up a key in a compiled configuration with the same result as
+ * searching the { method defaults, configuration } stack: the application's
+ * value wins, and for dotted keys the application's sub-configuration is
+ * searched before the default one.
+ */
+int __wt_config_compiled_get(WT_SESSION_IMPL* session, WT_CONFIG_COMPILED* cc, WT_CONFIG_ITEM* key, WT_CONFIG_ITEM* value)
+{
+	WT_CONFIG_COMPILED_KEY *kp;
+	WT_CONFIG_ITEM subk;
+	WT_DECL_RET;
+	const char *dot;
+
+	dot = memchr(key->str, '.', key->len);
+	if ((kp = __config_compiled_key(cc, key->str, dot == NULL ? key->len : WT_PTRDIFF(dot, key->str), 0)) == NULL)
+		return WT_NOTFOUND;
+
+	if (dot == NULL) {
+		*value = kp->user_set ? kp->user : kp->base;
+		return 0;
+	}
+
+	subk.str = dot + 1;
+	subk.len = key->len - WT_PTRDIFF(subk.str, key->str);
+	subk.val = 0;
+	subk.type = WT_CONFIG_ITEM_STRING;
+	if (kp->user_set && (ret = __wt_config_subgetraw(session, &kp->user, &subk, value)) != WT_NOTFOUND)
+		return ret;
+
+	return __wt_config_subgetraw(session, &kp->base, &subk, value);
+}
+
+/*connectionرʱͷеı*/
+void __wt_config_compiled_discard(WT_SESSION_IMPL* session)
+{
+	WT_CONFIG_COMPILED *cc;
+	WT_CONNECTION_IMPL *conn;
+	u_int i;
+
+	conn = S2C(session);
+
+	for (i = 0; i < WT_CONFIG_CACHE_BUCKETS; ++i)
+		while ((cc = SLIST_FIRST(&conn->config_cache[i])) != NULL) {
+			SLIST_REMOVE_HEAD(&conn->config_cache[i], hashl);
+			__config_compiled_free(session, cc);
+		}
+
+	memset((void *)conn->config_compiled, 0, sizeof(conn->config_compiled));
+	conn->config_compiled_cnt = 0;
+}
@@ -30,6 +30,7 @@ static const WT_CONFIG_CHECK confchk_connection_load_extension[] = {
 };
 
 static const WT_CONFIG_CHECK confchk_connection_open_session[] = {
+	{ "cache_cursors", "boolean", NULL, NULL, NULL, 0 },
 	{ "isolation", "string",
 	NULL, "choices=[\"read-uncommitted\",\"read-committed\","
 	"\"snapshot\"]",
@@ -104,6 +105,9 @@ static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "eviction_dirty_target", "int",
 	NULL, "min=10,max=99",
 	NULL, 0 },
+	{ "eviction_policy", "string",
+	NULL, "choices=[\"lru\",\"2q\"]",
+	NULL, 0 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "file_manager", "category",
@@ -139,6 +143,7 @@ static const WT_CONFIG_CHECK confchk_cursor_reconfigure[] = {
 };
 
 static const WT_CONFIG_CHECK confchk_file_meta[] = {
+	{ "adaptive_hash", "int", NULL, "min=0,max=16M", NULL, 0 },
 	{ "allocation_size", "int",
 	NULL, "min=512B,max=128MB",
 	NULL, 0 },
@@ -190,6 +195,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	{ "split_deepen_min_child", "int", NULL, NULL, NULL, 0 },
 	{ "split_deepen_per_child", "int", NULL, NULL, NULL, 0 },
 	{ "split_pct", "int", NULL, "min=25,max=100", NULL, 0 },
+	{ "subtree_counts", "boolean", NULL, NULL, NULL, 0 },
 	{ "value_format", "format",
 	__wt_struct_confchk, NULL,
 	NULL, 0 },
@@ -205,6 +211,7 @@ static const WT_CONFIG_CHECK confchk_index_meta[] = {
 	__wt_extractor_confchk, NULL,
 	NULL, 0 },
 	{ "immutable", "boolean", NULL, NULL, NULL, 0 },
+	{ "include", "list", NULL, NULL, NULL, 0 },
 	{ "index_key_columns", "int", NULL, NULL, NULL, 0 },
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "source", "string", NULL, NULL, NULL, 0 },
@@ -239,6 +246,16 @@ static const WT_CONFIG_CHECK confchk_session_compact[] = {
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK confchk_session_count_range[] = {
+	{ "approximate", "boolean", NULL, NULL, NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
+static const WT_CONFIG_CHECK confchk_session_position_rank[] = {
+	{ "approximate", "boolean", NULL, NULL, NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK confchk_lsm_subconfigs[] = {
 	{ "auto_throttle", "boolean", NULL, NULL, NULL, 0 },
 	{ "bloom", "boolean", NULL, NULL, NULL, 0 },
@@ -251,10 +268,18 @@ static const WT_CONFIG_CHECK confchk_lsm_subconfigs[] = {
 	{ "chunk_size", "int", NULL, "min=512K,max=500MB", NULL, 0 },
 	{ "merge_max", "int", NULL, "min=2,max=100", NULL, 0 },
 	{ "merge_min", "int", NULL, "max=100", NULL, 0 },
+	{ "merge_policy", "string",
+	NULL, "choices=[\"leveled\",\"size\",\"tiered\","
+	"\"time_window\"]",
+	NULL, 0 },
+	{ "merge_ratio", "int", NULL, "min=2,max=100", NULL, 0 },
+	{ "merge_threads", "int", NULL, "min=1,max=64", NULL, 0 },
+	{ "merge_window", "int", NULL, "min=1", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
 static const WT_CONFIG_CHECK confchk_session_create[] = {
+	{ "adaptive_hash", "int", NULL, "min=0,max=16M", NULL, 0 },
 	{ "allocation_size", "int",
 	NULL, "min=512B,max=128MB",
 	NULL, 0 },
@@ -285,6 +310,7 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	__wt_huffman_confchk, NULL,
 	NULL, 0 },
 	{ "immutable", "boolean", NULL, NULL, NULL, 0 },
+	{ "include", "list", NULL, NULL, NULL, 0 },
 	{ "internal_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "internal_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "internal_key_truncate", "boolean", NULL, NULL, NULL, 0 },
@@ -299,7 +325,7 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	NULL, "min=512B,max=512MB",
 	NULL, 0 },
 	{ "leaf_value_max", "int", NULL, "min=0", NULL, 0 },
-	{ "lsm", "category", NULL, NULL, confchk_lsm_subconfigs, 11 },
+	{ "lsm", "category", NULL, NULL, confchk_lsm_subconfigs, 15 },
 	{ "memory_page_max", "int",
 	NULL, "min=512B,max=10TB",
 	NULL, 0 },
@@ -311,6 +337,7 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "split_deepen_min_child", "int", NULL, NULL, NULL, 0 },
 	{ "split_deepen_per_child", "int", NULL, NULL, NULL, 0 },
 	{ "split_pct", "int", NULL, "min=25,max=100", NULL, 0 },
+	{ "subtree_counts", "boolean", NULL, NULL, NULL, 0 },
 	{ "type", "string", NULL, NULL, NULL, 0 },
 	{ "value_format", "format",
 	__wt_struct_confchk, NULL,
@@ -324,6 +351,12 @@ static const WT_CONFIG_CHECK confchk_session_drop[] = {
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK confchk_session_load[] = {
+	{ "bulk", "boolean", NULL, NULL, NULL, 0 },
+	{ "create", "boolean", NULL, NULL, NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK confchk_session_open_cursor[] = {
 	{ "append", "boolean", NULL, NULL, NULL, 0 },
 	{ "bulk", "string", NULL, NULL, NULL, 0 },
@@ -331,19 +364,22 @@ static const WT_CONFIG_CHECK confchk_session_open_cursor[] = {
 	{ "dump", "string",
 	NULL, "choices=[\"hex\",\"json\",\"print\"]",
 	NULL, 0 },
+	{ "index_batch", "int", NULL, "min=0", NULL, 0 },
 	{ "next_random", "boolean", NULL, NULL, NULL, 0 },
+	{ "next_random_sample", "int", NULL, "min=0", NULL, 0 },
 	{ "overwrite", "boolean", NULL, NULL, NULL, 0 },
 	{ "raw", "boolean", NULL, NULL, NULL, 0 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "skip_sort_check", "boolean", NULL, NULL, NULL, 0 },
 	{ "statistics", "list",
-	NULL, "choices=[\"all\",\"fast\",\"clear\"]",
+	NULL, "choices=[\"all\",\"fast\",\"clear\",\"sample\"]",
 	NULL, 0 },
 	{ "target", "list", NULL, NULL, NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
 static const WT_CONFIG_CHECK confchk_session_reconfigure[] = {
+	{ "cache_cursors", "boolean", NULL, NULL, NULL, 0 },
 	{ "isolation", "string",
 	NULL, "choices=[\"read-uncommitted\",\"read-committed\","
 	"\"snapshot\"]",
@@ -403,6 +439,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	NULL, NULL,
 	confchk_async_subconfigs, 3 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
+	{ "cache_huge_pages", "boolean", NULL, NULL, NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
@@ -421,6 +458,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "eviction_dirty_target", "int",
 	NULL, "min=10,max=99",
 	NULL, 0 },
+	{ "eviction_policy", "string",
+	NULL, "choices=[\"lru\",\"2q\"]",
+	NULL, 0 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "exclusive", "boolean", NULL, NULL, NULL, 0 },
@@ -431,6 +471,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "file_manager", "category",
 	NULL, NULL,
 	confchk_file_manager_subconfigs, 2 },
+	{ "hazard_epoch", "boolean", NULL, NULL, NULL, 0 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
 	{ "log", "category", NULL, NULL, confchk_log_subconfigs, 7 },
 	{ "lsm_manager", "category",
@@ -469,6 +510,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	NULL, NULL,
 	confchk_async_subconfigs, 3 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
+	{ "cache_huge_pages", "boolean", NULL, NULL, NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
@@ -487,6 +529,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "eviction_dirty_target", "int",
 	NULL, "min=10,max=99",
 	NULL, 0 },
+	{ "eviction_policy", "string",
+	NULL, "choices=[\"lru\",\"2q\"]",
+	NULL, 0 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "exclusive", "boolean", NULL, NULL, NULL, 0 },
@@ -497,6 +542,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "file_manager", "category",
 	NULL, NULL,
 	confchk_file_manager_subconfigs, 2 },
+	{ "hazard_epoch", "boolean", NULL, NULL, NULL, 0 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
 	{ "log", "category", NULL, NULL, confchk_log_subconfigs, 7 },
 	{ "lsm_manager", "category",
@@ -536,6 +582,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	NULL, NULL,
 	confchk_async_subconfigs, 3 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
+	{ "cache_huge_pages", "boolean", NULL, NULL, NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
@@ -552,6 +599,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "eviction_dirty_target", "int",
 	NULL, "min=10,max=99",
 	NULL, 0 },
+	{ "eviction_policy", "string",
+	NULL, "choices=[\"lru\",\"2q\"]",
+	NULL, 0 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "extensions", "list", NULL, NULL, NULL, 0 },
@@ -561,6 +611,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "file_manager", "category",
 	NULL, NULL,
 	confchk_file_manager_subconfigs, 2 },
+	{ "hazard_epoch", "boolean", NULL, NULL, NULL, 0 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
 	{ "log", "category", NULL, NULL, confchk_log_subconfigs, 7 },
 	{ "lsm_manager", "category",
@@ -599,6 +650,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	NULL, NULL,
 	confchk_async_subconfigs, 3 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
+	{ "cache_huge_pages", "boolean", NULL, NULL, NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
@@ -615,6 +667,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "eviction_dirty_target", "int",
 	NULL, "min=10,max=99",
 	NULL, 0 },
+	{ "eviction_policy", "string",
+	NULL, "choices=[\"lru\",\"2q\"]",
+	NULL, 0 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "extensions", "list", NULL, NULL, NULL, 0 },
@@ -624,6 +679,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "file_manager", "category",
 	NULL, NULL,
 	confchk_file_manager_subconfigs, 2 },
+	{ "hazard_epoch", "boolean", NULL, NULL, NULL, 0 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
 	{ "log", "category", NULL, NULL, confchk_log_subconfigs, 7 },
 	{ "lsm_manager", "category",
@@ -666,65 +722,71 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "connection.async_new_op", "append=0,overwrite=,raw=0,timeout=1200", confchk_connection_async_new_op, 4},
 	{ "connection.close", "leak_memory=0", confchk_connection_close, 1 },
 	{ "connection.load_extension", "config=,entry=wiredtiger_extension_init,terminate=wiredtiger_extension_terminate", confchk_connection_load_extension, 3 },
-	{ "connection.open_session", "isolation=read-committed", confchk_connection_open_session, 1},
+	{ "connection.open_session", "cache_cursors=true,isolation=read-committed", confchk_connection_open_session, 2},
 	
 	{ "connection.reconfigure", "async=(enabled=0,ops_max=1024,threads=2),cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
 	"name=\"WiredTigerCheckpoint\",wait=0),error_prefix=,"
 	"eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	"eviction_target=80,eviction_trigger=95,"
+	"eviction_policy=lru,eviction_target=80,eviction_trigger=95,"
 	"file_manager=(close_idle_time=30,close_scan_interval=10),"
 	"lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,"
 	"shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
 	"statistics=none,statistics_log=(on_close=0,"
 	"path=\"WiredTigerStat.%d.%H\",sources=,"
-	"timestamp=\"%b %d %H:%M:%S\",wait=0),verbose=", confchk_connection_reconfigure, 16 },
+	"timestamp=\"%b %d %H:%M:%S\",wait=0),verbose=", confchk_connection_reconfigure, 17 },
 	
 	{ "cursor.close", "", NULL, 0},
 	{ "cursor.reconfigure", "append=0,overwrite=", confchk_cursor_reconfigure, 2 },
 	
 	{ "file.meta",
-	"allocation_size=4KB,app_metadata=,block_allocation=best,"
+	"adaptive_hash=0,allocation_size=4KB,app_metadata=,block_allocation=best,"
 	"block_compressor=,cache_resident=0,checkpoint=,checkpoint_lsn=,"
 	"checksum=uncompressed,collator=,columns=,dictionary=0,"
 	"format=btree,huffman_key=,huffman_value=,id=,internal_item_max=0"
-	",internal_key_max=0,internal_key_truncate=,internal_page_max=4KB"
+	",internal_key_max=0,internal_key_truncate=true,internal_page_max=4KB"
 	",key_format=u,key_gap=10,leaf_item_max=0,leaf_key_max=0,"
 	"leaf_page_max=32KB,leaf_value_max=0,memory_page_max=5MB,"
 	"os_cache_dirty_max=0,os_cache_max=0,prefix_compression=0,"
 	"prefix_compression_min=4,split_deepen_min_child=0,"
-	"split_deepen_per_child=0,split_pct=75,value_format=u,"
-	"version=(major=0,minor=0)",confchk_file_meta, 35},
+	"split_deepen_per_child=0,split_pct=75,subtree_counts=0,"
+	"value_format=u,version=(major=0,minor=0)",confchk_file_meta, 37},
 
-	{ "index.meta","app_metadata=,collator=,columns=,extractor=,immutable=0,"
-	"index_key_columns=,key_format=u,source=,type=file,value_format=u",confchk_index_meta, 10},
+	{ "index.meta","app_metadata=,collator=,columns=,extractor=,immutable=0,include=,"
+	"index_key_columns=,key_format=u,source=,type=file,value_format=u",confchk_index_meta, 11},
 	
 	{ "session.begin_transaction","isolation=,name=,priority=0,sync=",confchk_session_begin_transaction, 4},
 	{ "session.checkpoint","drop=,force=0,name=,target=",confchk_session_checkpoint, 4},
 	{ "session.close","", NULL, 0},
 	{ "session.commit_transaction", "", NULL, 0 },
 	{ "session.compact", "timeout=1200", confchk_session_compact, 1},
+	{ "session.count_range", "approximate=0", confchk_session_count_range, 1},
 	
-	{ "session.create", "allocation_size=4KB,app_metadata=,block_allocation=best,"
+	{ "session.create", "adaptive_hash=0,allocation_size=4KB,app_metadata=,block_allocation=best,"
 	"block_compressor=,cache_resident=0,checksum=uncompressed,"
 	"colgroups=,collator=,columns=,dictionary=0,exclusive=0,"
 	"extractor=,format=btree,huffman_key=,huffman_value=,immutable=0,"
-	"internal_item_max=0,internal_key_max=0,internal_key_truncate=,"
+	"include=,internal_item_max=0,internal_key_max=0,internal_key_truncate=true,"
 	"internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
 	"leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
 	"lsm=(auto_throttle=,bloom=,bloom_bit_count=16,bloom_config=,"
 	"bloom_hash_count=8,bloom_oldest=0,chunk_count_limit=0,"
-	"chunk_max=5GB,chunk_size=10MB,merge_max=15,merge_min=0),"
+	"chunk_max=5GB,chunk_size=10MB,merge_max=15,merge_min=0,"
+	"merge_policy=size,merge_ratio=10,merge_threads=1,"
+	"merge_window=3600),"
 	"memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
 	"prefix_compression=0,prefix_compression_min=4,source=,"
 	"split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
-	"type=file,value_format=u", confchk_session_create, 38},
+	"subtree_counts=0,type=file,value_format=u", confchk_session_create, 41},
 	
 	{ "session.drop", "force=0,remove_files=", confchk_session_drop, 2},
+	{ "session.dump", "", NULL, 0 },
+	{ "session.load", "bulk=true,create=true", confchk_session_load, 2 },
 	{ "session.log_printf", "", NULL, 0 },
-	{ "session.open_cursor","append=0,bulk=0,checkpoint=,dump=,next_random=0,overwrite=,raw=0"
-	",readonly=0,skip_sort_check=0,statistics=,target=",confchk_session_open_cursor, 11},
+	{ "session.open_cursor","append=0,bulk=0,checkpoint=,dump=,index_batch=0,next_random=0,next_random_sample=0,"
+	"overwrite=,raw=0,readonly=0,skip_sort_check=0,statistics=,target=",confchk_session_open_cursor, 13},
+	{ "session.position_rank", "approximate=0", confchk_session_position_rank, 1},
 
-	{ "session.reconfigure", "isolation=read-committed",confchk_session_reconfigure, 1},
+	{ "session.reconfigure", "cache_cursors=true,isolation=read-committed",confchk_session_reconfigure, 2},
 	{ "session.rename","",NULL, 0},
 	{ "session.rollback_transaction","",NULL, 0},
 	{ "session.salvage", "force=0", confchk_session_salvage, 1},
@@ -736,13 +798,13 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	
 	{ "wiredtiger_open",
 	"async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	"cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	"cache_huge_pages=0,cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
 	"name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
 	"config_base=,create=0,direct_io=,error_prefix=,"
 	"eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	"eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
+	"eviction_policy=lru,eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
 	"file_extend=,file_manager=(close_idle_time=30,"
-	"close_scan_interval=10),hazard_max=1000,log=(archive=,"
+	"close_scan_interval=10),hazard_epoch=0,hazard_max=1000,log=(archive=,"
 	"compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
 	",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
 	"multiprocess=0,session_max=100,session_scratch_max=2MB,"
@@ -751,17 +813,17 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	"path=\"WiredTigerStat.%d.%H\",sources=,"
 	"timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	",method=fsync),use_environment_priv=0,verbose=",
-	confchk_wiredtiger_open, 32},
+	confchk_wiredtiger_open, 35},
 
 	{ "wiredtiger_open_all",
 	"async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	"cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	"cache_huge_pages=0,cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
 	"name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
 	"config_base=,create=0,direct_io=,error_prefix=,"
 	"eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	"eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
+	"eviction_policy=lru,eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
 	"file_extend=,file_manager=(close_idle_time=30,"
-	"close_scan_interval=10),hazard_max=1000,log=(archive=,"
+	"close_scan_interval=10),hazard_epoch=0,hazard_max=1000,log=(archive=,"
 	"compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
 	",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
 	"multiprocess=0,session_max=100,session_scratch_max=2MB,"
@@ -770,16 +832,16 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	"path=\"WiredTigerStat.%d.%H\",sources=,"
 	"timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	",method=fsync),use_environment_priv=0,verbose=,version=(major=0,"
-	"minor=0)",confchk_wiredtiger_open_all, 33},
+	"minor=0)",confchk_wiredtiger_open_all, 36},
 
 	{ "wiredtiger_open_basecfg",
 	"async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	"cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	"cache_huge_pages=0,cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
 	"name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
 	"direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
-	"eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
+	"eviction_dirty_target=80,eviction_policy=lru,eviction_target=80,eviction_trigger=95,"
 	"extensions=,file_extend=,file_manager=(close_idle_time=30,"
-	"close_scan_interval=10),hazard_max=1000,log=(archive=,"
+	"close_scan_interval=10),hazard_epoch=0,hazard_max=1000,log=(archive=,"
 	"compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
 	",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
 	"multiprocess=0,session_max=100,session_scratch_max=2MB,"
@@ -788,16 +850,16 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	"path=\"WiredTigerStat.%d.%H\",sources=,"
 	"timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	",method=fsync),verbose=,version=(major=0,minor=0)",
-	confchk_wiredtiger_open_basecfg, 29},
+	confchk_wiredtiger_open_basecfg, 32},
 
 	{ "wiredtiger_open_usercfg",
 	"async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	"cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	"cache_huge_pages=0,cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
 	"name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
 	"direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
-	"eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
+	"eviction_dirty_target=80,eviction_policy=lru,eviction_target=80,eviction_trigger=95,"
 	"extensions=,file_extend=,file_manager=(close_idle_time=30,"
-	"close_scan_interval=10),hazard_max=1000,log=(archive=,"
+	"close_scan_interval=10),hazard_epoch=0,hazard_max=1000,log=(archive=,"
 	"compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
 	",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
 	"multiprocess=0,session_max=100,session_scratch_max=2MB,"
@@ -806,7 +868,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	"path=\"WiredTigerStat.%d.%H\",sources=,"
 	"timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	",method=fsync),verbose=",
-	confchk_wiredtiger_open_usercfg, 28},
+	confchk_wiredtiger_open_usercfg, 31},
 
 	{ NULL, NULL, NULL, 0 }
 };
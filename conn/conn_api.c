@@ -596,6 +596,21 @@ static const char* __conn_get_home(WT_CONNECTION* wt_conn)
 	return (((WT_CONNECTION_IMPL*)wt_conn)->home);
 }
 
+/*Ϊmethodһַconnection*/
+static int __conn_compile_configuration(WT_CONNECTION* wt_conn, const char* method, const char* config, const char** compiledp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	CONNECTION_API_CALL_NOCONF(conn, session, compile_configuration);
+
+	ret = __wt_config_compile(session, method, config, compiledp);
+err:
+	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
 /*methodϢ*/
 static int __conn_configure_method(WT_CONNECTION* wt_conn, const char* method, const char* uri, const char* config, const char* type, const char* check)
 {
@@ -1257,7 +1272,8 @@ int __wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const c
 		__conn_add_collator,
 		__conn_add_compressor,
 		__conn_add_extractor,
-		__conn_get_extension_api
+		__conn_get_extension_api,
+		__conn_compile_configuration
 	};
 
 	static const WT_NAME_FLAG file_types[] = {
@@ -1352,6 +1368,8 @@ int __wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const c
 	/*ȷhazard pointerеĳ*/
 	WT_ERR(__wt_config_gets(session, cfg, "hazard_max", &cval));
 	conn->hazard_max = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "hazard_epoch", &cval));
+	conn->hazard_epoch = cval.val != 0;
 	/*ȷsession slot*/
 	WT_ERR(__wt_config_gets(session, cfg, "session_max", &cval));
 	conn->session_size = (uint32_t)cval.val + WT_NUM_INTERNAL_SESSIONS;
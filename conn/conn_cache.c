@@ -30,6 +30,9 @@ static int __cache_config_local(WT_SESSION_IMPL* session, int shared, const char
 	WT_RET(__wt_config_gets(session, cfg, "eviction_dirty_target", &cval));
 	cache->eviction_dirty_target = (u_int)cval.val;
 
+	WT_RET(__wt_config_gets(session, cfg, "eviction_policy", &cval));
+	cache->evict_policy = WT_STRING_MATCH("2q", cval.str, cval.len) ? WT_EVICT_POLICY_2Q : WT_EVICT_POLICY_LRU;
+
 	WT_RET(__wt_config_gets(session, cfg, "eviction.threads_max", &cval));
 	WT_ASSERT(session, cval.val > 0);
 	evict_workers_max = (uint32_t)cval.val - 1;
@@ -114,6 +117,9 @@ int __wt_cache_create(WT_SESSION_IMPL* session, const char* cfg[])
 	cache->evict_slots = WT_EVICT_WALK_BASE + WT_EVICT_WALK_INCR;
 	WT_ERR(__wt_calloc_def(session, cache->evict_slots, &cache->evict));
 
+	/*huge pageڴṩ*/
+	WT_ERR(__wt_cache_mem_create(session, cfg));
+
 	/*ʼcache statͳģ*/
 	__wt_cache_stats_update(session);
 	return 0;
@@ -147,6 +153,8 @@ void __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_STAT_SET(stats, cache_bytes_internal, cache->bytes_internal);
 	WT_STAT_SET(stats, cache_bytes_leaf, conn->cache_size - (cache->bytes_internal + cache->bytes_overflow));
 	WT_STAT_SET(stats, cache_bytes_overflow, cache->bytes_overflow);
+
+	__wt_cache_mem_stats_update(session);
 }
 
 /*һconnection evict cache*/
@@ -167,6 +175,8 @@ int __wt_cache_destroy(WT_SESSION_IMPL *session)
 	__wt_spin_destroy(session, &cache->evict_lock);
 	__wt_spin_destroy(session, &cache->evict_walk_lock);
 
+	WT_TRET(__wt_cache_mem_destroy(session));
+
 	__wt_free(session, cache->evict);
 	__wt_free(session, conn->cache);
 	return ret;
@@ -0,0 +1,383 @@
+/***************************************************************************
+*cachehuge pageڴṩ, slab size class2MBregionзpageṹpage image
+***************************************************************************/
+
+#include "wt_internal.h"
+
+/*memдһchunkСsize class,Сsize classĲұ*/
+static void __cache_mem_class_add(WT_SESSION_IMPL* session, WT_CACHE_MEM* mem, size_t chunk)
+{
+	WT_CACHE_SLAB *slab;
+	size_t slot, first;
+	u_int i;
+
+	slab = &mem->slab[mem->nslab];
+	slab->chunk = chunk;
+	slab->nchunks = (uint32_t)(WT_CACHE_MEM_REGION / chunk);
+	TAILQ_INIT(&slab->partialqh);
+	(void)__wt_spin_init(session, &slab->lock, "cache slab");
+
+	/*ҵchunkСsize class, ֮chunk֮µclass*/
+	first = 0;
+	for (i = 0; i < mem->nslab; ++i)
+		if (mem->slab[i].chunk < chunk && mem->slab[i].chunk > first)
+			first = mem->slab[i].chunk;
+
+	/*ȷsize class, ޸Ĳұ, ĲֻῴɵĻµĺϷclass*/
+	WT_PUBLISH(mem->nslab, mem->nslab + 1);
+	for (slot = first / WT_CACHE_MEM_MIN; slot <= WT_CACHE_MEM_MAP_SLOT(chunk); ++slot)
+		mem->map[slot] = (uint8_t)(slab - mem->slab);
+}
+
+/*Ϊһslab size classһregion, ȸñͷŵregion, region_lock*/
+static WT_CACHE_REGION* __cache_mem_region_get(WT_SESSION_IMPL* session, WT_CACHE_MEM* mem, WT_CACHE_SLAB* slab)
+{
+	WT_CACHE_REGION *region;
+
+	__wt_spin_lock(session, &mem->region_lock);
+	if ((region = TAILQ_FIRST(&mem->freeqh)) != NULL)
+		TAILQ_REMOVE(&mem->freeqh, region, q);
+	else if (mem->next_region < mem->nregions)
+		region = &mem->regions[mem->next_region++];
+	if (region != NULL)
+		++mem->regions_inuse;
+	__wt_spin_unlock(session, &mem->region_lock);
+
+	if (region == NULL)
+		return (NULL);
+
+	region->slab = slab;
+	region->free = NULL;
+	region->next = 0;
+	region->inuse = 0;
+	region->onlist = 0;
+	++slab->regions;
+
+	return (region);
+}
+
+/*һеregionarena, size classʹ*/
+static void __cache_mem_region_put(WT_SESSION_IMPL* session, WT_CACHE_MEM* mem, WT_CACHE_REGION* region)
+{
+	--region->slab->regions;
+	region->slab = NULL;
+
+	__wt_spin_lock(session, &mem->region_lock);
+	TAILQ_INSERT_HEAD(&mem->freeqh, region, q);
+	--mem->regions_inuse;
+	__wt_spin_unlock(session, &mem->region_lock);
+}
+
+/*slabзһchunk, arenaʱNULL*/
+static void* __cache_mem_slab_alloc(WT_SESSION_IMPL* session, WT_CACHE_MEM* mem, WT_CACHE_SLAB* slab)
+{
+	WT_CACHE_REGION *region;
+	uint8_t *p;
+
+	__wt_spin_lock(session, &slab->lock);
+
+	if ((region = TAILQ_FIRST(&slab->partialqh)) == NULL) {
+		if ((region = __cache_mem_region_get(session, mem, slab)) == NULL) {
+			__wt_spin_unlock(session, &slab->lock);
+			return (NULL);
+		}
+		TAILQ_INSERT_HEAD(&slab->partialqh, region, q);
+		region->onlist = 1;
+	}
+
+	/*ʹͷŹchunk, ûоʹregionлδʹùĲз*/
+	if ((p = region->free) != NULL)
+		region->free = *(void **)p;
+	else {
+		p = mem->base + (size_t)(region - mem->regions) * WT_CACHE_MEM_REGION + region->next;
+		region->next += (uint32_t)slab->chunk;
+	}
+
+	/*regionѾ, partial listƳ*/
+	if (++region->inuse == slab->nchunks) {
+		TAILQ_REMOVE(&slab->partialqh, region, q);
+		region->onlist = 0;
+	}
+
+	__wt_spin_unlock(session, &slab->lock);
+
+	(void)WT_ATOMIC_ADD8(mem->bytes_slab, slab->chunk);
+	return (p);
+}
+
+/*ҵsizeСslab size class, slabʱNULL*/
+static inline WT_CACHE_SLAB* __cache_mem_class(WT_CACHE_MEM* mem, size_t size)
+{
+	WT_CACHE_SLAB *slab;
+
+	if (size == 0 || size > WT_CACHE_MEM_CHUNK_MAX)
+		return (NULL);
+
+	slab = &mem->slab[mem->map[WT_CACHE_MEM_MAP_SLOT(size)]];
+	return (slab->chunk >= size ? slab : NULL);
+}
+
+/*һslabʵʵĴС, Ҫbuffer_alignmentȡ, ֤chunkĵַҲǶ*/
+static inline size_t __cache_mem_request(WT_SESSION_IMPL* session, size_t size, int aligned)
+{
+	if (aligned && S2C(session)->buffer_alignment > 0)
+		return ((size_t)WT_ALIGN(size, S2C(session)->buffer_alignment));
+	return (size);
+}
+
+/*cachehuge pageڴṩ, wiredtiger_opencache_huge_pagesô*/
+int __wt_cache_mem_create(WT_SESSION_IMPL* session, const char* cfg[])
+{
+	WT_CACHE *cache;
+	WT_CACHE_MEM *mem;
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	size_t chunk, len;
+	void *map;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	WT_RET(__wt_config_gets(session, cfg, "cache_huge_pages", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	/*cache poolcacheСǶ̬, arenaûԤȷС*/
+	if (conn->cache_size == 0)
+		return (__wt_verbose(session, WT_VERB_SHARED_CACHE, "cache_huge_pages ignored: the cache size is managed by a shared cache"));
+
+	/*arenacache_sizeԤ1/4, slabڲƬ*/
+	len = (size_t)WT_ALIGN(conn->cache_size + conn->cache_size / 4, WT_CACHE_MEM_REGION);
+
+	WT_RET(__wt_calloc_one(session, &mem));
+	WT_ERR(__wt_calloc_def(session, WT_CACHE_MEM_MAP_SLOTS, &mem->map));
+	WT_ERR(__wt_calloc_def(session, len / WT_CACHE_MEM_REGION, &mem->regions));
+	mem->nregions = (uint32_t)(len / WT_CACHE_MEM_REGION);
+	TAILQ_INIT(&mem->freeqh);
+	WT_ERR(__wt_spin_init(session, &mem->region_lock, "cache region"));
+
+	/*page sizeעclassbuffer_alignment, ٰ4KB*/
+	mem->align = WT_MAX(conn->buffer_alignment, 4 * WT_KILOBYTE);
+
+	/*2Nηsize class, WT_PAGEṹWT_ROW/WT_COLԼСpage imageЩclass*/
+	for (chunk = WT_CACHE_MEM_MIN; chunk <= WT_CACHE_MEM_POW2_MAX; chunk <<= 1)
+		__cache_mem_class_add(session, mem, chunk);
+
+	WT_ERR(__wt_mmap_huge(session, len, WT_CACHE_MEM_REGION, &map, &mem->huge));
+	mem->base = map;
+	mem->len = len;
+
+	/*Ժ__wt_free/__wt_reallocʶarenaеָ*/
+	WT_PUBLISH(cache->mem, mem);
+
+	return (__wt_verbose(session, WT_VERB_EVICTSERVER,
+	    "cache memory: %" WT_SIZET_FMT " bytes in %" PRIu32 " %s regions", len, mem->nregions, mem->huge ? "huge-page" : "transparent huge-page"));
+
+err:
+	__wt_free(session, mem->regions);
+	__wt_free(session, mem->map);
+	__wt_free(session, mem);
+	return (ret);
+}
+
+/*huge pageڴṩ, еpageѾͷ*/
+int __wt_cache_mem_destroy(WT_SESSION_IMPL* session)
+{
+	WT_CACHE *cache;
+	WT_CACHE_MEM *mem;
+	WT_DECL_RET;
+	u_int i;
+
+	cache = S2C(session)->cache;
+	if ((mem = cache->mem) == NULL)
+		return (0);
+
+	cache->mem = NULL;
+	WT_FULL_BARRIER();
+
+	WT_TRET(__wt_munmap_huge(session, mem->base, mem->len));
+
+	for (i = 0; i < mem->nslab; ++i)
+		__wt_spin_destroy(session, &mem->slab[i].lock);
+	__wt_spin_destroy(session, &mem->region_lock);
+
+	__wt_free(session, mem->regions);
+	__wt_free(session, mem->map);
+	__wt_free(session, mem);
+
+	return (ret);
+}
+
+/*btreeʱעinternal_page_max/leaf_page_max, Ϊ2Nηpage sizeȷСsize class*/
+int __wt_cache_mem_register(WT_SESSION_IMPL* session, size_t size)
+{
+	WT_CACHE_MEM *mem;
+	size_t chunk;
+	u_int i;
+	int full;
+
+	if ((mem = S2C(session)->cache->mem) == NULL)
+		return (0);
+
+	chunk = (size_t)WT_ALIGN(size, mem->align);
+	if (chunk <= WT_CACHE_MEM_POW2_MAX || chunk > WT_CACHE_MEM_CHUNK_MAX)
+		return (0);
+
+	full = 0;
+	__wt_spin_lock(session, &mem->region_lock);
+	for (i = 0; i < mem->nslab; ++i)
+		if (mem->slab[i].chunk == chunk)
+			break;
+	if (i == mem->nslab) {
+		if (mem->nslab < WT_CACHE_MEM_CLASSES)
+			__cache_mem_class_add(session, mem, chunk);
+		else
+			full = 1;
+	}
+	__wt_spin_unlock(session, &mem->region_lock);
+
+	/*size class, Сpageɸclassmallocṩ*/
+	if (full)
+		WT_RET(__wt_verbose(session, WT_VERB_EVICTSERVER,
+		    "cache memory: no slab size class left for %" WT_SIZET_FMT " byte pages", chunk));
+
+	return (0);
+}
+
+/*cacheڴзnumber * sizeڴ, huge pageڴṩûû߷䲻ʱ˻ص__wt_calloc*/
+int __wt_cache_mem_calloc(WT_SESSION_IMPL* session, size_t number, size_t size, void* retp)
+{
+	WT_CACHE_MEM *mem;
+	WT_CACHE_SLAB *slab;
+	void *p;
+
+	WT_ASSERT(session, number != 0 && size != 0);
+
+	if ((mem = S2C(session)->cache->mem) == NULL || (slab = __cache_mem_class(mem, number * size)) == NULL)
+		return (__wt_calloc(session, number, size, retp));
+
+	if ((p = __cache_mem_slab_alloc(session, mem, slab)) == NULL) {
+		(void)WT_ATOMIC_ADD8(mem->fallback, 1);
+		return (__wt_calloc(session, number, size, retp));
+	}
+
+	WT_STAT_FAST_CONN_INCR(session, memory_allocation);
+	memset(p, 0, number * size);
+
+	*(void **)retp = p;
+	return (0);
+}
+
+/*
+ * __wt_cache_mem_realloc --
+ *	Grow a buffer in cache memory, the reported allocation size is the
+ * requested size, not the chunk size, so page accounting that uses it stays
+ * exact.  Also used by __wt_realloc for pointers that live in the arena.
+ */
+int __wt_cache_mem_realloc(WT_SESSION_IMPL* session, size_t* bytes_allocated_ret, size_t bytes_to_allocate, int aligned, void* retp)
+{
+	WT_CACHE_MEM *mem;
+	WT_CACHE_SLAB *slab;
+	size_t bytes_allocated, request;
+	void *p, *newp;
+
+	p = *(void **)retp;
+	bytes_allocated = (bytes_allocated_ret == NULL) ? 0 : *bytes_allocated_ret;
+
+	WT_ASSERT(session, bytes_to_allocate != 0);
+	WT_ASSERT(session, bytes_allocated < bytes_to_allocate);
+
+	mem = S2C(session)->cache->mem;
+	request = __cache_mem_request(session, bytes_to_allocate, aligned);
+
+	/*chunk㹻, ԭչ*/
+	if (p != NULL && __wt_cache_mem_owns(session, p) && __wt_cache_mem_chunk(mem, p) >= request) {
+		memset((uint8_t *)p + bytes_allocated, 0, bytes_to_allocate - bytes_allocated);
+		if (bytes_allocated_ret != NULL)
+			*bytes_allocated_ret = bytes_to_allocate;
+		return (0);
+	}
+
+	newp = NULL;
+	if (mem != NULL && (slab = __cache_mem_class(mem, request)) != NULL &&
+	    (newp = __cache_mem_slab_alloc(session, mem, slab)) == NULL)
+		(void)WT_ATOMIC_ADD8(mem->fallback, 1);
+
+	/*slab䲻, ˻صͨڴ*/
+	if (newp == NULL) {
+		if (aligned && S2C(session)->buffer_alignment > 0) {
+			if (posix_memalign(&newp, S2C(session)->buffer_alignment, request) != 0)
+				WT_RET_MSG(session, ENOMEM, "memory allocation");
+		}
+		else if ((newp = malloc(request)) == NULL)
+			WT_RET_MSG(session, __wt_errno(), "memory allocation");
+	}
+
+	if (p == NULL)
+		WT_STAT_FAST_CONN_INCR(session, memory_allocation);
+	else
+		WT_STAT_FAST_CONN_INCR(session, memory_grow);
+
+	if (p != NULL)
+		memcpy(newp, p, bytes_allocated);
+	memset((uint8_t *)newp + bytes_allocated, 0, bytes_to_allocate - bytes_allocated);
+	__wt_free(session, p);
+
+	if (bytes_allocated_ret != NULL)
+		*bytes_allocated_ret = bytes_to_allocate;
+
+	*(void **)retp = newp;
+	return (0);
+}
+
+/*arenaеһchunkڵslab, Ѿȷparena*/
+void __wt_cache_mem_free(WT_SESSION_IMPL* session, void* p)
+{
+	WT_CACHE_MEM *mem;
+	WT_CACHE_REGION *region;
+	WT_CACHE_SLAB *slab;
+
+	mem = S2C(session)->cache->mem;
+	region = &mem->regions[WT_PTRDIFF(p, mem->base) / WT_CACHE_MEM_REGION];
+	slab = region->slab;
+
+	WT_ASSERT(session, slab != NULL && region->inuse != 0);
+
+	__wt_spin_lock(session, &slab->lock);
+
+	*(void **)p = region->free;
+	region->free = p;
+
+	/*region˿chunk, partial list*/
+	if (!region->onlist) {
+		TAILQ_INSERT_TAIL(&slab->partialqh, region, q);
+		region->onlist = 1;
+	}
+
+	/*regionȫղslabлõregion, arenasize classʹ*/
+	if (--region->inuse == 0 && TAILQ_FIRST(&slab->partialqh) != TAILQ_LAST(&slab->partialqh, __wt_slab_partial_qh)) {
+		TAILQ_REMOVE(&slab->partialqh, region, q);
+		region->onlist = 0;
+		__cache_mem_region_put(session, mem, region);
+	}
+
+	__wt_spin_unlock(session, &slab->lock);
+
+	(void)WT_ATOMIC_SUB8(mem->bytes_slab, slab->chunk);
+}
+
+/*huge pageڴṩߵͳϢ*/
+void __wt_cache_mem_stats_update(WT_SESSION_IMPL* session)
+{
+	WT_CACHE_MEM *mem;
+	WT_CONNECTION_STATS *stats;
+
+	stats = &S2C(session)->stats;
+	if ((mem = S2C(session)->cache->mem) == NULL)
+		return;
+
+	WT_STAT_SET(stats, cache_mem_regions, mem->regions_inuse);
+	WT_STAT_SET(stats, cache_mem_slab_bytes, mem->bytes_slab);
+	WT_STAT_SET(stats, cache_mem_fallback, mem->fallback);
+}
@@ -83,6 +83,13 @@ static int __conn_dhandle_open_lock(WT_SESSION_IMPL* session, WT_DATA_HANDLE* dh
 	}
 }
 
+/*жdhandlenamecheckpoint nameǷƥ*/
+static inline int __conn_dhandle_match(WT_DATA_HANDLE* dhandle, const char* name, const char* ckpt)
+{
+	return (strcmp(name, dhandle->name) == 0 && ((ckpt == NULL && dhandle->checkpoint == NULL) ||
+		(ckpt != NULL && dhandle->checkpoint != NULL && strcmp(ckpt, dhandle->checkpoint) == 0)));
+}
+
 /*ͨdhandle namecheckpoint nameҶӦdhandle,õsession*/
 int __wt_conn_dhandle_find(WT_SESSION_IMPL* session, const char* name, const char* ckpt, uint32_t flags)
 {
@@ -99,8 +106,7 @@ int __wt_conn_dhandle_find(WT_SESSION_IMPL* session, const char* name, const cha
 	/* Increment the reference count if we already have the btree open. */
 	bucket = __wt_hash_city64(name, strlen(name)) % WT_HASH_ARRAY_SIZE;
 	SLIST_FOREACH(dhandle, &conn->dhhash[bucket], hashl)
-		if (strcmp(name, dhandle->name) == 0 && ((ckpt == NULL && dhandle->checkpoint == NULL) ||
-			(ckpt != NULL && dhandle->checkpoint != NULL && strcmp(ckpt, dhandle->checkpoint) == 0))) {
+		if (__conn_dhandle_match(dhandle, name, ckpt)) {
 				session->dhandle = dhandle;
 				return 0;
 		}
@@ -108,6 +114,75 @@ int __wt_conn_dhandle_find(WT_SESSION_IMPL* session, const char* name, const cha
 	return WT_NOTFOUND;
 }
 
+/*
+ * __wt_conn_dhandle_find_ref --
+ *	Search the connection's handle hash without the handle list lock and
+ * take a session reference on the handle found, the reference keeps the
+ * handle from being discarded once we leave the lookup.  Handles removed from
+ * the hash are only freed after every lookup that might see them has left,
+ * see __conn_dhandle_gen_wait.
+ */
+int __wt_conn_dhandle_find_ref(WT_SESSION_IMPL* session, const char* name, const char* ckpt, uint64_t hash)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	uint32_t ref;
+
+	conn = S2C(session);
+	ret = WT_NOTFOUND;
+
+	/*sessionlookup generation, split_gen÷һ*/
+	session->dhandle_gen = conn->dhandle_gen;
+	WT_FULL_BARRIER();
+
+	for (dhandle = SLIST_FIRST(&conn->dhhash[hash % WT_HASH_ARRAY_SIZE]); dhandle != NULL; dhandle = SLIST_NEXT(dhandle, hashl)) {
+		if (dhandle->name_hash != hash || !__conn_dhandle_match(dhandle, name, ckpt))
+			continue;
+
+		/*ڱɾdhandleã·*/
+		for (;;) {
+			WT_ORDERED_READ(ref, dhandle->session_ref);
+			if (ref == WT_DHANDLE_REF_DEAD)
+				break;
+			if (WT_ATOMIC_CAS4(dhandle->session_ref, ref, ref + 1)) {
+				session->dhandle = dhandle;
+				ret = 0;
+				break;
+			}
+		}
+		break;
+	}
+
+	WT_PUBLISH(session->dhandle_gen, 0);
+	return ret;
+}
+
+/*
+ * __conn_dhandle_gen_wait --
+ *	Wait for the lookups that might have seen a handle we just removed from
+ * the hash to finish.  Lookups don't block, the wait is short.
+ */
+static void __conn_dhandle_gen_wait(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *s;
+	uint64_t gen, sgen;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+	gen = WT_ATOMIC_ADD8(conn->dhandle_gen, 1);
+
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = 0, s = conn->sessions; i < session_cnt; i++, s++)
+		for (;;) {
+			WT_ORDERED_READ(sgen, s->dhandle_gen);
+			if (sgen == 0 || sgen >= gen)
+				break;
+			__wt_yield();
+		}
+}
+
 /*namecheckpoint namedhandle,öӦlock*/
 static __conn_dhandle_get(WT_SESSION_IMPL *session, const char *name, const char *ckpt, uint32_t flags)
 {
@@ -311,6 +386,8 @@ static int __conn_btree_open(WT_SESSION_IMPL* session, const char* cfg[], uint32
 	do{
 		WT_ERR(__wt_btree_open(session, cfg));
 		F_SET(dhandle, WT_DHANDLE_OPEN);
+		/*cursorͨopen_genжhandleǷ´򿪹*/
+		++dhandle->open_gen;
 
 		if (dhandle->checkpoint == NULL)
 			++S2C(session)->open_btree_count;
@@ -546,8 +623,12 @@ static int __conn_dhandle_remove(WT_SESSION_IMPL* session, int final)
 
 	WT_ASSERT(session, F_ISSET(session, WT_SESSION_HANDLE_LIST_LOCKED));
 
-	/* Check if the handle was reacquired by a session while we waited. */
-	if (!final && (dhandle->session_inuse != 0 || dhandle->session_ref != 0))
+	/*
+	 * Check if the handle was reacquired by a session while we waited.
+	 * Lookups without the handle list lock take references with a CAS,
+	 * marking the reference count dead makes them fail from here on.
+	 */
+	if (!final && (dhandle->session_inuse != 0 || !WT_ATOMIC_CAS4(dhandle->session_ref, 0, WT_DHANDLE_REF_DEAD)))
 		return (EBUSY);
 
 	WT_CONN_DHANDLE_REMOVE(conn, dhandle, bucket);
@@ -587,6 +668,10 @@ int __wt_conn_dhandle_discard_single(WT_SESSION_IMPL *session, int final)
 	*/
 
 	if (ret == 0 || final) {
+		/*ȴܿdhandleҽ*/
+		if (!final)
+			__conn_dhandle_gen_wait(session);
+
 		WT_TRET(__wt_rwlock_destroy(session, &dhandle->rwlock));
 		__wt_free(session, dhandle->name);
 		__wt_free(session, dhandle->checkpoint);
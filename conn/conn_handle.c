@@ -37,9 +37,11 @@ int __wt_connection_init(WT_CONNECTION_IMPL* conn)
 	/* Locks. */
 	WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
 	WT_RET(__wt_spin_init(session, &conn->checkpoint_lock, "checkpoint"));
+	WT_RET(__wt_spin_init(session, &conn->config_cache_lock, "configuration cache"));
 	WT_RET(__wt_spin_init(session, &conn->dhandle_lock, "data handle"));
 	WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
 	WT_RET(__wt_spin_init(session, &conn->hot_backup_lock, "hot backup"));
+	WT_RET(__wt_spin_init(session, &conn->hs_lock, "history store"));
 	WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
 	WT_RET(__wt_spin_init(session, &conn->schema_lock, "schema"));
 	WT_RET(__wt_spin_init(session, &conn->table_lock, "table creation"));
@@ -62,6 +64,9 @@ int __wt_connection_init(WT_CONNECTION_IMPL* conn)
 	* first split has happened, and threads that are not in a tree.
 	*/
 	conn->split_gen = 1;
+	/*hazard epochsplit generationһ1ʼ0ʾsessionepoch*/
+	conn->hazard_gen = 1;
+	conn->dhandle_gen = 1;
 
 	/*
 	* Block manager.
@@ -102,6 +107,7 @@ int __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_spin_unlock(session, &__wt_process.spinlock);
 
 	/* Configuration */
+	__wt_config_compiled_discard(session);	/* compiled configurations */
 	__wt_conn_config_discard(session);		/* configuration */
 
 	__wt_conn_foc_discard(session);			/* free-on-close */
@@ -109,9 +115,11 @@ int __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_spin_destroy(session, &conn->api_lock);
 	__wt_spin_destroy(session, &conn->block_lock);
 	__wt_spin_destroy(session, &conn->checkpoint_lock);
+	__wt_spin_destroy(session, &conn->config_cache_lock);
 	__wt_spin_destroy(session, &conn->dhandle_lock);
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_spin_destroy(session, &conn->hot_backup_lock);
+	__wt_spin_destroy(session, &conn->hs_lock);
 	__wt_spin_destroy(session, &conn->reconfig_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
 	__wt_spin_destroy(session, &conn->table_lock);
@@ -0,0 +1,445 @@
+/***************************************************************************
+*history storḙpageʱе񻹿ܶľɰ汾дһڲı
+*ʱеĶ񲻻cache޸Ĺpage޷̭
+***************************************************************************/
+
+#include "wt_internal.h"
+
+/*
+ * The history store is a file keyed by (btree ID, key, sequence), the value
+ * is the ID of the transaction that replaced the version, a flag for a key
+ * that didn't exist, and the version's value.
+ *
+ * Eviction writes the newest committed version of a key to the page and the
+ * versions it replaced to the history store, sequence order is version order.
+ * Going from the newest version to older ones, a reader reads the first
+ * version whose replacing transaction it can see the version before: that is
+ * the version following the last record replaced by a transaction the reader
+ * can see, or the page's version if the last record is one of those.
+ *
+ * Records are discarded by the sweep server once the transaction that
+ * replaced the version is visible to everyone, oldest first: no reader goes
+ * past such a record, the older records of the key are never read.
+ *
+ * Records are written without a transaction and are visible to every reader
+ * as soon as they're written.  Eviction and the sweep share the connection's
+ * cursor under the history store lock, readers search through a cursor of
+ * their own session and don't wait for eviction or for each other.
+ */
+#define	WT_HS_FORMAT		"key_format=IuQ,value_format=QBu"
+
+/*sweepÿγcursorļ¼*/
+#define	WT_HS_SWEEP_BATCH	100
+
+/*
+ * __wt_hs_create --
+ *	Create the history store and open its cursor.
+ */
+int __wt_hs_create(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *hs_session;
+	const char *drop_cfg[] = { WT_CONFIG_BASE(session, session_drop), "force", NULL };
+
+	conn = S2C(session);
+
+	WT_RET(__wt_rwlock_alloc(session, &conn->hs_ckpt_lock, "history store"));
+
+	/*history storeеİ汾ֻе壬ϴµı*/
+	WT_WITH_SCHEMA_LOCK(session, ret = __wt_schema_drop(session, WT_HS_URI, drop_cfg));
+	WT_RET(ret);
+	WT_WITH_SCHEMA_LOCK(session, ret = __wt_schema_create(session, WT_HS_URI, WT_HS_FORMAT));
+	WT_RET(ret);
+
+	WT_RET(__wt_open_internal_session(conn, "history-store", 1, 1, &conn->hs_session));
+	hs_session = conn->hs_session;
+
+	/*
+	 * The history store is written during eviction: its session never
+	 * evicts pages, logs, or allocates transaction IDs, records are visible
+	 * to everyone as soon as they're written.
+	 */
+	F_SET(hs_session, WT_SESSION_NO_CACHE_CHECK | WT_SESSION_NO_LOGGING | WT_SESSION_NO_TXN);
+	hs_session->isolation = hs_session->txn.isolation = TXN_ISO_READ_UNCOMMITTED;
+
+	WT_RET(__wt_open_cursor(hs_session, WT_HS_URI, NULL, NULL, &conn->hs_cursor));
+	conn->hs_fileid = ((WT_CURSOR_BTREE *)conn->hs_cursor)->btree->id;
+	conn->hs_seq = 0;
+	conn->hs_max_txn = WT_TXN_NONE;
+	conn->hs_open = 1;
+
+	return 0;
+}
+
+/*
+ * __wt_hs_destroy --
+ *	Close the history store, waiting for evictions using it to finish.
+ */
+int __wt_hs_destroy(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+
+	conn = S2C(session);
+	if (conn->hs_ckpt_lock == NULL)
+		return 0;
+
+	WT_TRET(__wt_writelock(session, conn->hs_ckpt_lock));
+	conn->hs_open = 0;
+	WT_TRET(__wt_writeunlock(session, conn->hs_ckpt_lock));
+
+	/*sessionرʱѾرǵcursor*/
+	WT_TRET(__wt_hs_cursor_close(session));
+
+	__wt_spin_lock(session, &conn->hs_lock);
+	conn->hs_cursor = NULL;
+	__wt_spin_unlock(session, &conn->hs_lock);
+
+	/*رsessionͬʱرcursor*/
+	if (conn->hs_session != NULL) {
+		wt_session = &conn->hs_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		conn->hs_session = NULL;
+	}
+
+	__wt_buf_free(session, &conn->hs_sweep_key);
+	WT_TRET(__wt_rwlock_destroy(session, &conn->hs_ckpt_lock));
+
+	return ret;
+}
+
+/*
+ * __hs_cursor --
+ *	Return the session's history store cursor, opening it the first time
+ * the session reads the store.  *cursorp is NULL once the store is closed.
+ */
+static int __hs_cursor(WT_SESSION_IMPL* session, WT_CURSOR** cursorp)
+{
+	WT_DECL_RET;
+
+	*cursorp = NULL;
+	if (!S2C(session)->hs_open)
+		return 0;
+
+	/*cursorлsessiondhandle߻ʹ*/
+	if (session->hs_cursor == NULL) {
+		WT_SAVE_DHANDLE(session, ret = __wt_open_cursor(session, WT_HS_URI, NULL, NULL, &session->hs_cursor));
+		WT_RET(ret);
+	}
+
+	*cursorp = session->hs_cursor;
+	return 0;
+}
+
+/*
+ * __wt_hs_cursor_close --
+ *	Close the session's history store cursor.
+ */
+int __wt_hs_cursor_close(WT_SESSION_IMPL* session)
+{
+	WT_CURSOR *cursor;
+
+	if ((cursor = session->hs_cursor) == NULL)
+		return 0;
+
+	session->hs_cursor = NULL;
+	return (cursor->close(cursor));
+}
+
+/*
+ * __wt_hs_evict_begin --
+ *	Check if an eviction can write versions to the history store, returning
+ * in *resolvedp a transaction ID all updates before which are committed or
+ * rolled back.  Checkpoints don't start until __wt_hs_evict_end is called:
+ * a page written with versions a checkpoint can't see must never become part
+ * of that checkpoint.
+ */
+int __wt_hs_evict_begin(WT_SESSION_IMPL* session, int* lockedp, uint64_t* resolvedp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *s;
+	uint64_t id, resolved;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+	txn_global = &conn->txn_global;
+	*lockedp = 0;
+
+	if (!conn->hs_open || __wt_try_readlock(session, conn->hs_ckpt_lock) != 0)
+		return 0;
+	if (!conn->hs_open || txn_global->checkpoint_id != WT_TXN_NONE)
+		return (__wt_readunlock(session, conn->hs_ckpt_lock));
+
+	/*
+	 * IDs are published in the transaction state before the global ID moves
+	 * past them: read the current ID first, anything allocated after it is
+	 * larger, and the smallest running ID is the bound.  Rolled back updates
+	 * are marked before the state is cleared.
+	 */
+	WT_ORDERED_READ(resolved, txn_global->current);
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++)
+		if ((id = s->id) != WT_TXN_NONE && TXNID_LT(id, resolved))
+			resolved = id;
+	WT_READ_BARRIER();
+
+	*lockedp = 1;
+	*resolvedp = resolved;
+	return 0;
+}
+
+/*
+ * __wt_hs_evict_end --
+ *	Finish an eviction that wrote versions to the history store.
+ */
+int __wt_hs_evict_end(WT_SESSION_IMPL* session)
+{
+	return (__wt_readunlock(session, S2C(session)->hs_ckpt_lock));
+}
+
+/*
+ * __wt_hs_insert --
+ *	Write a version of a key replaced by transaction stop_txn, a NULL value
+ * records that the key didn't exist.
+ */
+int __wt_hs_insert(WT_SESSION_IMPL* session, uint32_t btree_id, WT_ITEM* key, uint64_t seq, uint64_t stop_txn, WT_ITEM* value)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_ITEM empty;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->hs_lock);
+	if ((cursor = conn->hs_cursor) == NULL)
+		ret = EBUSY;
+	else {
+		cursor->set_key(cursor, btree_id, key, seq);
+		if (value == NULL) {
+			WT_CLEAR(empty);
+			cursor->set_value(cursor, stop_txn, 1, &empty);
+		}
+		else
+			cursor->set_value(cursor, stop_txn, 0, value);
+		ret = cursor->insert(cursor);
+		WT_TRET(cursor->reset(cursor));
+		if (ret == 0 && TXNID_LT(conn->hs_max_txn, stop_txn))
+			conn->hs_max_txn = stop_txn;
+	}
+	__wt_spin_unlock(session, &conn->hs_lock);
+
+	if (ret == 0)
+		WT_STAT_FAST_CONN_INCR(session, cache_hs_insert);
+	return ret;
+}
+
+/*
+ * __wt_hs_search --
+ *	Find the version of a key the session's transaction reads when it can't
+ * see the version on the page.  *updp is set to a new update the caller must
+ * free, a deleted update if the key didn't exist for the reader, and to NULL
+ * if the reader can see the page's version.
+ */
+int __wt_hs_search(WT_SESSION_IMPL* session, WT_ITEM* key, WT_UPDATE** updp)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(value);
+	WT_DECL_RET;
+	WT_ITEM hs_key, hs_value;
+	size_t notused;
+	uint64_t hs_seq, stop_txn;
+	uint32_t btree_id, hs_id;
+	uint8_t deleted, found_deleted;
+	int exact, found;
+
+	btree_id = S2BT(session)->id;
+	*updp = NULL;
+
+	WT_STAT_FAST_CONN_INCR(session, cache_hs_search);
+
+	WT_RET(__wt_scr_alloc(session, 0, &value));
+	found = 0;
+	found_deleted = 0;
+
+	WT_ERR(__hs_cursor(session, &cursor));
+	if (cursor == NULL)
+		goto err;
+
+	/*
+	 * The reader may have no positioned cursor (count_range): count the
+	 * history store cursor as active while it's used, resetting it must not
+	 * release the reader's snapshot.
+	 */
+	++session->ncursors;
+
+	/*keyļ¼sequenceУӵһʼ*/
+	cursor->set_key(cursor, btree_id, key, (uint64_t)0);
+	if ((ret = cursor->search_near(cursor, &exact)) == 0 && exact < 0)
+		ret = cursor->next(cursor);
+	for (; ret == 0; ret = cursor->next(cursor)) {
+		WT_ERR(cursor->get_key(cursor, &hs_id, &hs_key, &hs_seq));
+		if (hs_id != btree_id || hs_key.size != key->size || memcmp(hs_key.data, key->data, key->size) != 0)
+			break;
+
+		WT_ERR(cursor->get_value(cursor, &stop_txn, &deleted, &hs_value));
+		if (__wt_txn_visible(session, stop_txn))
+			found = 0;
+		else if (!found) {
+			WT_ERR(__wt_buf_set(session, value, hs_value.data, hs_value.size));
+			found_deleted = deleted;
+			found = 1;
+		}
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+err:
+	if (cursor != NULL) {
+		WT_TRET(cursor->reset(cursor));
+		--session->ncursors;
+	}
+
+	if (ret == 0 && found)
+		ret = __wt_update_alloc(session, found_deleted ? NULL : value, updp, &notused);
+	__wt_scr_free(session, &value);
+	return ret;
+}
+
+/*
+ * __wt_hs_cursor_read --
+ *	Find the version of an on-page row-store key a cursor reads when none of
+ * the key's updates are visible, *updp is left NULL if it's the page's.  The
+ * update belongs to the cursor until its next history store read.
+ */
+int __wt_hs_cursor_read(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt, WT_ROW* rip, WT_UPDATE** updp)
+{
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	WT_UPDATE *upd;
+
+	*updp = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &key));
+	WT_ERR(__wt_row_leaf_key(session, cbt->ref->page, rip, key, 0));
+	WT_ERR(__wt_hs_search(session, key, &upd));
+	if (upd != NULL) {
+		__wt_free(session, cbt->hs_upd);
+		cbt->hs_upd = upd;
+		*updp = upd;
+	}
+
+err:
+	__wt_scr_free(session, &key);
+	return ret;
+}
+
+/*
+ * __wt_hs_update_check --
+ *	Check for a conflict updating an on-page row-store key with no updates:
+ * the version on the page may have been committed after the snapshot.
+ */
+int __wt_hs_update_check(WT_SESSION_IMPL* session, WT_PAGE* page, WT_ITEM* key)
+{
+	WT_UPDATE *upd;
+
+	if (session->txn.isolation != TXN_ISO_SNAPSHOT || !__wt_hs_page_lookup(session, page))
+		return 0;
+
+	WT_RET(__wt_hs_search(session, key, &upd));
+	if (upd == NULL)
+		return 0;
+
+	__wt_free(session, upd);
+	WT_STAT_FAST_DATA_INCR(session, txn_update_conflict);
+	return WT_ROLLBACK;
+}
+
+/*
+ * __wt_hs_sweep --
+ *	Discard the history store records no transaction can read, one pass
+ * over the store starting where the last pass stopped.  The cursor lock is
+ * released every few records so eviction isn't held up.  Only
+ * the oldest records of a key are removed, a record after one that's kept
+ * is still needed to stop readers.
+ */
+int __wt_hs_sweep(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_ITEM hs_key, hs_value;
+	uint64_t hs_seq, removed, stop_txn;
+	uint32_t hs_id, i, last_id;
+	uint8_t deleted;
+	int exact, kept, wrapped;
+
+	conn = S2C(session);
+	removed = 0;
+
+	for (wrapped = 0;;) {
+		__wt_spin_lock(session, &conn->hs_lock);
+		if ((cursor = conn->hs_cursor) == NULL) {
+			__wt_spin_unlock(session, &conn->hs_lock);
+			break;
+		}
+
+		/*sweep_key¼һͣµλãkeptʾkeyǰбļ¼*/
+		last_id = conn->hs_sweep_id;
+		kept = conn->hs_sweep_kept;
+		if (conn->hs_sweep_key.data == NULL) {
+			kept = 0;
+			ret = cursor->next(cursor);
+		}
+		else {
+			cursor->set_key(cursor, conn->hs_sweep_id, &conn->hs_sweep_key, conn->hs_sweep_seq);
+			if ((ret = cursor->search_near(cursor, &exact)) == 0 && exact < 0)
+				ret = cursor->next(cursor);
+		}
+		for (i = 0; ret == 0 && i < WT_HS_SWEEP_BATCH; ++i, ret = cursor->next(cursor)) {
+			WT_ERR(cursor->get_key(cursor, &hs_id, &hs_key, &hs_seq));
+			if (hs_id != last_id || hs_key.size != conn->hs_sweep_key.size || memcmp(hs_key.data, conn->hs_sweep_key.data, hs_key.size) != 0) {
+				last_id = hs_id;
+				WT_ERR(__wt_buf_set(session, &conn->hs_sweep_key, hs_key.data, hs_key.size));
+				kept = 0;
+			}
+
+			WT_ERR(cursor->get_value(cursor, &stop_txn, &deleted, &hs_value));
+			if (!kept && __wt_txn_visible_all(session, stop_txn)) {
+				WT_ERR(cursor->remove(cursor));
+				++removed;
+			}
+			else
+				kept = 1;
+		}
+
+		/*סͣµλãĩβһδͷʼ*/
+		if (ret == 0) {
+			WT_ERR(cursor->get_key(cursor, &hs_id, &hs_key, &hs_seq));
+			if (hs_id != last_id || hs_key.size != conn->hs_sweep_key.size || memcmp(hs_key.data, conn->hs_sweep_key.data, hs_key.size) != 0) {
+				WT_ERR(__wt_buf_set(session, &conn->hs_sweep_key, hs_key.data, hs_key.size));
+				kept = 0;
+			}
+			conn->hs_sweep_id = hs_id;
+			conn->hs_sweep_seq = hs_seq;
+			conn->hs_sweep_kept = kept;
+		}
+		else if (ret == WT_NOTFOUND) {
+			__wt_buf_free(session, &conn->hs_sweep_key);
+			conn->hs_sweep_kept = 0;
+			wrapped = 1;
+			ret = 0;
+		}
+
+err:
+		WT_TRET(cursor->reset(cursor));
+		__wt_spin_unlock(session, &conn->hs_lock);
+		if (ret != 0 || wrapped)
+			break;
+	}
+
+	WT_STAT_FAST_CONN_INCRV(session, cache_hs_remove, removed);
+	return ret;
+}
@@ -85,6 +85,7 @@ int __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	WT_TRET(__wt_checkpoint_server_destroy(session));
 	WT_TRET(__wt_statlog_destroy(session, 1));
 	WT_TRET(__wt_sweep_destroy(session));
+	WT_TRET(__wt_hs_destroy(session));
 
 	/*رconnection򿪵dhandlebtree*/
 	WT_TRET(__wt_conn_dhandle_discard(session));
@@ -158,10 +159,12 @@ int __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	if((s = conn->sessions) != NULL){
 		for (i = 0; i < conn->session_size; ++s, ++i){
 			if (s != session) {
-				if (s->dhhash != NULL)
-					__wt_free(session, s->dhhash);
+				if (s->dhtable != NULL)
+					__wt_free(session, s->dhtable);
 				if (s->tablehash != NULL)
 					__wt_free(session, s->tablehash);
+				if (s->cursor_cache != NULL)
+					__wt_free(session, s->cursor_cache);
 				__wt_free(session, s->hazard);
 			}
 		}
@@ -207,6 +210,9 @@ int __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	 */
 	WT_RET(__wt_logmgr_open(session));
 
+	/* Create the history store eviction writes old versions to. */
+	WT_RET(__wt_hs_create(session));
+
 	/* Start the optional checkpoint thread. */
 	WT_RET(__wt_checkpoint_server_create(session, cfg));
 
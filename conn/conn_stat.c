@@ -24,12 +24,52 @@ static void __stat_sources_free(WT_SESSION_IMPL* session, char*** sources)
 	}
 }
 
-/*ʼsessionͳģ飬Ҫasyncͳģ顢cacheͳģͳģ*/
+/*
+ * __stat_shards_sum --
+ *	Sum the per-session statistics shards into the connection statistics.
+ * The shards are read without locking, the same as the counters themselves
+ * are updated.
+ */
+static void __stat_shards_sum(WT_CONNECTION_IMPL* conn)
+{
+	WT_STATS *dst, *src;
+	uint64_t v;
+	size_t i, n;
+	u_int shard;
+
+	dst = (WT_STATS *)&conn->stats;
+	n = sizeof(WT_CONNECTION_STATS) / sizeof(WT_STATS);
+	for (i = 0; i < n; ++i) {
+		for (v = 0, shard = 0; shard < WT_STAT_CONN_SHARDS; ++shard) {
+			src = (WT_STATS *)&conn->stat_shard[shard].stats;
+			v += src[i].v;
+		}
+		dst[i].v = v;
+	}
+}
+
+/*connectionͳƣƬпļҲһ*/
+void __wt_conn_stat_refresh(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	u_int shard;
+
+	conn = S2C(session);
+
+	__wt_stat_refresh_connection_stats(&conn->stats);
+	for (shard = 0; shard < WT_STAT_CONN_SHARDS; ++shard)
+		__wt_stat_refresh_connection_stats(&conn->stat_shard[shard].stats);
+}
+
+/*ʼsessionͳģ飬ȻܸͳƷƬٸasyncͳģ顢cacheͳģͳģ*/
 void __wt_conn_stat_init(WT_SESSION_IMPL* session)
 {
-	_wt_async_stats_update(session);
+	__stat_shards_sum(S2C(session));
+
+	__wt_async_stats_update(session);
 	__wt_cache_stats_update(session);
 	__wt_txn_stats_update(session);
+	__wt_latency_stats_update(session);
 }
 
 static int __statlog_config(WT_SESSION_IMPL* session, const char** cfg, int* runp)
@@ -243,6 +283,10 @@ static __statlog_log_one(WT_SESSION_IMPL* session, WT_ITEM* path, WT_ITEM* tmp)
 	/* Dump the connection statistics. */
 	WT_RET(__statlog_dump(session, conn->home, 1));
 
+	/*ӳֱͼĸͰٷλѾconnectionͳ*/
+	if (FLD_ISSET(conn->stat_flags, WT_CONN_STAT_FAST))
+		WT_RET(__wt_latency_statlog(session, conn->stat_fp, conn->stat_stamp, conn->home));
+
 	/*
 	* Lock the schema and walk the list of open handles, dumping
 	* any that match the list of object sources.
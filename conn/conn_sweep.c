@@ -138,6 +138,9 @@ static WT_THREAD_RET __sweep_server(void* arg)
 		WT_ERR(__wt_cond_wait(session, conn->sweep_cond, (uint64_t)conn->sweep_interval * WT_MILLION));
 
 		WT_ERR(__sweep(session));
+
+		/*history storeûȡľɰ汾*/
+		WT_ERR(__wt_hs_sweep(session));
 	}
 
 	if (0){
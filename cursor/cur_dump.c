@@ -322,6 +322,10 @@ int __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
 	cursor->value_format = child->value_format;
 	cdump->child = child;
 
+	/*dump cursorkey/valueǸʽַ֧rawʽ*/
+	cursor->search_batch = (int (*)(WT_CURSOR *, const WT_ITEM *, WT_ITEM *, int *, uint32_t))__wt_cursor_notsup;
+	cursor->insert_batch = (int (*)(WT_CURSOR *, const WT_ITEM *, const WT_ITEM *, uint32_t))__wt_cursor_notsup;
+
 	/* Copy the dump flags from the child cursor. */
 	F_SET(cursor, F_ISSET(child, WT_CURSTD_DUMP_HEX | WT_CURSTD_DUMP_JSON | WT_CURSTD_DUMP_PRINT));
 	if (F_ISSET(cursor, WT_CURSTD_DUMP_JSON)) {
@@ -139,6 +139,7 @@ static int __curfile_search(WT_CURSOR* cursor)
 	WT_CURSOR_BTREE *cbt;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	struct timespec start;
 
 	cbt = (WT_CURSOR_BTREE *)cursor;
 	CURSOR_API_CALL(cursor, session, search, cbt->btree);
@@ -146,7 +147,9 @@ static int __curfile_search(WT_CURSOR* cursor)
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NOVALUE(cursor);
 
+	WT_LATENCY_BEGIN(session, start);
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_search(cbt), ret);
+	WT_LATENCY_END(session, WT_LATENCY_CURSOR_SEARCH, start);
 
 err:
 	API_END_RET(session, ret);
@@ -177,6 +180,7 @@ static int __curfile_insert(WT_CURSOR *cursor)
 	WT_CURSOR_BTREE *cbt;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	struct timespec start;
 
 	cbt = (WT_CURSOR_BTREE *)cursor;
 	CURSOR_UPDATE_API_CALL(cursor, session, insert, cbt->btree);
@@ -184,7 +188,9 @@ static int __curfile_insert(WT_CURSOR *cursor)
 		WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NEEDVALUE(cursor);
 
+	WT_LATENCY_BEGIN(session, start);
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_insert(cbt), ret);
+	WT_LATENCY_END(session, WT_LATENCY_CURSOR_INSERT, start);
 
 	/*
 	 * Insert is the one cursor operation that doesn't end with the cursor
@@ -207,12 +213,54 @@ err:
 	return ret;
 }
 
+/*btree cursorѯkeyvaluerawʽ*/
+static int __curfile_search_batch(WT_CURSOR* cursor, const WT_ITEM* keys, WT_ITEM* values, int* results, uint32_t count)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_API_CALL(cursor, session, search_batch, cbt->btree);
+
+	ret = __wt_btcur_search_batch(cbt, keys, values, results, count);
+
+	/*cursorָκμ¼*/
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+err:
+	API_END_RET(session, ret);
+}
+
+/*
+ * __curfile_insert_batch --
+ *	WT_CURSOR->insert_batch method for the btree cursor type.  Outside of an
+ * application transaction the API call's autocommit transaction covers the
+ * whole batch: it's committed, and logged, once.
+ */
+static int __curfile_insert_batch(WT_CURSOR* cursor, const WT_ITEM* keys, const WT_ITEM* values, uint32_t count)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_UPDATE_API_CALL(cursor, session, insert_batch, cbt->btree);
+
+	ret = __wt_btcur_insert_batch(cbt, keys, values, count);
+
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+err:
+	CURSOR_UPDATE_API_END(session, ret);
+	return ret;
+}
+
 /*btree cursorĸ²*/
 static int __curfile_update(WT_CURSOR *cursor)
 {
 	WT_CURSOR_BTREE *cbt;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	struct timespec start;
 
 	cbt = (WT_CURSOR_BTREE *)cursor;
 	CURSOR_UPDATE_API_CALL(cursor, session, update, cbt->btree);
@@ -220,7 +268,9 @@ static int __curfile_update(WT_CURSOR *cursor)
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NEEDVALUE(cursor);
 
+	WT_LATENCY_BEGIN(session, start);
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_update(cbt), ret);
+	WT_LATENCY_END(session, WT_LATENCY_CURSOR_UPDATE, start);
 
 err:	
 	CURSOR_UPDATE_API_END(session, ret);
@@ -251,6 +301,7 @@ static int __curfile_remove(WT_CURSOR* cursor)
 	WT_CURSOR_BTREE *cbt;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	struct timespec start;
 
 	cbt = (WT_CURSOR_BTREE *)cursor;
 	CURSOR_UPDATE_API_CALL(cursor, session, remove, cbt->btree);
@@ -258,7 +309,9 @@ static int __curfile_remove(WT_CURSOR* cursor)
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NOVALUE(cursor);
 
+	WT_LATENCY_BEGIN(session, start);
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_remove(cbt), ret);
+	WT_LATENCY_END(session, WT_LATENCY_CURSOR_REMOVE, start);
 
 	/*
 	 * After a successful remove, copy the key: the value is not available.
@@ -277,6 +330,120 @@ err:
 	return ret;
 }
 
+/*
+ * __curfile_release_handle --
+ *	Release the btree handle lock of a cursor being parked in the cursor
+ * cache.  The cursor keeps a session reference so the handle structure can't
+ * be discarded, but holds no lock, so it doesn't block exclusive operations.
+ */
+static int __curfile_release_handle(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt)
+{
+	WT_DATA_HANDLE *dhandle;
+
+	dhandle = session->dhandle;
+	WT_ASSERT(session, dhandle == cbt->btree->dhandle);
+
+	cbt->open_gen = dhandle->open_gen;
+	(void)WT_ATOMIC_ADD4(dhandle->session_ref, 1);
+
+	__wt_cursor_dhandle_decr_use(session);
+	return (__wt_session_release_btree(session));
+}
+
+/*»ûcursorbtree handlehandleرջ´򿪹ʱWT_NOTFOUND*/
+static int __curfile_lock_handle(WT_SESSION_IMPL* session, WT_CURSOR_BTREE* cbt)
+{
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+
+	dhandle = session->dhandle;
+	WT_ASSERT(session, dhandle == cbt->btree->dhandle);
+
+	WT_RET(__wt_session_lock_dhandle(session, 0));
+
+	/*handleڻڼ䱻رպִˣbtreeĸʽϢѾı*/
+	if (dhandle->open_gen != cbt->open_gen) {
+		WT_RET(__wt_session_release_btree(session));
+		return (WT_NOTFOUND);
+	}
+
+	__wt_cursor_dhandle_incr_use(session);
+	(void)WT_ATOMIC_SUB4(dhandle->session_ref, 1);
+
+	return (ret);
+}
+
+/*file cursorsessioncursor cache*/
+static int __curfile_cache(WT_CURSOR* cursor)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_RET(__wt_cursor_cache(cursor));
+	return (__curfile_release_handle(session, (WT_CURSOR_BTREE *)cursor));
+}
+
+/*cursor cache´file cursor*/
+static int __curfile_reopen(WT_CURSOR* cursor)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DATA_HANDLE *saved_dhandle;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	saved_dhandle = session->dhandle;
+	session->dhandle = cbt->btree->dhandle;
+	if ((ret = __curfile_lock_handle(session, cbt)) == 0)
+		__wt_cursor_reopen(cursor);
+	session->dhandle = saved_dhandle;
+
+	return (ret);
+}
+
+/*owner(table cursor)ʱcolgroup/index file cursor*/
+int __wt_curfile_cache_child(WT_CURSOR* cursor)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DATA_HANDLE *saved_dhandle;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	saved_dhandle = session->dhandle;
+	session->dhandle = cbt->btree->dhandle;
+	__wt_cursor_cache_child(cursor);
+	ret = __curfile_release_handle(session, cbt);
+	session->dhandle = saved_dhandle;
+
+	return (ret);
+}
+
+/*ownercursor cache´ʱ´colgroup/index file cursor*/
+int __wt_curfile_reopen_child(WT_CURSOR* owner, WT_CURSOR* cursor)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DATA_HANDLE *saved_dhandle;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	saved_dhandle = session->dhandle;
+	session->dhandle = cbt->btree->dhandle;
+	if ((ret = __curfile_lock_handle(session, cbt)) == 0)
+		__wt_cursor_reopen_child(owner, cursor);
+	session->dhandle = saved_dhandle;
+
+	return (ret);
+}
+
 /*رbtree cursor*/
 static int __curfile_close(WT_CURSOR *cursor)
 {
@@ -286,11 +453,26 @@ static int __curfile_close(WT_CURSOR *cursor)
 
 	cbt = (WT_CURSOR_BTREE *)cursor;
 	CURSOR_API_CALL(cursor, session, close, cbt->btree);
+
+	/*Իcursorsessioncursor cacheر; ܻʱ(EBUSY)ر*/
+	if (F_ISSET(cursor, WT_CURSTD_CACHEABLE)) {
+		ret = __curfile_cache(cursor);
+		if (F_ISSET(cursor, WT_CURSTD_CACHED))
+			goto err;
+		if (ret == EBUSY)
+			ret = 0;
+	}
+
 	WT_TRET(__wt_btcur_close(cbt));
 	if (cbt->btree != NULL) {
-		/* Increment the data-source's in-use counter. */
-		__wt_cursor_dhandle_decr_use(session);
-		WT_TRET(__wt_session_release_btree(session));
+		/*еcursorûгhandleֻҪͷŶhandle*/
+		if (F_ISSET(cursor, WT_CURSTD_CACHED))
+			(void)WT_ATOMIC_SUB4(cbt->btree->dhandle->session_ref, 1);
+		else {
+			/* Increment the data-source's in-use counter. */
+			__wt_cursor_dhandle_decr_use(session);
+			WT_TRET(__wt_session_release_btree(session));
+		}
 	}
 	/* The URI is owned by the btree handle. */
 	cursor->internal_uri = NULL;
@@ -347,6 +529,13 @@ int __wt_curfile_create(WT_SESSION_IMPL *session,
 	cursor->value_format = btree->value_format;
 
 	cbt->btree = btree;
+
+	/*д洢rootʼļ·д洢ʹͨõʵ*/
+	if (btree->type == BTREE_ROW) {
+		cursor->search_batch = __curfile_search_batch;
+		cursor->insert_batch = __curfile_insert_batch;
+	}
+
 	if (bulk) {
 		F_SET(cursor, WT_CURSTD_BULK);
 
@@ -359,15 +548,28 @@ int __wt_curfile_create(WT_SESSION_IMPL *session,
 
 	/*
 	 * random_retrieval
-	 * Random retrieval cursors only support next, reset and close.
+	 * Random retrieval cursors only support next, reset and close.  A
+	 * sample size makes the cursor return a uniformly-weighted sample.
 	 */
+	WT_ERR(__wt_config_gets_def(session, cfg, "next_random_sample", 0, &cval));
+	cbt->sample_size = (uint64_t)cval.val;
 	WT_ERR(__wt_config_gets_def(session, cfg, "next_random", 0, &cval));
-	if (cval.val != 0) {
+	if (cval.val != 0 || cbt->sample_size != 0) {
 		__wt_cursor_set_notsup(cursor);
 		cursor->next = __curfile_next_random;
 		cursor->reset = __curfile_reset;
 	}
 
+	/*
+	 * Top-level cursors on a live tree can be parked in the session's cursor
+	 * cache on close; bulk and checkpoint cursors can't, they're tied to an
+	 * exclusive or point-in-time handle.
+	 */
+	if (!bulk && owner == NULL && btree->dhandle->checkpoint == NULL) {
+		cursor->cache = __curfile_cache;
+		cursor->reopen = __curfile_reopen;
+	}
+
 	/* __wt_cursor_init is last so we don't have to clean up on error. */
 	WT_ERR(__wt_cursor_init(cursor, cursor->internal_uri, owner, cfg, cursorp));
 
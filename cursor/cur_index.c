@@ -2,8 +2,9 @@
 #include "wt_internal.h"
 
 /*ȡindex cursorӦvalueҪindexӦcolumnϢ*/
-static int __cur_get_value(WT_CURSOR* cursor, ...)
+static int __curindex_get_value(WT_CURSOR* cursor, ...)
 {
+	WT_CURSOR **cp;
 	WT_CURSOR_INDEX *cindex;
 	WT_DECL_RET;
 	WT_ITEM *item;
@@ -14,9 +15,12 @@ static int __cur_get_value(WT_CURSOR* cursor, ...)
 	CURSOR_API_CALL(cursor, session, get_value, NULL);
 	WT_CURSOR_NEEDVALUE(cursor);
 
+	/*ֱӴkey/valueȡֵ*/
+	cp = cindex->covered ? &cindex->child : cindex->cg_cursors;
+
 	va_start(ap, cursor);
 	if(F_ISSET(cursor, WT_CURSOR_RAW_OK)){
-		ret = __wt_schema_project_merge(session, cindex->cg_cursors, cindex->value_plan, cursor->value_format, &cursor->value);
+		ret = __wt_schema_project_merge(session, cp, cindex->value_plan, cursor->value_format, &cursor->value);
 		if (ret == 0) {
 			item = va_arg(ap, WT_ITEM *);
 			item->data = cursor->value.data;
@@ -24,9 +28,12 @@ static int __cur_get_value(WT_CURSOR* cursor, ...)
 		}
 	}
 	else
-		ret = __wt_schema_project_out(session, cindex->cg_cursors, cindex->value_plan, ap);
+		ret = __wt_schema_project_out(session, cp, cindex->value_plan, ap);
 
 	va_end(ap);
+
+err:
+	API_END_RET(session, ret);
 }
 
 /*cursorֵ,ֱӷһENOTSUP,index cursorв̬ܶıԪϢ*/
@@ -121,6 +128,7 @@ static int __curindex_next(WT_CURSOR *cursor)
 	cindex = (WT_CURSOR_INDEX *)cursor;
 	CURSOR_API_CALL(cursor, session, next, NULL);
 	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	WT_ERR(__wt_curtable_idx_batch_read(session, cindex->table));
 
 	if ((ret = cindex->child->next(cindex->child)) == 0)
 		ret = __curindex_move(cindex);
@@ -142,6 +150,7 @@ static int __curindex_prev(WT_CURSOR *cursor)
 	cindex = (WT_CURSOR_INDEX *)cursor;
 	CURSOR_API_CALL(cursor, session, prev, NULL);
 	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	WT_ERR(__wt_curtable_idx_batch_read(session, cindex->table));
 
 	if ((ret = cindex->child->prev(cindex->child)) == 0)
 		ret = __curindex_move(cindex);
@@ -188,6 +197,9 @@ static int __curindex_search(WT_CURSOR* cursor)
 	child = cindex->child;
 	CURSOR_API_CALL(cursor, session, search, NULL);
 
+	/*ͬһsessiontable cursorkeyдҪܶԼ޸*/
+	WT_ERR(__wt_curtable_idx_batch_read(session, cindex->table));
+
 	/*
 	 * We are searching using the application-specified key, which
 	 * (usually) doesn't contain the primary key, so it is just a prefix of
@@ -243,6 +255,7 @@ static int __curindex_search_near(WT_CURSOR *cursor, int *exact)
 
 	cindex = (WT_CURSOR_INDEX *)cursor;
 	CURSOR_API_CALL(cursor, session, search_near, NULL);
+	WT_ERR(__wt_curtable_idx_batch_read(session, cindex->table));
 	__wt_cursor_set_raw_key(cindex->child, &cursor->key);
 	if ((ret = cindex->child->search_near(cindex->child, exact)) == 0) /*cursorλµλ*/
 		ret = __curindex_move(cindex);
@@ -300,6 +313,109 @@ err:
 	API_END_RET(session, ret);
 }
 
+/*
+ * __curindex_find_col --
+ *	Find a table column in the index: the index key holds the index columns
+ * followed by the primary key columns not already indexed, the value holds
+ * the columns included by a covering index.
+ */
+static int __curindex_find_col(WT_SESSION_IMPL* session, WT_CURSOR_INDEX* cindex, WT_CONFIG_ITEM* colname, char* coltypep, u_int* colnump)
+{
+	WT_CONFIG conf;
+	WT_CONFIG_ITEM k, v, dummy;
+	WT_DECL_RET;
+	WT_INDEX *idx;
+	WT_TABLE *table;
+	u_int col, i;
+
+	idx = cindex->index;
+	table = cindex->table;
+
+	*coltypep = WT_PROJ_KEY;
+	col = 0;
+	WT_RET(__wt_config_subinit(session, &conf, &idx->colconf));
+	for (; (ret = __wt_config_next(&conf, &k, &v)) == 0; ++col)
+		if (k.len == colname->len && strncmp(k.str, colname->str, k.len) == 0)
+			goto found;
+	WT_RET_NOTFOUND_OK(ret);
+
+	WT_RET(__wt_config_subinit(session, &conf, &table->colconf));
+	for (i = 0; i < table->nkey_columns && (ret = __wt_config_next(&conf, &k, &v)) == 0; ++i) {
+		if (__wt_config_subgetraw(session, &idx->colconf, &k, &dummy) == 0)
+			continue;
+		if (k.len == colname->len && strncmp(k.str, colname->str, k.len) == 0)
+			goto found;
+		++col;
+	}
+	WT_RET_NOTFOUND_OK(ret);
+
+	if (idx->inc_plan == NULL)
+		return (WT_NOTFOUND);
+
+	*coltypep = WT_PROJ_VALUE;
+	col = 0;
+	WT_RET(__wt_config_subinit(session, &conf, &idx->incconf));
+	for (; (ret = __wt_config_next(&conf, &k, &v)) == 0; ++col)
+		if (k.len == colname->len && strncmp(k.str, colname->str, k.len) == 0)
+			goto found;
+	return (ret);
+
+found:
+	*colnump = col;
+	return (0);
+}
+
+/*
+ * __curindex_cover_plan --
+ *	Build a plan projecting the cursor's value columns out of the index
+ * cursor alone.  Returns WT_NOTFOUND if some column is only available from
+ * the table's column groups.
+ */
+static int __curindex_cover_plan(WT_SESSION_IMPL* session, WT_CURSOR_INDEX* cindex, const char* columns, WT_ITEM* plan)
+{
+	WT_CONFIG conf;
+	WT_CONFIG_ITEM k, v;
+	WT_DECL_RET;
+	WT_TABLE *table;
+	u_int col, current_col, i;
+	char coltype, current_coltype;
+
+	table = cindex->table;
+
+	/*ûprojectionʱcursorvalueǱеvalue*/
+	if (columns != NULL)
+		WT_RET(__wt_config_init(session, &conf, columns));
+	else {
+		WT_RET(__wt_config_subinit(session, &conf, &table->colconf));
+		for (i = 0; i < table->nkey_columns; i++)
+			WT_RET(__wt_config_next(&conf, &k, &v));
+	}
+
+	current_col = UINT_MAX;
+	current_coltype = 0;
+	while ((ret = __wt_config_next(&conf, &k, &v)) == 0) {
+		WT_RET(__curindex_find_col(session, cindex, &k, &coltype, &col));
+
+		if (coltype != current_coltype || current_col > col) {
+			WT_RET(__wt_buf_catfmt(session, plan, "0%c", coltype));
+			current_coltype = coltype;
+			current_col = 0;
+		}
+		if (current_col < col) {
+			if (col - current_col > 1)
+				WT_RET(__wt_buf_catfmt(session, plan, "%u", col - current_col));
+			WT_RET(__wt_buf_catfmt(session, plan, "%c", WT_PROJ_SKIP));
+		}
+		WT_RET(__wt_buf_catfmt(session, plan, "%c", WT_PROJ_NEXT));
+		current_col = col + 1;
+	}
+	WT_RET_NOTFOUND_OK(ret);
+
+	if (plan->size == 0)
+		WT_RET(__wt_buf_set(session, plan, "", 1));
+	return (0);
+}
+
 /*Ӧصcol groupscolumnӦcursor*/
 static int __curindex_open_colgroups(WT_SESSION_IMPL *session, WT_CURSOR_INDEX *cindex, const char *cfg_arg[])
 {
@@ -314,6 +430,10 @@ static int __curindex_open_colgroups(WT_SESSION_IMPL *session, WT_CURSOR_INDEX *
 	WT_RET(__wt_calloc_def(session, WT_COLGROUPS(table), &cp));
 	cindex->cg_cursors = cp;
 
+	/*Ҫκcolgroup cursor*/
+	if (cindex->covered)
+		return 0;
+
 	/* Work out which column groups we need. */
 	for (proj = (char *)cindex->value_plan; *proj != '\0'; proj++) {
 		arg = strtoul(proj, &proj, 10);
@@ -416,6 +536,25 @@ int __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *own
 		WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &cindex->value_plan));
 	}
 
+	/*
+	 * If every column the cursor returns can be taken from the index key or
+	 * the columns a covering index includes, don't position column group
+	 * cursors at all: that saves a random read per index entry.  Custom
+	 * extractors don't map index key columns to table columns.
+	 */
+	if (idx->extractor == NULL) {
+		if (tmp == NULL)
+			WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+		WT_ERR(__wt_buf_init(session, tmp, 0));
+		if ((ret = __curindex_cover_plan(session, cindex, columns, tmp)) == 0) {
+			if (cindex->value_plan != idx->value_plan)
+				__wt_free(session, cindex->value_plan);
+			WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &cindex->value_plan));
+			cindex->covered = 1;
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+	}
+
 	WT_ERR(__wt_cursor_init(cursor, cursor->internal_uri, owner, cfg, cursorp));
 
 	WT_ERR(__wt_open_cursor(session, idx->source, cursor, cfg, &cindex->child));
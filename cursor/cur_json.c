@@ -4,15 +4,57 @@
 
 #include "wt_internal.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 static size_t		__json_unpack_put(WT_SESSION_IMPL *, void *, u_char *, size_t, WT_CONFIG_ITEM *);
 static inline int	__json_struct_size(WT_SESSION_IMPL *, const void *, size_t, const char *, WT_CONFIG_ITEM *, int, size_t *);
-static inline int	__json_struct_unpackv(WT_SESSION_IMPL *, const void *, size_t, const char *, WT_CONFIG_ITEM *, u_char *, size_t, int, va_list);
+static inline int	__json_struct_unpackv(WT_SESSION_IMPL *, const void *, size_t, const char *, WT_CONFIG_ITEM *, u_char *, size_t, int, const char *, va_list);
 static int			json_string_arg(WT_SESSION_IMPL *, const char **, WT_ITEM *);
 static int			json_int_arg(WT_SESSION_IMPL *, const char **, int64_t *);
 static int			json_uint_arg(WT_SESSION_IMPL *, const char **, uint64_t *);
 static int			__json_pack_struct(WT_SESSION_IMPL *, void *, size_t, const char *, const char *);
 static int			__json_pack_size(WT_SESSION_IMPL *, const char *, WT_CONFIG_ITEM *, int, const char *, size_t *);
 
+/*
+ * __json_scan_string --
+ *	Return the first '"', '\\' or NUL at or after src, that is, the end of
+ * a run of string bytes that need no unescaping.  With SSE2 sixteen bytes
+ * are compared per step; the loads are aligned so they never cross into the
+ * next page, the bytes before src in the first block are masked off.
+ */
+static inline const char* __json_scan_string(const char* src)
+{
+#if defined(__SSE2__)
+	__m128i bslash, nul, quote, v;
+	const char *p;
+	u_int mask;
+
+	quote = _mm_set1_epi8('"');
+	bslash = _mm_set1_epi8('\\');
+	nul = _mm_setzero_si128();
+
+#define	WT_JSON_SCAN_MASK(p)												\
+	(v = _mm_load_si128((const __m128i *)(p)),								\
+	(u_int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(						\
+	    _mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash)), _mm_cmpeq_epi8(v, nul))))
+
+	p = (const char *)((uintptr_t)src & ~(uintptr_t)15);
+	mask = WT_JSON_SCAN_MASK(p) & (~0U << WT_PTRDIFF(src, p));
+	while (mask == 0) {
+		p += 16;
+		mask = WT_JSON_SCAN_MASK(p);
+	}
+#undef	WT_JSON_SCAN_MASK
+	return (p + __builtin_ctz(mask));
+#else
+	while (*src != '\0' && *src != '"' && *src != '\\')
+		++src;
+	return (src);
+#endif
+}
+
 #define	WT_PACK_JSON_GET(session, pv, jstr) do {			\
 	switch (pv.type) {						\
 	case 'x':							\
@@ -189,10 +231,11 @@ static inline int __json_struct_size(WT_SESSION_IMPL *session, const void *buffe
 
 /*
  * __json_struct_unpackv --
- *	Unpack a byte string to JSON (va_list version).
+ *	Unpack a byte string to JSON (va_list version).  Columns are separated
+ *	by sep, which must be two characters long.
  */
 static inline int __json_struct_unpackv(WT_SESSION_IMPL *session,
-    const void *buffer, size_t size, const char *fmt, WT_CONFIG_ITEM *names, u_char *jbuf, size_t jbufsize, int iskey, va_list ap)
+    const void *buffer, size_t size, const char *fmt, WT_CONFIG_ITEM *names, u_char *jbuf, size_t jbufsize, int iskey, const char *sep, va_list ap)
 {
 	WT_CONFIG_ITEM name;
 	WT_DECL_PACK_VALUE(pv);
@@ -215,7 +258,7 @@ static inline int __json_struct_unpackv(WT_SESSION_IMPL *session,
 	while ((ret = __pack_next(&pack, &pv)) == 0) {
 		if (needcr) {
 			WT_ASSERT(session, jbufsize >= 3);
-			strncat((char *)jbuf, ",\n", jbufsize);
+			strncat((char *)jbuf, sep, jbufsize);
 			jbuf += 2;
 			jbufsize -= 2;
 		}
@@ -248,22 +291,28 @@ int __wt_json_alloc_unpack(WT_SESSION_IMPL *session, const void *buffer,
 {
 	WT_CONFIG_ITEM *names;
 	WT_DECL_RET;
-	size_t needed;
+	size_t *allocp, needed;
 	char **json_bufp;
 
 	if (iskey) {
 		names = &json->key_names;
 		json_bufp = &json->key_buf;
+		allocp = &json->key_buf_alloc;
 	} else {
 		names = &json->value_names;
 		json_bufp = &json->value_buf;
+		allocp = &json->value_buf_alloc;
 	}
 	needed = 0;
 	WT_RET(__json_struct_size(session, buffer, size, fmt, names,
 	    iskey, &needed));
-	WT_RET(__wt_realloc(session, NULL, needed + 1, json_bufp));
+
+	/*cursorڸãֻڲʱչunpackstrncatҪ*/
+	if (needed + 1 > *allocp)
+		WT_RET(__wt_realloc(session, allocp, needed + 1, json_bufp));
+	**json_bufp = '\0';
 	WT_RET(__json_struct_unpackv(session, buffer, size, fmt,
-	    names, (u_char *)*json_bufp, needed + 1, iskey, ap));
+	    names, (u_char *)*json_bufp, needed + 1, iskey, json->oneline ? ", " : ",\n", ap));
 
 	return (ret);
 }
@@ -437,7 +486,7 @@ int __wt_json_token(WT_SESSION *wt_session, const char *src, int *toktype,
 	WT_SESSION_IMPL *session;
 	char ch;
 	const char *bad;
-	int backslash, isalph, isfloat, result;
+	int isalph, isfloat, result;
 
 	result = -1;
 	session = (WT_SESSION_IMPL *)wt_session;
@@ -454,33 +503,32 @@ int __wt_json_token(WT_SESSION *wt_session, const char *src, int *toktype,
 	/* JSON is specified in RFC 4627. */
 	switch (*src) {
 	case '"':
-		backslash = 0;
 		src++;
-		while ((ch = *src) != '\0') {
-			if (!backslash) {
-				if (ch == '"') {
-					src++;
-					result = 's';
-					break;
-				}
-				if (ch == '\\')
-					backslash = 1;
-			} else {
-				/* We validate Unicode on this pass. */
-				if (ch == 'u') {
-					u_char ignored;
-					const u_char *uc;
-
-					uc = (const u_char *)src;
-					if (__wt_hex2byte(&uc[1], &ignored) ||
-					    __wt_hex2byte(&uc[3], &ignored)) {
-						__wt_errx(session,
-				    "invalid Unicode within JSON string");
-						return (-1);
-					}
-					src += 5;
+		for (;;) {
+			/*Ҫת崦ֽ*/
+			src = __json_scan_string(src);
+			if (*src == '"') {
+				src++;
+				result = 's';
+				break;
+			}
+			if (*src == '\0' || *++src == '\0')
+				break;
+
+			/* We validate Unicode on this pass. */
+			if (*src == 'u') {
+				u_char ignored;
+				const u_char *uc;
+
+				uc = (const u_char *)src;
+				if (__wt_hex2byte(&uc[1], &ignored) ||
+				    __wt_hex2byte(&uc[3], &ignored)) {
+					__wt_errx(session,
+			    "invalid Unicode within JSON string");
+					return (-1);
 				}
-				backslash = 0;
+				/*ͣһhexַϣsrc++Խ*/
+				src += 4;
 			}
 			src++;
 		}
@@ -795,17 +843,25 @@ int __wt_json_to_item(WT_SESSION_IMPL *session, const char *jstr,
 /*
  * __wt_json_strlen --
  *	Return the number of bytes represented by a string in JSON format,
- *	or -1 if the format is incorrect.
+ *	or -1 if the format is incorrect.  The source is the inside of a JSON
+ *	string token, it is followed by the closing quote.
  */
 ssize_t __wt_json_strlen(const char *src, size_t srclen)
 {
-	const char *srcend;
+	const char *run, *srcend;
 	size_t dstlen;
 	u_char hi, lo;
 
 	dstlen = 0;
 	srcend = src + srclen;
 	while (src < srcend) {
+		/*Ҫתֽμ*/
+		if ((run = __json_scan_string(src)) > srcend)
+			run = srcend;
+		dstlen += WT_PTRDIFF(run, src);
+		if ((src = run) == srcend)
+			break;
+
 		/* JSON can include any UTF-8 expressed in 4 hex chars. */
 		if (*src == '\\') {
 			if (*++src == 'u') {
@@ -814,7 +870,8 @@ ssize_t __wt_json_strlen(const char *src, size_t srclen)
 				src += 2;
 				if (__wt_hex2byte((const u_char *)src, &lo))
 					return (-1);
-				src += 2;
+				/*ͣһhexַ*/
+				++src;
 				/* RFC 3629 */
 				if (hi >= 0x8) {
 					/* 3 bytes total */
@@ -844,13 +901,25 @@ ssize_t __wt_json_strlen(const char *src, size_t srclen)
 int __wt_json_strncpy(char **pdst, size_t dstlen, const char *src, size_t srclen)
 {
 	char *dst;
-	const char *dstend, *srcend;
+	const char *dstend, *run, *srcend;
+	size_t len;
 	u_char hi, lo;
 
 	dst = *pdst;
 	dstend = dst + dstlen;
 	srcend = src + srclen;
 	while (src < srcend && dst < dstend) {
+		/*Ҫתֽο*/
+		if ((run = __json_scan_string(src)) > srcend)
+			run = srcend;
+		if ((len = WT_PTRDIFF(run, src)) > WT_PTRDIFF(dstend, dst))
+			len = WT_PTRDIFF(dstend, dst);
+		memcpy(dst, src, len);
+		dst += len;
+		src += len;
+		if (src == srcend || dst == dstend)
+			break;
+
 		/* JSON can include any UTF-8 expressed in 4 hex chars. */
 		if (*src == '\\') {
 			if (*++src == 'u') {
@@ -859,7 +928,8 @@ int __wt_json_strncpy(char **pdst, size_t dstlen, const char *src, size_t srclen
 				src += 2;
 				if (__wt_hex2byte((const u_char *)src, &lo))
 					return (EINVAL);
-				src += 2;
+				/*ͣһhexַ*/
+				++src;
 				/* RFC 3629 */
 				if (hi >= 0x8) {
 					/* 3 bytes total */
@@ -886,7 +956,27 @@ int __wt_json_strncpy(char **pdst, size_t dstlen, const char *src, size_t srclen
 					*dst++ = (char)lo;
 			}
 			else
-				*dst++ = *src;
+				/*__wt_json_unpack_charдתӦ*/
+				switch (*src) {
+				case 'b':
+					*dst++ = '\b';
+					break;
+				case 'f':
+					*dst++ = '\f';
+					break;
+				case 'n':
+					*dst++ = '\n';
+					break;
+				case 'r':
+					*dst++ = '\r';
+					break;
+				case 't':
+					*dst++ = '\t';
+					break;
+				default:
+					*dst++ = *src;
+					break;
+				}
 		} else
 			*dst++ = *src;
 		src++;
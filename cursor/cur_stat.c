@@ -351,8 +351,10 @@ static void __curstat_conn_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
 	 */
 	__wt_conn_stat_init(session);
 	cst->u.conn_stats = conn->stats;
-	if (F_ISSET(cst, WT_CONN_STAT_CLEAR))
-		__wt_stat_refresh_connection_stats(&conn->stats);
+	if (F_ISSET(cst, WT_CONN_STAT_CLEAR)) {
+		__wt_conn_stat_refresh(session);
+		__wt_latency_clear(session);
+	}
 
 	cst->stats_first = cst->stats = (WT_STATS *)&cst->u.conn_stats;
 	cst->stats_base = WT_CONNECTION_STATS_BASE;
@@ -497,6 +499,15 @@ int __wt_curstat_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg
 		}
 		WT_ERR_NOTFOUND_OK(ret);
 
+		/*sample: ͨԴͳƣ*/
+		if ((ret = __wt_config_subgets(session, &cval, "sample", &sval)) == 0 && sval.val != 0) {
+			if (F_ISSET(cst, WT_CONN_STAT_ALL))
+				WT_ERR_MSG(session, EINVAL, "only one statistics configuration value may be specified");
+
+			F_SET(cst, WT_CONN_STAT_FAST | WT_CONN_STAT_SAMPLE);
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+
 		if ((ret = __wt_config_subgets(session, &cval, "clear", &sval)) == 0 && sval.val != 0)
 			F_SET(cst, WT_CONN_STAT_CLEAR);
 
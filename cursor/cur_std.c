@@ -30,6 +30,8 @@ void __wt_cursor_set_notsup(WT_CURSOR* cursor)
 	cursor->insert = __wt_cursor_notsup;
 	cursor->update = __wt_cursor_notsup;
 	cursor->remove = __wt_cursor_notsup;
+	cursor->search_batch = (int (*)(WT_CURSOR *, const WT_ITEM *, WT_ITEM *, int *, uint32_t))__wt_cursor_notsup;
+	cursor->insert_batch = (int (*)(WT_CURSOR *, const WT_ITEM *, const WT_ITEM *, uint32_t))__wt_cursor_notsup;
 }
 
 /*kvĴϢ*/
@@ -132,6 +134,7 @@ int __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
 {
 	WT_DECL_RET;
 	WT_ITEM *key;
+	WT_PACK_COMPILED *pc;
 	WT_SESSION_IMPL *session;
 	size_t size;
 	const char *fmt;
@@ -163,8 +166,10 @@ int __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
 		} 
 		else if (WT_STREQ(fmt, "S"))
 			*va_arg(ap, const char **) = cursor->key.data;
-		else
-			ret = __wt_struct_unpackv(session, cursor->key.data, cursor->key.size, fmt, ap);
+		else {
+			WT_ERR(__wt_cursor_pack_compiled(session, cursor, 1, &pc));
+			ret = __wt_struct_unpackv_compiled(session, pc, cursor->key.data, cursor->key.size, ap);
+		}
 	}
 
 err:
@@ -174,6 +179,7 @@ err:
 void __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
 {
 	WT_DECL_RET;
+	WT_PACK_COMPILED *pc;
 	WT_SESSION_IMPL *session;
 	WT_ITEM *buf, *item, tmp;
 	size_t sz;
@@ -221,13 +227,19 @@ void __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
 			buf->data = (void *)str;
 		} 
 		else {
-			va_copy(ap_copy, ap);
-			ret = __wt_struct_sizev(session, &sz, cursor->key_format, ap_copy);
-			va_end(ap_copy);
-			WT_ERR(ret);
+			/*ʽҪfield㳤*/
+			WT_ERR(__wt_cursor_pack_compiled(session, cursor, 1, &pc));
+			if (pc->fixed)
+				sz = pc->fixed_len;
+			else {
+				va_copy(ap_copy, ap);
+				ret = __wt_struct_sizev_compiled(session, pc, &sz, ap_copy);
+				va_end(ap_copy);
+				WT_ERR(ret);
+			}
 
 			WT_ERR(__wt_buf_initsize(session, buf, sz));
-			WT_ERR(__wt_struct_packv(session, buf->mem, sz, cursor->key_format, ap));
+			WT_ERR(__wt_struct_packv_compiled(session, pc, buf->mem, sz, ap));
 		}
 	}
 
@@ -278,6 +290,7 @@ int __wt_cursor_get_valuev(WT_CURSOR *cursor, va_list ap)
 {
 	WT_DECL_RET;
 	WT_ITEM *value;
+	WT_PACK_COMPILED *pc;
 	WT_SESSION_IMPL *session;
 	const char *fmt;
 
@@ -297,8 +310,10 @@ int __wt_cursor_get_valuev(WT_CURSOR *cursor, va_list ap)
 		*va_arg(ap, const char **) = cursor->value.data;
 	else if (WT_STREQ(fmt, "t") ||(isdigit(fmt[0]) && WT_STREQ(fmt + 1, "t")))
 		*va_arg(ap, uint8_t *) = *(uint8_t *)cursor->value.data;
-	else
-		ret = __wt_struct_unpackv(session, cursor->value.data, cursor->value.size, fmt, ap);
+	else {
+		WT_ERR(__wt_cursor_pack_compiled(session, cursor, 0, &pc));
+		ret = __wt_struct_unpackv_compiled(session, pc, cursor->value.data, cursor->value.size, ap);
+	}
 
 err:	
 	API_END_RET(session, ret);
@@ -318,6 +333,7 @@ void __wt_cursor_set_valuev(WT_CURSOR *cursor, va_list ap)
 {
 	WT_DECL_RET;
 	WT_ITEM *buf, *item, tmp;
+	WT_PACK_COMPILED *pc;
 	WT_SESSION_IMPL *session;
 	const char *fmt, *str;
 	va_list ap_copy;
@@ -353,13 +369,18 @@ void __wt_cursor_set_valuev(WT_CURSOR *cursor, va_list ap)
 		*(uint8_t *)buf->mem = (uint8_t)va_arg(ap, int);
 	} 
 	else {
-		va_copy(ap_copy, ap);
-		ret = __wt_struct_sizev(session, &sz, cursor->value_format, ap_copy);
-		va_end(ap_copy);
+		WT_ERR(__wt_cursor_pack_compiled(session, cursor, 0, &pc));
+		if (pc->fixed)
+			sz = pc->fixed_len;
+		else {
+			va_copy(ap_copy, ap);
+			ret = __wt_struct_sizev_compiled(session, pc, &sz, ap_copy);
+			va_end(ap_copy);
+			WT_ERR(ret);
+		}
 
-		WT_ERR(ret);
 		WT_ERR(__wt_buf_initsize(session, buf, sz));
-		WT_ERR(__wt_struct_packv(session, buf->mem, sz, cursor->value_format, ap));
+		WT_ERR(__wt_struct_packv_compiled(session, pc, buf->mem, sz, ap));
 	}
 	F_SET(cursor, WT_CURSTD_VALUE_EXT);
 	buf->size = sz;
@@ -382,6 +403,32 @@ err:
 	API_END(session, ret);
 }
 
+/*
+ * __wt_cursor_pack_compiled --
+ *	Return the compiled key or value format of a cursor.  Compiled formats
+ * are cached in the session, indexed by the address of the format string,
+ * which belongs to the cursor's btree or table.  The string of a closed object
+ * can be freed and its memory reused, so a hit is checked against the copy
+ * kept in the compiled format.  The result is only valid until the session
+ * compiles another format.
+ */
+int __wt_cursor_pack_compiled(WT_SESSION_IMPL* session, WT_CURSOR* cursor, int key, WT_PACK_COMPILED** pcp)
+{
+	WT_PACK_COMPILED **slotp;
+	const char *fmt;
+
+	fmt = key ? cursor->key_format : cursor->value_format;
+	slotp = &session->pack_cache[((uintptr_t)fmt >> 3) % WT_SESSION_PACK_CACHE];
+
+	if (*slotp != NULL && ((*slotp)->src != fmt || strcmp((*slotp)->fmt, fmt) != 0))
+		__wt_struct_compiled_free(session, slotp);
+	if (*slotp == NULL)
+		WT_RET(__wt_struct_compile(session, fmt, slotp));
+
+	*pcp = *slotp;
+	return (0);
+}
+
 /*رcursor*/
 int __wt_cursor_close(WT_CURSOR *cursor)
 {
@@ -392,6 +439,7 @@ int __wt_cursor_close(WT_CURSOR *cursor)
 	/*ͷŴ洢key/valueֵĻ*/
 	__wt_buf_free(session, &cursor->key);
 	__wt_buf_free(session, &cursor->value);
+	__wt_buf_free(session, &cursor->batch_values);
 
 	if (F_ISSET(cursor, WT_CURSTD_OPEN)) {
 		TAILQ_REMOVE(&session->cursors, cursor, q);
@@ -399,7 +447,12 @@ int __wt_cursor_close(WT_CURSOR *cursor)
 		WT_STAT_FAST_DATA_DECR(session, session_cursor_open);
 		WT_STAT_FAST_CONN_ATOMIC_DECR(session, session_cursor_open);
 	}
+	else if (F_ISSET(cursor, WT_CURSTD_CACHED) && cursor->cache_key != NULL) { /*cursor cacheеcursor*/
+		TAILQ_REMOVE(&session->cursor_cache[cursor->uri_hash % WT_HASH_ARRAY_SIZE], cursor, q);
+		--session->ncursors_cached;
+	}
 
+	__wt_free(session, cursor->cache_key);
 	__wt_free(session, cursor->internal_uri);
 	__wt_free(session, cursor->uri);
 	__wt_overwrite_and_free(session, cursor);
@@ -407,6 +460,179 @@ int __wt_cursor_close(WT_CURSOR *cursor)
 	return ret;
 }
 
+/*жϻcursorǷuriconfig򿪵*/
+static int __cursor_cache_match(WT_CURSOR* cursor, const char* uri, const char* config)
+{
+	size_t len;
+
+	len = strlen(uri);
+	return (strncmp(cursor->cache_key, uri, len) == 0 && cursor->cache_key[len] == '\0' && strcmp(cursor->cache_key + len + 1, config) == 0);
+}
+
+/*
+ * __wt_cursor_cache_key --
+ *	Mark a newly opened cursor as cacheable: remember the URI and the
+ * configuration it was opened with, so closing it parks it in the session's
+ * cursor cache and an identical open can revive it.
+ */
+int __wt_cursor_cache_key(WT_CURSOR* cursor, const char* uri, const char* config)
+{
+	WT_SESSION_IMPL *session;
+	size_t len, clen;
+	char *key;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+	if (config == NULL)
+		config = "";
+
+	/*keyĸʽ uri\0config\0*/
+	len = strlen(uri);
+	clen = strlen(config);
+	WT_RET(__wt_calloc_def(session, len + clen + 2, &key));
+	memcpy(key, uri, len);
+	memcpy(key + len + 1, config, clen);
+
+	cursor->cache_key = key;
+	cursor->uri_hash = __wt_hash_city64(uri, len);
+	F_SET(cursor, WT_CURSTD_CACHEABLE);
+
+	return 0;
+}
+
+/*
+ * __wt_cursor_cache --
+ *	Park a cursor being closed in the session's cursor cache.  Returns EBUSY
+ * if the session isn't caching cursors or the cache is full, the caller then
+ * closes the cursor for real.
+ */
+int __wt_cursor_cache(WT_CURSOR* cursor)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+	if (!F_ISSET(session, WT_SESSION_CACHE_CURSORS) || session->ncursors_cached >= WT_SESSION_CURSOR_CACHE_MAX)
+		return EBUSY;
+
+	WT_RET(cursor->reset(cursor));
+
+	/*sessionĴ򿪶Ƶcursor cacheУkey/valueĻ´ʹ*/
+	TAILQ_REMOVE(&session->cursors, cursor, q);
+	TAILQ_INSERT_HEAD(&session->cursor_cache[cursor->uri_hash % WT_HASH_ARRAY_SIZE], cursor, q);
+	F_CLR(cursor, WT_CURSTD_OPEN);
+	F_SET(cursor, WT_CURSTD_CACHED);
+	++session->ncursors_cached;
+
+	WT_STAT_FAST_DATA_DECR(session, session_cursor_open);
+	WT_STAT_FAST_CONN_ATOMIC_DECR(session, session_cursor_open);
+	WT_STAT_FAST_CONN_INCR(session, cursor_cache);
+
+	return 0;
+}
+
+/*cursorcursor cacheƻsessionĴ򿪶*/
+void __wt_cursor_reopen(WT_CURSOR* cursor)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	TAILQ_REMOVE(&session->cursor_cache[cursor->uri_hash % WT_HASH_ARRAY_SIZE], cursor, q);
+	--session->ncursors_cached;
+	TAILQ_INSERT_HEAD(&session->cursors, cursor, q);
+	F_CLR(cursor, WT_CURSTD_CACHED);
+	F_SET(cursor, WT_CURSTD_OPEN);
+
+	WT_STAT_FAST_DATA_INCR(session, session_cursor_open);
+	WT_STAT_FAST_CONN_ATOMIC_INCR(session, session_cursor_open);
+	WT_STAT_FAST_CONN_INCR(session, cursor_reopen);
+}
+
+/*ownerʱcursor(colgroup/index)ֻӴ򿪶Ƴcursor cache*/
+void __wt_cursor_cache_child(WT_CURSOR* cursor)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	TAILQ_REMOVE(&session->cursors, cursor, q);
+	F_CLR(cursor, WT_CURSTD_OPEN);
+	F_SET(cursor, WT_CURSTD_CACHED);
+
+	WT_STAT_FAST_DATA_DECR(session, session_cursor_open);
+	WT_STAT_FAST_CONN_ATOMIC_DECR(session, session_cursor_open);
+}
+
+/*owner´ʱcursorŻش򿪶ownerĺ*/
+void __wt_cursor_reopen_child(WT_CURSOR* owner, WT_CURSOR* cursor)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	TAILQ_INSERT_AFTER(&session->cursors, owner, cursor, q);
+	F_CLR(cursor, WT_CURSTD_CACHED);
+	F_SET(cursor, WT_CURSTD_OPEN);
+
+	WT_STAT_FAST_DATA_INCR(session, session_cursor_open);
+	WT_STAT_FAST_CONN_ATOMIC_INCR(session, session_cursor_open);
+}
+
+/*
+ * __wt_cursor_cache_get --
+ *	Look for a cursor opened on the same URI with the same configuration in
+ * the session's cursor cache and revive it.  A cached cursor whose handle was
+ * closed, reopened or is busy is discarded and WT_NOTFOUND returned so the
+ * caller opens a new one.
+ */
+int __wt_cursor_cache_get(WT_SESSION_IMPL* session, const char* uri, const char* config, WT_CURSOR** cursorp)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	uint64_t hash;
+
+	*cursorp = NULL;
+	if (session->ncursors_cached == 0)
+		return WT_NOTFOUND;
+	if (config == NULL)
+		config = "";
+
+	hash = __wt_hash_city64(uri, strlen(uri));
+	TAILQ_FOREACH(cursor, &session->cursor_cache[hash % WT_HASH_ARRAY_SIZE], q) {
+		if (cursor->uri_hash != hash || !__cursor_cache_match(cursor, uri, config))
+			continue;
+
+		if ((ret = cursor->reopen(cursor)) == 0) {
+			*cursorp = cursor;
+			return 0;
+		}
+
+		F_CLR(cursor, WT_CURSTD_CACHEABLE);
+		WT_TRET(cursor->close(cursor));
+		return (ret == EBUSY ? WT_NOTFOUND : ret);
+	}
+
+	return WT_NOTFOUND;
+}
+
+/*رsession cursor cacheеcursor*/
+int __wt_cursor_cache_discard(WT_SESSION_IMPL* session)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	u_int i;
+
+	if (session->cursor_cache == NULL)
+		return 0;
+
+	for (i = 0; i < WT_HASH_ARRAY_SIZE && session->ncursors_cached > 0; ++i)
+		while ((cursor = TAILQ_FIRST(&session->cursor_cache[i])) != NULL) {
+			F_CLR(cursor, WT_CURSTD_CACHEABLE);
+			WT_TRET(cursor->close(cursor));
+		}
+
+	return ret;
+}
+
 /*жcursorǷȣֵΪequalpequalp = 1ʾ,0ʾ*/
 int __wt_cursor_equals(WT_CURSOR* cursor, WT_CURSOR* other, int* equalp)
 {
@@ -437,6 +663,9 @@ int __wt_cursor_reconfigure(WT_CURSOR *cursor, const char *config)
 	/*cursor*/
 	WT_RET(cursor->reset(cursor));
 
+	/*ùcursorʱòһ£ٷcursor cache*/
+	F_CLR(cursor, WT_CURSTD_CACHEABLE);
+
 	/*appendӦʽ洢*/
 	if (WT_CURSOR_RECNO(cursor)) {
 		/*Ϣȡappend*/
@@ -478,6 +707,120 @@ int __wt_cursor_dup_position(WT_CURSOR *to_dup, WT_CURSOR *cursor)
 	return 0;
 }
 
+/*һvalue׷ӵcursorvalue·䣬valueĵַѯʱͳһ*/
+int __wt_cursor_batch_value(WT_SESSION_IMPL* session, WT_CURSOR* cursor, const WT_ITEM* value, WT_ITEM* out)
+{
+	WT_ITEM *buf;
+
+	buf = &cursor->batch_values;
+	WT_RET(__wt_buf_extend(session, buf, buf->size + value->size));
+	if (value->size != 0)
+		memcpy((uint8_t *)buf->mem + buf->size, value->data, value->size);
+	buf->size += value->size;
+
+	out->data = NULL;
+	out->size = value->size;
+	return 0;
+}
+
+/*
+ * __wt_cursor_batch_fixup --
+ *	Point the values found by a batch search into the cursor's batch buffer.
+ * The values were appended in the order the keys were searched: the input
+ * order, or the sort order if one is given.
+ */
+void __wt_cursor_batch_fixup(WT_CURSOR* cursor, WT_ITEM* values, const int* results, const uint32_t* order, uint32_t count)
+{
+	const uint8_t *p;
+	uint32_t i, slot;
+
+	p = cursor->batch_values.data;
+	for (i = 0; i < count; ++i) {
+		slot = (order == NULL) ? i : order[i];
+		if (results[slot] == 0) {
+			values[slot].data = p;
+			p += values[slot].size;
+		}
+	}
+}
+
+/*
+ * __wt_cursor_search_batch --
+ *	WT_CURSOR::search_batch for cursors without a batch implementation of
+ * their own: search each key in turn.
+ */
+int __wt_cursor_search_batch(WT_CURSOR* cursor, const WT_ITEM* keys, WT_ITEM* values, int* results, uint32_t count)
+{
+	WT_DECL_RET;
+	WT_ITEM value;
+	WT_SESSION_IMPL *session;
+	uint32_t i;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+	WT_RET(__wt_buf_init(session, &cursor->batch_values, 0));
+
+	for (i = 0; i < count; ++i) {
+		__wt_cursor_set_raw_key(cursor, (WT_ITEM *)&keys[i]);
+		if ((ret = cursor->search(cursor)) == WT_NOTFOUND) {
+			results[i] = WT_NOTFOUND;
+			values[i].data = NULL;
+			values[i].size = 0;
+			ret = 0;
+			continue;
+		}
+		WT_ERR(ret);
+
+		WT_ERR(__wt_cursor_get_raw_value(cursor, &value));
+		WT_ERR(__wt_cursor_batch_value(session, cursor, &value, &values[i]));
+		results[i] = 0;
+	}
+	__wt_cursor_batch_fixup(cursor, values, results, NULL, count);
+
+err:
+	WT_TRET(cursor->reset(cursor));
+	return ret;
+}
+
+/*
+ * __wt_cursor_insert_batch --
+ *	WT_CURSOR::insert_batch for cursors without a batch implementation of
+ * their own.  Outside of an application transaction the inserts are wrapped
+ * in a single transaction, the batch commits or rolls back as a whole and is
+ * written to the log as one record.
+ */
+int __wt_cursor_insert_batch(WT_CURSOR* cursor, const WT_ITEM* keys, const WT_ITEM* values, uint32_t count)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	uint32_t i;
+	int autotxn;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	autotxn = 0;
+	if (!F_ISSET(&session->txn, TXN_RUNNING)) {
+		WT_RET(__wt_txn_begin(session, NULL));
+		autotxn = 1;
+	}
+
+	for (i = 0; i < count; ++i) {
+		__wt_cursor_set_raw_key(cursor, (WT_ITEM *)&keys[i]);
+		__wt_cursor_set_raw_value(cursor, (WT_ITEM *)&values[i]);
+		WT_ERR(cursor->insert(cursor));
+	}
+
+err:
+	WT_TRET(cursor->reset(cursor));
+	if (autotxn) {
+		if (ret == 0)
+			ret = __wt_txn_commit(session, NULL);
+		else
+			WT_TRET(__wt_txn_rollback(session, NULL));
+	}
+
+	return ret;
+}
+
 /*cursorгʼ*/
 int __wt_cursor_init(WT_CURSOR *cursor, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp)
 {
@@ -503,6 +846,7 @@ int __wt_cursor_init(WT_CURSOR *cursor, const char *uri, WT_CURSOR *owner, const
 		cursor->insert = __wt_cursor_notsup;
 		cursor->update = __wt_cursor_notsup;
 		cursor->remove = __wt_cursor_notsup;
+		cursor->insert_batch = (int (*)(WT_CURSOR *, const WT_ITEM *, const WT_ITEM *, uint32_t))__wt_cursor_notsup;
 	} 
 	else {
 		WT_RET(__wt_config_gets_def(session, cfg, "readonly", 0, &cval));
@@ -510,6 +854,7 @@ int __wt_cursor_init(WT_CURSOR *cursor, const char *uri, WT_CURSOR *owner, const
 			cursor->insert = __wt_cursor_notsup;
 			cursor->update = __wt_cursor_notsup;
 			cursor->remove = __wt_cursor_notsup;
+			cursor->insert_batch = (int (*)(WT_CURSOR *, const WT_ITEM *, const WT_ITEM *, uint32_t))__wt_cursor_notsup;
 		}
 	}
 
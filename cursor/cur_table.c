@@ -1,6 +1,7 @@
 
 #include "wt_internal.h"
 
+static int __curtable_insert(WT_CURSOR* cursor);
 static int __curtable_open_indices(WT_CURSOR_TABLE* ctable);
 static int __curtable_update(WT_CURSOR* cursor);
 
@@ -20,9 +21,63 @@ typedef struct
 	WT_CURSOR			iface;
 	WT_CURSOR_TABLE*	ctable;
 	WT_CURSOR*			idxc;
+	WT_INDEX_BATCH*		batch;
 	int	(*f)(WT_CURSOR*);
 }WT_CURSOR_EXTRACTOR;
 
+/*һkey׷ӵbuffer*/
+static int __idx_batch_add(WT_SESSION_IMPL* session, WT_INDEX_BATCH* batch, const WT_ITEM* key)
+{
+	WT_RET(__wt_realloc_def(session, &batch->offs_alloc, batch->entries + 1, &batch->offs));
+	WT_RET(__wt_buf_grow(session, &batch->keys, batch->keys.size + key->size));
+
+	batch->offs[batch->entries++] = batch->keys.size;
+	memcpy((uint8_t *)batch->keys.mem + batch->keys.size, key->data, key->size);
+	batch->keys.size += key->size;
+
+	return 0;
+}
+
+/*key*/
+static void __idx_batch_clear(WT_INDEX_BATCH* batch)
+{
+	batch->entries = 0;
+	batch->keys.size = 0;
+}
+
+/*collatorԵϵĹ鲢tmpitemsĳͬ*/
+static int __idx_batch_sort(WT_SESSION_IMPL* session, WT_COLLATOR* collator, WT_ITEM* items, WT_ITEM* tmp, uint32_t n)
+{
+	WT_ITEM *dst, *src, *t;
+	uint32_t i, j, k, hi, lo, mid, width;
+	int cmp;
+
+	src = items;
+	dst = tmp;
+	for (width = 1; width < n; width *= 2) {
+		for (lo = 0; lo < n; lo += 2 * width) {
+			mid = WT_MIN(lo + width, n);
+			hi = WT_MIN(lo + 2 * width, n);
+			for (i = lo, j = mid, k = lo; k < hi; ++k) {
+				if (i == mid)
+					cmp = 1;
+				else if (j == hi)
+					cmp = -1;
+				else
+					WT_RET(__wt_compare(session, collator, &src[i], &src[j], &cmp));
+				dst[k] = (cmp <= 0) ? src[i++] : src[j++];
+			}
+		}
+		t = src;
+		src = dst;
+		dst = t;
+	}
+
+	if (src != items)
+		memcpy(items, src, n * sizeof(WT_ITEM));
+	return 0;
+}
+
 /*һextractor keykeyõextractor cursorУжӦextractor*/
 static int __curextract_insert(WT_CURSOR* cursor)
 {
@@ -31,7 +86,7 @@ static int __curextract_insert(WT_CURSOR* cursor)
 	WT_SESSION_IMPL *session;
 
 	cextract = (WT_CURSOR_EXTRACTOR *)cursor;
-	session = (WT_SESSION_IMPL *)cursor;
+	session = (WT_SESSION_IMPL *)cursor->session;
 
 	WT_ITEM_SET(ikey, cursor->key);
 
@@ -43,13 +98,16 @@ static int __curextract_insert(WT_CURSOR* cursor)
 	--ikey.size;
 	WT_RET(__wt_cursor_get_raw_key(cextract->ctable->cg_cursors[0], &pkey));
 
-	/*index cursorkeyֵΪextractor keycolgroup cursor keyƴ*/
-	key = &cextract->idxc->key;
+	/*index cursorkeyֵΪextractor keycolgroup cursor keyƴ, ģʽƴӵextractor cursorԼkey*/
+	key = (cextract->batch != NULL) ? &cursor->value : &cextract->idxc->key;
 	WT_RET(__wt_buf_grow(session, key, ikey.size + pkey.size));
 	memcpy((uint8_t *)key->mem, ikey.data, ikey.size);
 	memcpy((uint8_t *)key->mem + ikey.size, pkey.data, pkey.size);
 	key->size = ikey.size + pkey.size;
 
+	if (cextract->batch != NULL)
+		return (__idx_batch_add(session, cextract->batch, key));
+
 	/*cextractor key*/
 	F_SET(cextract->idxc, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
 
@@ -57,6 +115,175 @@ static int __curextract_insert(WT_CURSOR* cursor)
 	return (cextract->f(cextract->idxc));
 }
 
+/*
+ * __curtable_idx_cursor --
+ *	Return the cursor for the i-th index.  Bulk table cursors open their
+ * index cursors lazily and never in bulk mode, they only run batches that
+ * didn't fit in memory.
+ */
+static int __curtable_idx_cursor(WT_CURSOR_TABLE* ctable, u_int i, WT_CURSOR** cp)
+{
+	WT_SESSION_IMPL *session;
+	const char *cfg[] = { NULL, NULL, "bulk=false", NULL };
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+	if ((*cp = ctable->idx_cursors[i]) != NULL)
+		return 0;
+
+	cfg[0] = ctable->cfg[0];
+	cfg[1] = ctable->cfg[1];
+	WT_RET(__wt_open_cursor(session, ctable->table->indices[i]->source, &ctable->iface, cfg, &ctable->idx_cursors[i]));
+	*cp = ctable->idx_cursors[i];
+	return 0;
+}
+
+/*
+ * __curtable_idx_batch_apply --
+ *	Sort the keys buffered for the i-th index and write them in key order.
+ * When a bulk-loaded table cursor closes and nothing was written to the index
+ * yet, the index is still empty and is built with a bulk cursor.
+ */
+static int __curtable_idx_batch_apply(WT_CURSOR_TABLE* ctable, u_int i, int final)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_INDEX *idx;
+	WT_INDEX_BATCH *batch;
+	WT_ITEM *items, *prev;
+	WT_SESSION_IMPL *session;
+	uint32_t n;
+	int bulk, cmp;
+	const char *cfg[] = { NULL, "bulk", NULL };
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+	idx = ctable->table->indices[i];
+	batch = &ctable->idx_batch[i];
+	c = NULL;
+	items = NULL;
+	bulk = 0;
+
+	if (batch->entries == 0)
+		return 0;
+
+	/*keybufferβӴŵģָǵWT_ITEM*/
+	WT_ERR(__wt_calloc_def(session, 2 * (size_t)batch->entries, &items));
+	for (n = 0; n < batch->entries; ++n) {
+		items[n].data = (uint8_t *)batch->keys.mem + batch->offs[n];
+		items[n].size = ((n + 1 < batch->entries) ? batch->offs[n + 1] : batch->keys.size) - batch->offs[n];
+	}
+	WT_ERR(__idx_batch_sort(session, idx->collator, items, items + batch->entries, batch->entries));
+
+	if (final && !batch->applied && F_ISSET(ctable->cg_cursors[0], WT_CURSTD_BULK)) {
+		cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+		ret = __wt_open_cursor(session, idx->source, &ctable->iface, cfg, &c);
+		/*Դ֧bulk loadindexΪգ˻صͨinsert*/
+		if (ret == EINVAL || ret == EBUSY || ret == ENOTSUP)
+			ret = 0;
+		else {
+			WT_ERR(ret);
+			bulk = 1;
+		}
+	}
+	if (!bulk)
+		WT_ERR(__curtable_idx_cursor(ctable, i, &c));
+
+	for (n = 0, prev = NULL; n < batch->entries; prev = &items[n], ++n) {
+		/*extractorͬһ¼ܲͬkeyֻдһ*/
+		if (prev != NULL) {
+			WT_ERR(__wt_compare(session, idx->collator, prev, &items[n], &cmp));
+			if (cmp == 0)
+				continue;
+		}
+
+		WT_ERR(__wt_buf_set(session, &c->key, items[n].data, items[n].size));
+		F_SET(c, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
+		WT_ERR(c->insert(c));
+	}
+	batch->applied = 1;
+
+err:
+	if (c != NULL) {
+		if (bulk)
+			WT_TRET(c->close(c));
+		else
+			WT_TRET(c->reset(c));
+	}
+	__wt_free(session, items);
+	__idx_batch_clear(batch);
+	return ret;
+}
+
+/*table cursorkeyд*/
+static int __curtable_idx_batch_flush(WT_CURSOR_TABLE* ctable, int final)
+{
+	u_int i;
+
+	if (ctable->idx_batch == NULL)
+		return 0;
+
+	for (i = 0; i < ctable->table->nindices; ++i)
+		WT_RET(__curtable_idx_batch_apply(ctable, i, final));
+	return 0;
+}
+
+/*
+ * __curtable_idx_batch_session --
+ *	Write out or discard the index keys buffered by the session's table
+ * cursors, only those on the given table if it isn't NULL.  Bulk cursors are
+ * skipped, their indices are built when they close.
+ */
+static int __curtable_idx_batch_session(WT_SESSION_IMPL* session, WT_TABLE* table, int commit)
+{
+	WT_CURSOR *cursor;
+	WT_CURSOR_TABLE *ctable;
+	WT_DECL_RET;
+	u_int i;
+
+	TAILQ_FOREACH(cursor, &session->cursors, q) {
+		if (cursor->insert != __curtable_insert)
+			continue;
+
+		ctable = (WT_CURSOR_TABLE *)cursor;
+		if (ctable->idx_batch == NULL || F_ISSET(ctable->cg_cursors[0], WT_CURSTD_BULK))
+			continue;
+		if (table != NULL && ctable->table != table)
+			continue;
+
+		if (commit)
+			WT_TRET(__curtable_idx_batch_flush(ctable, 0));
+		else {
+			for (i = 0; i < ctable->table->nindices; ++i)
+				__idx_batch_clear(&ctable->idx_batch[i]);
+		}
+	}
+
+	return ret;
+}
+
+/*
+ * __wt_curtable_idx_batch_txn --
+ *	Resolve the index keys buffered by the session's table cursors when a
+ * transaction commits or rolls back.
+ */
+int __wt_curtable_idx_batch_txn(WT_SESSION_IMPL* session, int commit)
+{
+	return (__curtable_idx_batch_session(session, NULL, commit));
+}
+
+/*
+ * __wt_curtable_idx_batch_read --
+ *	Write out the index keys buffered for a table before an index cursor of
+ * the same session reads one of its indices, so the transaction sees its own
+ * index entries.
+ */
+int __wt_curtable_idx_batch_read(WT_SESSION_IMPL* session, WT_TABLE* table)
+{
+	if (session->idx_batch_cursors == 0)
+		return 0;
+
+	return (__curtable_idx_batch_session(session, table, 1));
+}
+
 /*ñеindex cursorִһ,Ӧĺͨfunc_offλ*/
 static int __apply_idx(WT_CURSOR_TABLE* ctable, size_t func_off, int skip_immutable)
 {
@@ -79,8 +306,10 @@ static int __apply_idx(WT_CURSOR_TABLE* ctable, size_t func_off, int skip_immuta
 		__wt_cursor_notsup);	/* close */
 	WT_CURSOR **cp;
 	WT_CURSOR_EXTRACTOR extract_cursor;
+	WT_DECL_ITEM(tmp);
 	WT_DECL_RET;
 	WT_INDEX *idx;
+	WT_INDEX_BATCH *batch;
 	WT_ITEM key, value;
 	WT_SESSION_IMPL *session;
 	int (*f)(WT_CURSOR *);
@@ -91,39 +320,68 @@ static int __apply_idx(WT_CURSOR_TABLE* ctable, size_t func_off, int skip_immuta
 
 	for(i = 0; i < ctable->table->nindices; i++, cp++){
 		idx = ctable->table->indices[i];
-		if (skip_immutable && F_ISSET(idx, WT_INDEX_IMMUTABLE))
+		/*immutableֻ֤key䣬valueелǿܱ޸*/
+		if (skip_immutable && F_ISSET(idx, WT_INDEX_IMMUTABLE) && idx->inc_plan == NULL)
 			continue;
 
+		/*
+		 * Keys for new index entries are buffered in batch mode and sorted
+		 * when the transaction commits or the cursor closes.  Covering
+		 * indices also need a value, they're always updated directly.
+		 */
+		batch = NULL;
+		if (ctable->idx_batch != NULL && func_off == offsetof(WT_CURSOR, insert) && idx->inc_plan == NULL)
+			batch = &ctable->idx_batch[i];
+		else if (*cp == NULL)
+			WT_ERR(__curtable_idx_cursor(ctable, i, cp));
+
 		/*ȷִеĺ*/
-		f = *(int (**)(WT_CURSOR *))((uint8_t *)*cp + func_off);
+		f = (batch != NULL) ? NULL : *(int (**)(WT_CURSOR *))((uint8_t *)*cp + func_off);
 		if (idx->extractor) {
 			extract_cursor.iface = iface;
 			extract_cursor.iface.session = &session->iface;
 			extract_cursor.iface.key_format = idx->exkey_format;
 			extract_cursor.ctable = ctable;
 			extract_cursor.idxc = *cp;
+			extract_cursor.batch = batch;
 			extract_cursor.f = f;
 
-			WT_RET(__wt_cursor_get_raw_key(&ctable->iface, &key));
-			WT_RET(__wt_cursor_get_raw_value(&ctable->iface, &value));
+			WT_ERR(__wt_cursor_get_raw_key(&ctable->iface, &key));
+			WT_ERR(__wt_cursor_get_raw_value(&ctable->iface, &value));
 			ret = idx->extractor->extract(idx->extractor, &session->iface, &key, &value, &extract_cursor.iface);
 
 			__wt_buf_free(session, &extract_cursor.iface.key);
-			WT_RET(ret);
+			__wt_buf_free(session, &extract_cursor.iface.value);
+			WT_ERR(ret);
 		} 
+		else if (batch != NULL) {
+			if (tmp == NULL)
+				WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+			WT_ERR(__wt_schema_project_merge(session, ctable->cg_cursors, idx->key_plan, idx->key_format, tmp));
+			WT_ERR(__idx_batch_add(session, batch, tmp));
+		}
 		else {
-			WT_RET(__wt_schema_project_merge(session, ctable->cg_cursors, idx->key_plan, idx->key_format, &(*cp)->key));
+			WT_ERR(__wt_schema_project_merge(session, ctable->cg_cursors, idx->key_plan, idx->key_format, &(*cp)->key));
 			/*
 			 * The index key is now set and the value is empty
-			 * (it starts clear and is never set).
+			 * (it starts clear and is never set), except for
+			 * covering indices which store the included columns.
 			 */
+			if (idx->inc_plan != NULL && func_off == offsetof(WT_CURSOR, insert))
+				WT_ERR(__wt_schema_project_merge(session, ctable->cg_cursors, idx->inc_plan, (*cp)->value_format, &(*cp)->value));
 			F_SET(*cp, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
-			WT_RET(f(*cp));
+			WT_ERR(f(*cp));
 		}
-		WT_RET((*cp)->reset(*cp));
+
+		if (batch == NULL)
+			WT_ERR((*cp)->reset(*cp));
+		else if (ctable->idx_batch_max != 0 && batch->keys.size >= ctable->idx_batch_max)
+			WT_ERR(__curtable_idx_batch_apply(ctable, i, 0));
 	}
 
-	return 0;
+err:
+	__wt_scr_free(session, &tmp);
+	return ret;
 }
 
 /*ȡtable cursorkeyֵ*/
@@ -469,6 +727,8 @@ static int __curtable_update(WT_CURSOR* cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	CURSOR_UPDATE_API_CALL(cursor, session, update, NULL);
 	WT_ERR(__curtable_open_indices(ctable));
+	/*ɵkeyܻsessionκһcursorbufferУдɾ*/
+	WT_ERR(__curtable_idx_batch_session(session, ctable->table, 1));
 
 	/*
 	 * If the table has indices, first delete any old index keys, then
@@ -513,6 +773,7 @@ static int __curtable_remove(WT_CURSOR* cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	CURSOR_UPDATE_API_CALL(cursor, session, remove, NULL);
 	WT_ERR(__curtable_open_indices(ctable));
+	WT_ERR(__curtable_idx_batch_session(session, ctable->table, 1));
 
 	/* Find the old record so it can be removed from indices */
 	if (ctable->table->nindices > 0) {
@@ -546,6 +807,7 @@ int __wt_table_range_truncate(WT_CURSOR_TABLE* start, WT_CURSOR_TABLE* stop)
 
 	/* Open any indices. */
 	WT_RET(__curtable_open_indices(ctable));
+	WT_RET(__curtable_idx_batch_session(session, ctable->table, 1));
 	WT_RET(__wt_scr_alloc(session, 128, &key));
 
 	if(ctable->table->nindices > 0){
@@ -583,15 +845,95 @@ int __wt_table_range_truncate(WT_CURSOR_TABLE* start, WT_CURSOR_TABLE* stop)
 		}
 	}
 
-	/* Truncate the column groups. */
-	for (i = 0; i < WT_COLGROUPS(ctable->table); i++)
-		WT_ERR(__wt_range_truncate((start == NULL) ? NULL : start->cg_cursors[i], (stop == NULL) ? NULL : stop->cg_cursors[i]));
+	/* Truncate the column groups, LSM column groups write a range tombstone. */
+	for (i = 0; i < WT_COLGROUPS(ctable->table); i++) {
+		if (WT_PREFIX_MATCH(ctable->cg_cursors[i]->internal_uri, "lsm:"))
+			WT_ERR(__wt_clsm_range_truncate(session, (start == NULL) ? NULL : start->cg_cursors[i], (stop == NULL) ? NULL : stop->cg_cursors[i]));
+		else
+			WT_ERR(__wt_range_truncate((start == NULL) ? NULL : start->cg_cursors[i], (stop == NULL) ? NULL : stop->cg_cursors[i]));
+	}
 
 err:	
 	__wt_scr_free(session, &key);
 	return (ret);
 }
 
+/*table cursorcursorcolgroup cursorǰindex cursorں*/
+#define	WT_CURTABLE_CHILDREN(ctable)										\
+	(WT_COLGROUPS((ctable)->table) + ((ctable)->idx_cursors == NULL ? 0 : (ctable)->table->nindices))
+
+/*table cursorĵicursor*/
+static WT_CURSOR* __curtable_child(WT_CURSOR_TABLE* ctable, u_int i)
+{
+	if (i < WT_COLGROUPS(ctable->table))
+		return (ctable->cg_cursors[i]);
+	return (ctable->idx_cursors[i - WT_COLGROUPS(ctable->table)]);
+}
+
+/*
+ * __curtable_cache --
+ *	Park a table cursor in the session's cursor cache, together with its
+ * column group and index cursors.  Only tables whose column groups and
+ * indices are all plain files are cached.
+ */
+static int __curtable_cache(WT_CURSOR* cursor)
+{
+	WT_CURSOR *child;
+	WT_CURSOR_TABLE *ctable;
+	WT_DECL_RET;
+	u_int i;
+
+	ctable = (WT_CURSOR_TABLE *)cursor;
+
+	/*bulk cursorߵcloseload*/
+	if (F_ISSET(ctable->cg_cursors[0], WT_CURSTD_BULK))
+		return EBUSY;
+
+	for (i = 0; i < WT_CURTABLE_CHILDREN(ctable); ++i)
+		if ((child = __curtable_child(ctable, i)) != NULL && !WT_PREFIX_MATCH(child->internal_uri, "file:"))
+			return EBUSY;
+
+	/*index cursortable cursorãͷǿܳеpage*/
+	for (i = WT_COLGROUPS(ctable->table); i < WT_CURTABLE_CHILDREN(ctable); ++i)
+		if ((child = __curtable_child(ctable, i)) != NULL)
+			WT_RET(child->reset(child));
+
+	WT_RET(__wt_cursor_cache(cursor));
+	for (i = 0; i < WT_CURTABLE_CHILDREN(ctable); ++i)
+		if ((child = __curtable_child(ctable, i)) != NULL)
+			WT_TRET(__wt_curfile_cache_child(child));
+
+	return ret;
+}
+
+/*
+ * __curtable_reopen --
+ *	Revive a cached table cursor.  If a child can't be reopened the table
+ * cursor is left open with that child still cached, closing it releases
+ * everything correctly.
+ */
+static int __curtable_reopen(WT_CURSOR* cursor)
+{
+	WT_CURSOR *child;
+	WT_CURSOR_TABLE *ctable;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	ctable = (WT_CURSOR_TABLE *)cursor;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	/*ڼschema仯tableѾ*/
+	if (ctable->table->schema_gen != S2C(session)->schema_gen)
+		return WT_NOTFOUND;
+
+	__wt_cursor_reopen(cursor);
+	for (i = 0; i < WT_CURTABLE_CHILDREN(ctable); ++i)
+		if ((child = __curtable_child(ctable, i)) != NULL)
+			WT_RET(__wt_curfile_reopen_child(cursor, child));
+
+	return 0;
+}
+
 static int __curtable_close(WT_CURSOR *cursor)
 {
 	WT_CURSOR_TABLE *ctable;
@@ -603,6 +945,28 @@ static int __curtable_close(WT_CURSOR *cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	CURSOR_API_CALL(cursor, session, close, NULL);
 
+	/*
+	 * Write out any buffered index keys: a bulk cursor builds its indices
+	 * here, otherwise the keys belong to the running transaction and are
+	 * discarded if it has already failed.
+	 */
+	if (ctable->idx_batch != NULL) {
+		if (F_ISSET(&session->txn, TXN_ERROR) && !F_ISSET(ctable->cg_cursors[0], WT_CURSTD_BULK))
+			for (i = 0; i < ctable->table->nindices; ++i)
+				__idx_batch_clear(&ctable->idx_batch[i]);
+		else
+			WT_TRET(__curtable_idx_batch_flush(ctable, 1));
+	}
+
+	/*Իcursorsessioncursor cacheر; ܻʱ(EBUSY)ر*/
+	if (F_ISSET(cursor, WT_CURSTD_CACHEABLE)) {
+		ret = __curtable_cache(cursor);
+		if (F_ISSET(cursor, WT_CURSTD_CACHED))
+			goto err;
+		if (ret == EBUSY)
+			ret = 0;
+	}
+
 	/*رtablegolgroup cursor*/
 	for (i = 0, cp = ctable->cg_cursors; i < WT_COLGROUPS(ctable->table); i++, cp++){
 		if (*cp != NULL) {
@@ -632,6 +996,14 @@ static int __curtable_close(WT_CURSOR *cursor)
 	__wt_free(session, ctable->cg_cursors);
 	__wt_free(session, ctable->cg_valcopy);
 	__wt_free(session, ctable->idx_cursors);
+	if (ctable->idx_batch != NULL) {
+		for (i = 0; i < ctable->table->nindices; ++i) {
+			__wt_buf_free(session, &ctable->idx_batch[i].keys);
+			__wt_free(session, ctable->idx_batch[i].offs);
+		}
+		__wt_free(session, ctable->idx_batch);
+		--session->idx_batch_cursors;
+	}
 	__wt_schema_release_table(session, ctable->table);
 	/* The URI is owned by the table. */
 	cursor->internal_uri = NULL;
@@ -649,7 +1021,7 @@ static int __curtable_open_colgroups(WT_CURSOR_TABLE *ctable, const char *cfg_ar
 	WT_CURSOR **cp;
 	/*
 	 * Underlying column groups are always opened without dump or readonly,
-	 * and only the primary is opened with next_random.
+	 * and only the primary is opened with next_random or next_random_sample.
 	 */
 	const char *cfg[] = {cfg_arg[0], cfg_arg[1], "dump=\"\",readonly=0", NULL, NULL};
 	u_int i;
@@ -670,7 +1042,7 @@ static int __curtable_open_colgroups(WT_CURSOR_TABLE *ctable, const char *cfg_ar
 
 	for (i = 0, cp = ctable->cg_cursors; i < WT_COLGROUPS(table); i++, cp++) {
 		WT_RET(__wt_open_cursor(session, table->cgroups[i]->source, &ctable->iface, cfg, cp));
-		cfg[3] = "next_random=false";
+		cfg[3] = "next_random=false,next_random_sample=0";
 	}
 	return 0;
 }
@@ -690,12 +1062,26 @@ static int __curtable_open_indices(WT_CURSOR_TABLE* ctable)
 	if (table->nindices == 0 || ctable->idx_cursors != NULL)
 		return 0;
 
-	/* Check for bulk cursors. */
+	/*
+	 * Bulk loads always buffer index keys and build the indices with bulk
+	 * cursors on close.  The buffer is still bounded: past the limit keys
+	 * are written with ordinary inserts.
+	 */
 	primary = *ctable->cg_cursors;
-	if (F_ISSET(primary, WT_CURSTD_BULK))
-		WT_RET_MSG(session, ENOTSUP, "Bulk load is not supported for tables with indices");
+	if (F_ISSET(primary, WT_CURSTD_BULK)) {
+		ctable->idx_batch_on = 1;
+		if (ctable->idx_batch_max == 0)
+			ctable->idx_batch_max = WT_INDEX_BATCH_BULK_MAX;
+	}
 
 	WT_RET(__wt_calloc_def(session, table->nindices, &ctable->idx_cursors));
+	if (ctable->idx_batch_on) {
+		WT_RET(__wt_calloc_def(session, table->nindices, &ctable->idx_batch));
+		++session->idx_batch_cursors;
+	}
+	if (F_ISSET(primary, WT_CURSTD_BULK))
+		return 0;
+
 	for (i = 0, cp = ctable->idx_cursors; i < table->nindices; i++, cp++)
 		WT_RET(__wt_open_cursor(session, table->indices[i]->source, &ctable->iface, ctable->cfg, cp));
 	return 0;
@@ -782,12 +1168,21 @@ int __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, const char *cf
 	 * Random retrieval cursors only support next, reset and close.
 	 */
 	WT_ERR(__wt_config_gets_def(session, cfg, "next_random", 0, &cval));
+	if (cval.val == 0)
+		WT_ERR(__wt_config_gets_def(session, cfg, "next_random_sample", 0, &cval));
 	if (cval.val != 0) {
 		__wt_cursor_set_notsup(cursor);
 		cursor->next = __curtable_next_random;
 		cursor->reset = __curtable_reset;
 	}
 
+	/*index_batch: key浽ֽʱдһΣΪ0ʱά(bulk load)*/
+	WT_ERR(__wt_config_gets_def(session, cfg, "index_batch", 0, &cval));
+	if (cval.val != 0) {
+		ctable->idx_batch_on = 1;
+		ctable->idx_batch_max = (uint64_t)cval.val;
+	}
+
 	/*ʼtable cursorĬϵcursor*/
 	WT_ERR(__wt_cursor_init(cursor, cursor->internal_uri, NULL, cfg, cursorp));
 
@@ -804,6 +1199,17 @@ int __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, const char *cf
 	 */
 	WT_ERR(__curtable_open_colgroups(ctable, cfg));
 
+	/*
+	 * Bulk cursors finish the load and build the indices when they're
+	 * closed, checkpoint cursors are tied to a point-in-time handle: neither
+	 * can be parked in the session's cursor cache.
+	 */
+	WT_ERR(__wt_config_gets_def(session, cfg, "checkpoint", 0, &cval));
+	if (cval.len == 0 && !F_ISSET(ctable->cg_cursors[0], WT_CURSTD_BULK)) {
+		cursor->cache = __curtable_cache;
+		cursor->reopen = __curtable_reopen;
+	}
+
 	/*
 	 * We'll need to squirrel away a copy of the cursor configuration for
 	 * if/when we open indices.
@@ -31,10 +31,15 @@ static inline uint64_t __evict_read_gen(const WT_EVICT_ENTRY* entry)
 
 	/*
 	* Skew the read generation for internal pages, we prefer to evict leaf pages.
+	* With the 2Q policy, leaf pages read once are evicted before hot pages;
+	* the hot flag is only left set under 2Q (see __evict_lru_walk), and
+	* pages marked for forced eviction are never skewed.
 	*/
 	read_gen = page->read_gen + entry->btree->evict_priority;
 	if (WT_PAGE_IS_INTERNAL(page))
 		read_gen += WT_EVICT_INT_SKEW;
+	else if (page->evict_hot && page->read_gen != WT_READGEN_OLDEST)
+		read_gen += WT_EVICT_HOT_SKEW;
 
 	return read_gen;
 }
@@ -637,6 +642,12 @@ static int __evict_lru_walk(WT_SESSION_IMPL *session, uint32_t flags)
 
 	__wt_spin_lock(session, &cache->evict_lock);
 	entries = cache->evict_entries;
+	/*hot pageƫֻ2QЧлlrupagehot*/
+	if (cache->evict_policy != WT_EVICT_POLICY_2Q){
+		for (i = 0, evict = cache->evict; i < entries; i++, evict++)
+			if (evict->ref != NULL)
+				evict->ref->page->evict_hot = 0;
+	}
 	/*evict listentry->read_genӴС*/
 	qsort(cache->evict, entries, sizeof(WT_EVICT_ENTRY), __evict_lru_cmp);
 	/*λûбevictread genСevict entry*/
@@ -938,6 +949,20 @@ static int __evict_walk_file(WT_SESSION_IMPL* session, u_int* slotp, uint32_t fl
 		page = ref->page;
 		modified = __wt_page_is_modified(page);
 
+		/*̨汾գpageǷѡ̭ϳupdate listйڵupdate*/
+		if (!WT_PAGE_IS_INTERNAL(page))
+			__wt_update_obsolete_page(session, page);
+
+		/*
+		* Demote hot pages whose read generation has gone stale back to
+		* the pool of pages read once, and drop the flag entirely when
+		* the 2Q policy isn't in use.  Done before the EVICT_LRU check so
+		* pages already queued are demoted as well.
+		*/
+		if (page->evict_hot && (cache->evict_policy != WT_EVICT_POLICY_2Q || page->read_gen == WT_READGEN_OLDEST ||
+			page->read_gen + WT_EVICT_HOT_SKEW < __wt_cache_read_gen(session)))
+			page->evict_hot = 0;
+
 		/*
 		* Use the EVICT_LRU flag to avoid putting pages onto the list
 		* multiple times.
@@ -1006,7 +1031,8 @@ fast:
 		* or we can help get the checkpoint completed sooner.
 		*/
 		if (modified && !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE | WT_EVICT_PASS_WOULD_BLOCK) &&
-			(mod->disk_snap_min == S2C(session)->txn_global.oldest_id || !__wt_txn_visible_all(session, mod->update_txn)))
+			(mod->disk_snap_min == S2C(session)->txn_global.oldest_id || !__wt_txn_visible_all(session, mod->update_txn)) &&
+			!__wt_hs_page_evictable(session, page))
 			continue;
 
 		/*evict page뵽evict lru list*/
@@ -1160,7 +1186,8 @@ int __wt_cache_wait(WT_SESSION_IMPL* session, int full)
 	WT_DECL_RET;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *txn_state;
-	int busy, count;
+	int busy, count, in_epoch;
+	struct timespec start;
 
 	cache = S2C(session)->cache;
 
@@ -1180,6 +1207,11 @@ int __wt_cache_wait(WT_SESSION_IMPL* session, int full)
 
 	count = busy ? 1 : 10;
 
+	/*ȴcacheռڼ뿪hazard epocheviction̵߳ȴsession*/
+	if ((in_epoch = (session->hazard_gen != 0)) != 0)
+		__wt_hazard_gen_leave(session);
+
+	WT_LATENCY_BEGIN(session, start);
 	for (;;){
 		/*
 		* A pathological case: if we're the oldest transaction in the
@@ -1195,7 +1227,8 @@ int __wt_cache_wait(WT_SESSION_IMPL* session, int full)
 		if (F_ISSET(cache, WT_CACHE_STUCK) && __wt_txn_am_oldest(session)) {
 			F_CLR(cache, WT_CACHE_STUCK);
 			WT_STAT_FAST_CONN_INCR(session, txn_fail_cache);
-			return WT_ROLLBACK;
+			ret = WT_ROLLBACK;
+			goto done;
 		}
 
 		/*evict queueлȡһevict pageevict*/
@@ -1203,7 +1236,7 @@ int __wt_cache_wait(WT_SESSION_IMPL* session, int full)
 		switch (ret){
 		case 0: /*ɹˣһ*/
 			if (--count == 0)
-				return (0);
+				goto done;
 			break;
 
 		case EBUSY:
@@ -1213,8 +1246,14 @@ int __wt_cache_wait(WT_SESSION_IMPL* session, int full)
 			break;
 
 		default:
-			return ret;
+			goto done;
 		}
 	}
+
+done:
+	WT_LATENCY_END(session, WT_LATENCY_CACHE_WAIT, start);
+	if (in_epoch)
+		__wt_hazard_gen_enter(session);
+	return ret;
 }
 
@@ -17,6 +17,12 @@ static inline int __evict_exclusive(WT_SESSION_IMPL* session, WT_REF* ref)
 {
 	WT_ASSERT(session, ref->state == WT_REF_LOCKED);
 
+	/*ȴhazard epochеsession뿪֮õhazard pointerܱ鵽*/
+	if (S2C(session)->hazard_epoch && __wt_hazard_gen_wait(session) != 0) {
+		WT_STAT_FAST_CONN_INCR(session, cache_eviction_hazard_epoch);
+		return EBUSY;
+	}
+
 	/*
 	* Check for a hazard pointer indicating another thread is using the
 	* page, meaning the page cannot be evicted.
@@ -38,6 +44,7 @@ int __wt_evict(WT_SESSION_IMPL* session, WT_REF* ref, int exclusive)
 	WT_PAGE *page;
 	WT_PAGE_MODIFY *mod;
 	int forced_eviction, inmem_split;
+	struct timespec start;
 
 	conn = S2C(session);
 
@@ -55,6 +62,7 @@ int __wt_evict(WT_SESSION_IMPL* session, WT_REF* ref, int exclusive)
 	* would choose an internal page with children, it's not disallowed.
 	* жǷevict
 	*/
+	WT_LATENCY_BEGIN(session, start);
 	WT_RET(__evict_review(session, ref, exclusive, &inmem_split));
 
 	/*
@@ -111,6 +119,7 @@ done:
 		WT_TRET(__wt_evict_server_wake(session));
 	}
 
+	WT_LATENCY_END(session, WT_LATENCY_EVICT_PAGE, start);
 	return ret;
 }
 
@@ -268,15 +277,20 @@ static int __evict_review(WT_SESSION_IMPL* session, WT_REF* ref, int exclusive,
 	if (__wt_page_is_modified(page)) {
 		if (exclusive)
 			LF_SET(WT_SKIP_UPDATE_ERR);
-		else if (!WT_PAGE_IS_INTERNAL(page) && page->read_gen == WT_READGEN_OLDEST)
-			LF_SET(WT_SKIP_UPDATE_RESTORE);
+		else if (!WT_PAGE_IS_INTERNAL(page)) {
+			if (page->read_gen == WT_READGEN_OLDEST)
+				LF_SET(WT_SKIP_UPDATE_RESTORE);
+			/*е񻹿ܶİ汾дhistory store*/
+			if (__wt_hs_page_evictable(session, page))
+				LF_SET(WT_SKIP_UPDATE_HS);
+		}
 
 		/*pagereconcile*/
 		WT_RET(__wt_reconcile(session, ref, NULL, flags));
 		WT_ASSERT(session, !__wt_page_is_modified(page) || LF_ISSET(WT_SKIP_UPDATE_RESTORE));
 	}
 
-	if (!exclusive && mod != NULL && !__wt_txn_visible_all(session, mod->rec_max_txn) && !LF_ISSET(WT_SKIP_UPDATE_RESTORE))
+	if (!exclusive && mod != NULL && !__wt_txn_visible_all(session, mod->rec_max_txn) && !LF_ISSET(WT_SKIP_UPDATE_RESTORE | WT_SKIP_UPDATE_HS))
 		return EBUSY;
 
 	return 0;
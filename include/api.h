@@ -10,6 +10,7 @@
 #define API_SESSION_INIT(s, h, n, cur, dh)				\
 	WT_DATA_HANDLE *__olddh = (s)->dhandle;				\
 	const char *__oldname = (s)->name;					\
+	int __hazard_gen = 0;								\
 	(s)->cursor = (cur);								\
 	(s)->dhandle = (dh);								\
 	(s)->name = (s)->lastop = #h "." #n;				\
@@ -31,6 +32,8 @@
 
 #define	API_END(s, ret)							\
 	if ((s) != NULL) {							\
+	if (__hazard_gen)							\
+		__wt_hazard_gen_leave(s);				\
 	(s)->dhandle = __olddh;						\
 	(s)->name = __oldname;						\
 	if (F_ISSET(&(s)->txn, TXN_RUNNING) &&		\
@@ -112,15 +115,27 @@
 #define	SESSION_TXN_API_CALL(s, n, config, cfg)					\
 	TXN_API_CALL(s, session, n, NULL, NULL, config, cfg)
 
+/*
+ * Cursor operations on a btree run inside a hazard epoch if configured, the
+ * epoch is left in API_END.
+ */
+#define	CURSOR_HAZARD_GEN_ENTER(s, bt)							\
+	if ((bt) != NULL && (s)->hazard_gen == 0 && S2C(s)->hazard_epoch) {	\
+		__wt_hazard_gen_enter(s);								\
+		__hazard_gen = 1;										\
+	}
+
 #define	CURSOR_API_CALL(cur, s, n, bt)							\
 	(s) = (WT_SESSION_IMPL *)(cur)->session;					\
 	API_CALL_NOCONF(s, cursor, n, cur,							\
-	    ((bt) == NULL) ? NULL : ((WT_BTREE *)(bt))->dhandle)
+	    ((bt) == NULL) ? NULL : ((WT_BTREE *)(bt))->dhandle);	\
+	CURSOR_HAZARD_GEN_ENTER(s, bt)
 
 #define	CURSOR_UPDATE_API_CALL(cur, s, n, bt)					\
 	(s) = (WT_SESSION_IMPL *)(cur)->session;					\
 	TXN_API_CALL_NOCONF(s, cursor, n, cur,						\
-	    ((bt) == NULL) ? NULL : ((WT_BTREE *)(bt))->dhandle)
+	    ((bt) == NULL) ? NULL : ((WT_BTREE *)(bt))->dhandle);	\
+	CURSOR_HAZARD_GEN_ENTER(s, bt)
 
 #define	CURSOR_UPDATE_API_END(s, ret)							\
 	TXN_API_END(s, ret)
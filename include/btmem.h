@@ -17,6 +17,10 @@ struct __wt_page_header {
 	 * so we can figure out where the column-store leaf page fits into the
 	 * key space during salvage.
 	 */
+	/*
+	 * Row-store leaf pages with WT_PAGE_HS set keep the largest transaction
+	 * ID that replaced a version moved into the history store here.
+	 */
 	uint64_t recno;			/* 00-07: column-store starting recno */
 
 	/*
@@ -42,6 +46,7 @@ struct __wt_page_header {
 #define	WT_PAGE_COMPRESSED	0x01	/* Page is compressed on disk */
 #define	WT_PAGE_EMPTY_V_ALL	0x02	/* Page has all zero-length values */
 #define	WT_PAGE_EMPTY_V_NONE	0x04	/* Page has no zero-length values */
+#define	WT_PAGE_HS		0x08	/* Page has history store versions */
 	uint8_t flags;			/* 25: flags */
 
 	/*
@@ -96,6 +101,14 @@ struct __wt_addr {
 	 * is treated correctly (not free'd on error, for example).
 	 */
 	uint8_t	 reuse;
+
+	/*
+	 * Row-store trees configured with subtree_counts record the number of
+	 * rows in the subtree the address references, plus one; 0 means the
+	 * count isn't known.  On disk, the count is stored in the address
+	 * cell's record number slot, which row-store doesn't otherwise use.
+	 */
+	uint64_t rows;
 };
 
 /*
@@ -199,6 +212,29 @@ struct __wt_page_modify {
 	/* Dirty bytes added to the cache. */
 	size_t bytes_dirty;
 
+	/*
+	 * Approximate change in the number of rows on a row-store leaf page
+	 * since it was read, maintained when the tree keeps subtree counts.
+	 * ֵûύѾع޸
+	 */
+	int64_t rows_delta;
+
+	/*
+	 * Background version GC: set when an update chain on the page was left
+	 * longer than WT_UPDATE_GC_CHAIN, and the oldest transaction ID when the
+	 * eviction walk last trimmed the page's chains.
+	 * ֻʾҪԭӲ
+	 */
+	uint64_t update_gc_oldest;
+	int update_gc_pending;
+
+	/*
+	 * The write generation of the last eviction that tried to move the
+	 * page's old versions into the history store and failed, the page isn't
+	 * tried again until it's modified.
+	 */
+	uint32_t hs_busy_gen;
+
 	/*
 	 * When pages are reconciled, the result is one or more replacement
 	 * blocks.  A replacement block can be in one of two states: it was
@@ -543,6 +579,8 @@ struct __wt_page {
 #define	WT_PAGE_SPLITTING	0x80	/* An internal page is growing */
 	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
 
+	uint8_t evict_hot;		/* 2Q: page is in the hot pool */
+
 	/*
 	 * The page's read generation acts as an LRU value for each page in the
 	 * tree; it is used by the eviction server thread to select pages to be
@@ -571,6 +609,14 @@ struct __wt_page {
 
 	/* If/when the page is modified, we need lots more information. */
 	WT_PAGE_MODIFY *modify;
+
+	/*
+	 * Adaptive hash index slots that have named the page, so page discard
+	 * and splits clear only those slots rather than scanning the index.
+	 */
+	uint32_t *ahi_slots;
+	size_t ahi_slots_alloc;
+	uint32_t ahi_nslots;
 };
 
 /*
@@ -870,6 +916,12 @@ WT_PACKED_STRUCT_BEGIN(__wt_update)
 */
 #define	WT_UPDATE_MEMSIZE(upd)			WT_ALIGN(sizeof(WT_UPDATE) + (WT_UPDATE_DELETED_ISSET(upd) ? 0 : (upd)->size), 32)
 
+/*
+ * An update chain left longer than this after the obsolete check marks its
+ * page for the eviction walk's background version GC.
+ */
+#define	WT_UPDATE_GC_CHAIN				16
+
 /*
  * WT_INSERT --
  *
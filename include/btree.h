@@ -34,6 +34,37 @@
 
 #define WT_BTREE_SPECIAL_FLAGS	(WT_BTREE_BULK | WT_BTREE_SALVAGE | WT_BTREE_UPGRADE | WT_BTREE_VERIFY)
 
+/*
+ * WT_AHI_ENTRY --
+ *	An adaptive hash index entry: where a key was last found on a hot leaf
+ * page.
+ */
+struct __wt_ahi_entry
+{
+	uint64_t				hash;				/*keyhashֵ*/
+	WT_REF*					ref;				/*Ҷpageref*/
+	WT_PAGE*				page;				/*ҶpageNULLʾղ*/
+	WT_INSERT*				ins;				/*keyinsert listʱָWT_INSERTΪNULL*/
+	uint32_t				slot;				/*keyڵWT_ROW slotinsert listڵslot*/
+	int						smallest;			/*insert listpageWT_ROW_INSERT_SMALLEST*/
+};
+
+/*
+ * WT_AHI --
+ *	The adaptive hash index of a row-store btree, a direct-mapped table from
+ * full key hashes to positions on hot leaf pages.  Point lookups that hit it
+ * skip the descent from the root.
+ */
+struct __wt_ahi
+{
+	WT_RWLOCK*				lock;				/*ҳжpageʧЧд*/
+	WT_AHI_ENTRY*			entries;
+	uint32_t				mask;				/*entry - 1*/
+};
+
+/*һpage¼hashλΪpageµ*/
+#define WT_AHI_PAGE_SLOTS_MAX		512
+
 /*btreeṹ*/
 struct __wt_btree
 {
@@ -78,6 +109,7 @@ struct __wt_btree
 	u_int					dictionary;			/*slotsֵ*/
 	int						internal_key_truncate;
 	int						maximum_depth;		/**/
+	int						subtree_counts;		/*internal pageм¼ÿ*/
 	int						prefix_compression; /*ǰ׺ѹ*/
 	u_int					prefix_compression_min;
 
@@ -88,6 +120,8 @@ struct __wt_btree
 
 	WT_RWLOCK*				ovfl_lock;
 
+	WT_AHI*					ahi;				/*ӦhashNULLʾûп*/
+
 	uint64_t				last_recno;			/*ʽ洢ʱļ¼*/
 	WT_REF					root;				/*btree rootĸڵ*/
 	int						modified;			/*btree޸ıʾ*/
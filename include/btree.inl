@@ -573,6 +573,81 @@ static inline int __wt_ref_info(WT_SESSION_IMPL* session, WT_REF* ref, const uin
 	return 0;
 }
 
+/*
+ * __wt_ref_rows --
+ *	Return the row count recorded in a row-store WT_REF's address, plus one,
+ * or 0 if the tree doesn't keep subtree counts or the count isn't known.
+ */
+static inline uint64_t __wt_ref_rows(WT_REF* ref)
+{
+	WT_ADDR *addr;
+	WT_CELL_UNPACK unpack;
+
+	if ((addr = ref->addr) == NULL)
+		return 0;
+	if (__wt_off_page(ref->home, addr))
+		return addr->rows;
+
+	__wt_cell_unpack((WT_CELL *)addr, &unpack);
+	return (unpack.raw == WT_CELL_ADDR_DEL ? 0 : unpack.v);
+}
+
+/*
+ * __wt_hs_skip --
+ *	Check if the session's transaction can ignore history store versions
+ * replaced by transactions up to max_txn: it reads the newest versions.
+ */
+static inline int __wt_hs_skip(WT_SESSION_IMPL* session, uint64_t max_txn)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+	if (txn->isolation == TXN_ISO_READ_UNCOMMITTED || __wt_txn_visible_all(session, max_txn))
+		return 1;
+	/*snapshotԿ滻ɰ汾*/
+	return (F_ISSET(txn, TXN_HAS_SNAPSHOT) && TXNID_LT(max_txn, txn->snap_min));
+}
+
+/*
+ * __wt_hs_page_lookup --
+ *	Check if a read of a row-store leaf page's on-page keys may need the
+ * history store: the page was written with versions replaced by transactions
+ * the session's transaction may not see.
+ */
+static inline int __wt_hs_page_lookup(WT_SESSION_IMPL* session, WT_PAGE* page)
+{
+	if (page->dsk == NULL || !F_ISSET(page->dsk, WT_PAGE_HS))
+		return 0;
+	return (!__wt_hs_skip(session, page->dsk->recno));
+}
+
+/*
+ * __wt_hs_page_evictable --
+ *	Check if eviction can write a modified page's versions that running
+ * transactions may still read to the history store rather than waiting for
+ * the transactions to finish.
+ */
+static inline int __wt_hs_page_evictable(WT_SESSION_IMPL* session, WT_PAGE* page)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_PAGE_MODIFY *mod;
+
+	btree = S2BT(session);
+	conn = S2C(session);
+	mod = page->modify;
+
+	if (!conn->hs_open || page->type != WT_PAGE_ROW_LEAF || mod == NULL)
+		return 0;
+	if (btree->id == conn->hs_fileid || WT_IS_METADATA(session->dhandle) || F_ISSET(btree, WT_BTREE_SPECIAL_FLAGS))
+		return 0;
+	if (conn->txn_global.checkpoint_id != WT_TXN_NONE || mod->hs_busy_gen == mod->write_gen)
+		return 0;
+
+	/*µ޸Ļпûύ̭ʧ*/
+	return (TXNID_LT(mod->update_txn, conn->txn_global.last_running));
+}
+
 /*жpageǷԽLRṶ*/
 static inline int __wt_page_can_evict(WT_SESSION_IMPL* session, WT_PAGE* page, int check_splits)
 {
@@ -602,7 +677,8 @@ static inline int __wt_page_can_evict(WT_SESSION_IMPL* session, WT_PAGE* page, i
 	}
 
 	/*pageжһִеpage,̭ܽ*/
-	if (page->read_gen != WT_READGEN_OLDEST && !__wt_txn_visible_all(session, __wt_page_is_modified(page) ? mod->update_txn : mod->rec_max_txn))
+	if (page->read_gen != WT_READGEN_OLDEST && !__wt_txn_visible_all(session, __wt_page_is_modified(page) ? mod->update_txn : mod->rec_max_txn)
+		&& !(__wt_page_is_modified(page) && __wt_hs_page_evictable(session, page)))
 		return 0;
 
 	/*pageղŷspliṱͨeviction threaḓslipt*/
@@ -709,18 +785,19 @@ static inline WT_HAZARD* __wt_page_hazard_check(WT_SESSION_IMPL *session, WT_PAG
 	WT_CONNECTION_IMPL *conn;
 	WT_HAZARD *hp;
 	WT_SESSION_IMPL *s;
-	uint32_t i, hazard_size, session_cnt;
+	uint32_t i, hazard_inuse, session_cnt;
 
 	conn = S2C(session);
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for(s == conn->sessions, i = 0; i < session_cnt; ++s, ++i){
+	for(s = conn->sessions, i = 0; i < session_cnt; ++s, ++i){
 		if(!s->active)
 			continue;
 
-		WT_ORDERED_READ(hazard_size, s->hazard_size);
+		/*ֻɨsessionùhazardλãhazard_inusehazard pointer֮ǰ*/
+		WT_ORDERED_READ(hazard_inuse, s->hazard_inuse);
 
-		for (hp = s->hazard; hp < s->hazard + hazard_size; ++hp){
+		for (hp = s->hazard; hp < s->hazard + hazard_inuse; ++hp){
 			if (hp->page == page)
 				return hp;
 		}
@@ -729,6 +806,25 @@ static inline WT_HAZARD* __wt_page_hazard_check(WT_SESSION_IMPL *session, WT_PAG
 	return NULL;
 }
 
+/*
+ * __wt_hazard_gen_enter --
+ *	Enter the current hazard epoch.  While a session is in an epoch, eviction
+ * waits for the session to move on before checking hazard pointers, so the
+ * hazard pointers set during the operation don't need a full barrier each.
+ */
+static inline void __wt_hazard_gen_enter(WT_SESSION_IMPL* session)
+{
+	session->hazard_gen = S2C(session)->hazard_gen;
+	/*evictionpage֮ȡsession epochԣ֤֮ȡref״̬epoch*/
+	WT_FULL_BARRIER();
+}
+
+/*뿪hazard epoch֮ǰ֤βõhazard pointerevictionɼ*/
+static inline void __wt_hazard_gen_leave(WT_SESSION_IMPL* session)
+{
+	WT_PUBLISH(session->hazard_gen, 0);
+}
+
 /*һskiplistinsert*/
 static inline u_int __wt_skip_choose_depth(WT_SESSION_IMPL* session)
 {
@@ -8,6 +8,7 @@
  */
 
 #define WT_EVICT_INT_SKEW		(1 << 20)	/*1M, Prefer leaf pages over internal pages by this many increments of the read generation.*/
+#define WT_EVICT_HOT_SKEW		(10 * WT_READGEN_STEP)	/*2Q: prefer pages read once over pages read again by this many increments*/
 
 #define WT_EVICT_WALK_PER_FILE	10			/* Pages to queue per file */
 #define WT_EVICT_MAX_PER_FILE	100			/* Max pages to visit per file */
@@ -19,6 +20,17 @@
 #define	WT_EVICT_PASS_DIRTY			0x04	/*ݵpageevict entry*/
 #define	WT_EVICT_PASS_WOULD_BLOCK	0x08	/*Сread_genevict entry*/
 
+/*
+ * Eviction policies, selected by the eviction_policy configuration:
+ *	lru: pages are ordered by read generation alone.
+ *	2q:  pages read again after their read generation passed are promoted
+ *	     to a hot pool, evicted after the pages read once, and demoted by the
+ *	     eviction walk once their read generation goes stale; leaf pages read
+ *	     by cursor scans stay at the current read generation.
+ */
+#define	WT_EVICT_POLICY_LRU		0
+#define	WT_EVICT_POLICY_2Q		1
+
 /*һevitionķװ*/
 struct __wt_evict_entry
 {
@@ -62,6 +74,7 @@ struct __wt_cache
 	u_int eviction_trigger;					/* Percent to trigger eviction */
 	u_int eviction_target;					/* Percent to end eviction */
 	u_int eviction_dirty_target;			/* Percent to allow dirty */
+	u_int evict_policy;						/* Eviction policy, WT_EVICT_POLICY_* */
 
 	u_int overhead_pct;						/* Cache percent adjustment */
 
@@ -89,9 +102,76 @@ struct __wt_cache
 	WT_SESSION_IMPL *cp_session;			/* May be used for cache management */
 	wt_thread_t cp_tid;						/* Thread ID for cache pool manager */
 
+	WT_CACHE_MEM *mem;						/* Huge-page memory provider, NULL if not configured */
+
 	uint32_t flags;
 };
 
+/*
+ * Huge-page backed cache memory: the cache reserves one arena of 2MB aligned
+ * regions at open, each region is owned by a single slab size class and page
+ * structures and page images are carved from it.  A pointer belongs to the
+ * provider if it falls inside the arena, which is how the generic free and
+ * realloc functions find their way back here.
+ */
+#define	WT_CACHE_MEM_REGION		(2 * WT_MEGABYTE)	/* Huge-page region size */
+#define	WT_CACHE_MEM_MIN		64					/* Smallest slab chunk */
+#define	WT_CACHE_MEM_POW2_MAX	(32 * WT_KILOBYTE)	/* Largest power-of-two class */
+#define	WT_CACHE_MEM_CHUNK_MAX	(WT_CACHE_MEM_REGION / 2)	/* Largest slab chunk */
+#define	WT_CACHE_MEM_CLASSES	24					/* Maximum slab size classes */
+
+/*slab size classchunkСĲұWT_CACHE_MEM_MINΪλ*/
+#define	WT_CACHE_MEM_MAP_SLOTS	(WT_CACHE_MEM_CHUNK_MAX / WT_CACHE_MEM_MIN)
+#define	WT_CACHE_MEM_MAP_SLOT(size)	(((size) - 1) / WT_CACHE_MEM_MIN)
+
+/*arenaһ2MB regionϢ*/
+struct __wt_cache_region
+{
+	WT_CACHE_SLAB *slab;					/* Owning size class, NULL if free */
+	void *free;								/* Freed chunk list */
+	uint32_t next;							/* Offset of the first untouched chunk */
+	uint32_t inuse;							/* Chunks handed out */
+	int onlist;								/* On the owning slab's partial list */
+	TAILQ_ENTRY(__wt_cache_region) q;		/* Slab partial list or arena free list */
+};
+
+/*slab size class, һsize classɸregion*/
+struct __wt_cache_slab
+{
+	WT_SPINLOCK lock;						/* Slab lock */
+	size_t chunk;							/* Chunk size */
+	uint32_t nchunks;						/* Chunks per region */
+	uint32_t regions;						/* Regions owned */
+
+	/* Locked: regions with free chunks. */
+	TAILQ_HEAD(__wt_slab_partial_qh, __wt_cache_region) partialqh;
+};
+
+/*huge pageڴṩ*/
+struct __wt_cache_mem
+{
+	uint8_t *base;							/* Arena start, region aligned */
+	size_t len;								/* Arena length */
+	int huge;								/* Backed by MAP_HUGETLB */
+
+	WT_SPINLOCK region_lock;				/* Region and class allocation */
+	WT_CACHE_REGION *regions;				/* Region descriptors */
+	uint32_t nregions;						/* Regions in the arena */
+	uint32_t next_region;					/* First never-used region */
+	uint32_t regions_inuse;					/* Regions owned by a slab */
+
+	/* Locked: regions released by their slabs. */
+	TAILQ_HEAD(__wt_region_free_qh, __wt_cache_region) freeqh;
+
+	WT_CACHE_SLAB slab[WT_CACHE_MEM_CLASSES];	/* Size classes, append-only */
+	u_int nslab;							/* Size classes in use */
+	size_t align;							/* Chunk alignment for registered classes */
+	uint8_t *map;							/* Request size to size class */
+
+	uint64_t bytes_slab;					/* Chunk bytes handed out */
+	uint64_t fallback;						/* Requests served by malloc */
+};
+
 /*cache's flags type*/
 #define	WT_CACHE_POOL_MANAGER	0x01	/* The active cache pool manager */
 #define	WT_CACHE_POOL_RUN	0x02		/* Cache pool thread running */
@@ -25,12 +25,63 @@ static inline uint64_t __wt_cache_read_gen_set(WT_SESSION_IMPL* session)
 	return (__wt_cache_read_gen(session) + WT_READGEN_STEP);
 }
 
+/*
+ * __wt_cache_read_gen_bump --
+ *	Update the read generation of a page found in the cache.  With the 2Q
+ * policy, a page read again after its read generation passed is promoted to
+ * the hot pool, and leaf pages read by cursor scans are left at the current
+ * read generation without being promoted.
+ */
+static inline void __wt_cache_read_gen_bump(WT_SESSION_IMPL* session, WT_PAGE* page, uint32_t flags)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+	if (page->read_gen == WT_READGEN_OLDEST || page->read_gen >= cache->read_gen)
+		return;
+
+	if (cache->evict_policy == WT_EVICT_POLICY_2Q && !WT_PAGE_IS_INTERNAL(page)) {
+		/*ɨpageȱ̭ѾcacheеpageҲΪɨ*/
+		if (LF_ISSET(WT_READ_SCAN)) {
+			if (page->read_gen == WT_READGEN_NOTSET) {
+				page->read_gen = cache->read_gen;
+				WT_STAT_FAST_CONN_INCR(session, cache_read_scan);
+			}
+			return;
+		}
+		if (page->read_gen != WT_READGEN_NOTSET && !page->evict_hot) {
+			page->evict_hot = 1;
+			WT_STAT_FAST_CONN_INCR(session, cache_eviction_promote);
+		}
+	}
+
+	page->read_gen = __wt_cache_read_gen_set(session);
+}
+
 /*ʹõpage*/
 static inline uint64_t __wt_cache_pages_inuse(WT_CACHE* cache)
 {
 	return cache->pages_inmem - cache->pages_evict; 
 }
 
+/*жpǷǴcachehuge page arenaзڴ*/
+static inline int __wt_cache_mem_owns(WT_SESSION_IMPL* session, const void* p)
+{
+	WT_CACHE *cache;
+	WT_CACHE_MEM *mem;
+
+	if (session == NULL || (cache = S2C(session)->cache) == NULL || (mem = cache->mem) == NULL)
+		return 0;
+
+	return WT_PTR_IN_RANGE(p, mem->base, mem->len);
+}
+
+/*arenapchunkĴС*/
+static inline size_t __wt_cache_mem_chunk(WT_CACHE_MEM* mem, const void* p)
+{
+	return (mem->regions[WT_PTRDIFF(p, mem->base) / WT_CACHE_MEM_REGION].slab->chunk);
+}
+
 /*cacheռõֽ*/
 static inline uint64_t __wt_cache_bytes_inuse(WT_CACHE* cache)
 {
@@ -38,6 +38,42 @@ struct __wt_config_entry
 	u_int						checks_entries;
 };
 
+/*
+ * Compiled configurations: WT_CONNECTION::compile_configuration checks a
+ * configuration string once for an API method and resolves its top-level
+ * keys, merged with the method's defaults, into a small hash table.  The
+ * application passes the returned string in place of its configuration and
+ * the API skips the check and answers key lookups from the table.  The
+ * returned string is an ordinary copy of the configuration, so it can still
+ * be parsed if it reaches a path that doesn't know about compilation.
+ */
+#define	WT_CONFIG_COMPILED_MAX		1024		/* Compiled configurations per connection */
+#define	WT_CONFIG_COMPILED_SLOTS	(2 * WT_CONFIG_COMPILED_MAX)
+#define	WT_CONFIG_CACHE_BUCKETS		64			/* Config cache content hash buckets */
+
+/*еһkey*/
+struct __wt_config_compiled_key
+{
+	const char*					name;		/* Key, NULL if the slot is empty */
+	size_t						len;
+	WT_CONFIG_ITEM				base;		/* Value from the method defaults */
+	WT_CONFIG_ITEM				user;		/* Value from the application */
+	int							user_set;	/* The application set the key */
+};
+
+struct __wt_config_compiled
+{
+	const char*					config;		/* Configuration copy returned to the application */
+	const WT_CONFIG_ENTRY*		entry;		/* Method compiled for */
+	const char*					base;		/* Method defaults at compile time */
+	uint64_t					hash;		/* Configuration content hash */
+
+	WT_CONFIG_COMPILED_KEY*		keys;		/* Key hash table */
+	u_int						key_slots;	/* Key hash table size, a power of two */
+
+	SLIST_ENTRY(__wt_config_compiled) hashl;	/* Config cache content hash list */
+};
+
 struct __wt_config_parser_impl 
 {
 	WT_CONFIG_PARSER			iface;
@@ -70,23 +106,27 @@ struct __wt_config_parser_impl
 #define	WT_CONFIG_ENTRY_session_close					16
 #define	WT_CONFIG_ENTRY_session_commit_transaction		17
 #define	WT_CONFIG_ENTRY_session_compact					18
-#define	WT_CONFIG_ENTRY_session_create					19
-#define	WT_CONFIG_ENTRY_session_drop					20
-#define	WT_CONFIG_ENTRY_session_log_printf				21
-#define	WT_CONFIG_ENTRY_session_open_cursor				22
-#define	WT_CONFIG_ENTRY_session_reconfigure				23
-#define	WT_CONFIG_ENTRY_session_rename					24
-#define	WT_CONFIG_ENTRY_session_rollback_transaction	25
-#define	WT_CONFIG_ENTRY_session_salvage					26
-#define	WT_CONFIG_ENTRY_session_strerror				27
-#define	WT_CONFIG_ENTRY_session_truncate				28
-#define	WT_CONFIG_ENTRY_session_upgrade					29
-#define	WT_CONFIG_ENTRY_session_verify					30
-#define	WT_CONFIG_ENTRY_table_meta						31
-#define	WT_CONFIG_ENTRY_wiredtiger_open					32
-#define	WT_CONFIG_ENTRY_wiredtiger_open_all				33
-#define	WT_CONFIG_ENTRY_wiredtiger_open_basecfg			34
-#define	WT_CONFIG_ENTRY_wiredtiger_open_usercfg			35
+#define	WT_CONFIG_ENTRY_session_count_range				19
+#define	WT_CONFIG_ENTRY_session_create					20
+#define	WT_CONFIG_ENTRY_session_drop					21
+#define	WT_CONFIG_ENTRY_session_dump					22
+#define	WT_CONFIG_ENTRY_session_load					23
+#define	WT_CONFIG_ENTRY_session_log_printf				24
+#define	WT_CONFIG_ENTRY_session_open_cursor				25
+#define	WT_CONFIG_ENTRY_session_position_rank			26
+#define	WT_CONFIG_ENTRY_session_reconfigure				27
+#define	WT_CONFIG_ENTRY_session_rename					28
+#define	WT_CONFIG_ENTRY_session_rollback_transaction	29
+#define	WT_CONFIG_ENTRY_session_salvage					30
+#define	WT_CONFIG_ENTRY_session_strerror				31
+#define	WT_CONFIG_ENTRY_session_truncate				32
+#define	WT_CONFIG_ENTRY_session_upgrade					33
+#define	WT_CONFIG_ENTRY_session_verify					34
+#define	WT_CONFIG_ENTRY_table_meta						35
+#define	WT_CONFIG_ENTRY_wiredtiger_open					36
+#define	WT_CONFIG_ENTRY_wiredtiger_open_all				37
+#define	WT_CONFIG_ENTRY_wiredtiger_open_basecfg			38
+#define	WT_CONFIG_ENTRY_wiredtiger_open_usercfg			39
 /*
  * configuration section: END
  * DO NOT EDIT: automatically built by dist/flags.py.
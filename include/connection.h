@@ -11,6 +11,7 @@
 #define	WT_CONN_STAT_FAST	0x04		/* "fast" statistics configured */
 #define	WT_CONN_STAT_NONE	0x08		/* don't gather statistics */
 #define	WT_CONN_STAT_ON_CLOSE	0x10	/* output statistics on close */
+#define	WT_CONN_STAT_SAMPLE	0x20		/* sampled statistics (cursors only) */
 
 	/*
 	 * We distribute the btree page locks across a set of spin locks; it
@@ -38,10 +39,11 @@
 #define	WT_SESSION_CHECK_PANIC(session)			WT_CONN_CHECK_PANIC(S2C(session))
 
 
-/*dhandle뵽connectionmain queuehash queue*/
+/*dhandle뵽connectionmain queuehash queue, hash queueĶߣdhandleʼɺŷ*/
 #define	WT_CONN_DHANDLE_INSERT(conn, dhandle, bucket) do {				\
 	SLIST_INSERT_HEAD(&(conn)->dhlh, dhandle, l);						\
-	SLIST_INSERT_HEAD(&(conn)->dhhash[bucket], dhandle, hashl);			\
+	SLIST_NEXT(dhandle, hashl) = SLIST_FIRST(&(conn)->dhhash[bucket]);	\
+	WT_PUBLISH(SLIST_FIRST(&(conn)->dhhash[bucket]), dhandle);			\
 } while (0)
 
 /*dhandleconnectionmain queuehash queueɾ*/
@@ -145,6 +147,13 @@ struct __wt_connection_impl
 
 	const WT_CONFIG_ENTRY**		config_entries;
 
+	/* Locked: compiled configuration cache, hashed by content. */
+	WT_SPINLOCK					config_cache_lock;
+	SLIST_HEAD(__wt_config_cache_hash, __wt_config_compiled) config_cache[WT_CONFIG_CACHE_BUCKETS];
+	/* Compiled configurations by returned pointer, read without locking. */
+	WT_CONFIG_COMPILED*	volatile	config_compiled[WT_CONFIG_COMPILED_SLOTS];
+	volatile u_int				config_compiled_cnt;
+
 	void**						foc;
 	size_t						foc_size;
 	size_t						foc_cnt;
@@ -152,6 +161,7 @@ struct __wt_connection_impl
 
 	WT_FH*						lock_fh;			/*lock file handle*/
 	volatile uint64_t			split_gen;			/*յֵСֵsessionصbufͷ*/
+	volatile uint64_t			dhandle_gen;		/*dhandle hashgeneration*/
 
 	SLIST_HEAD(__wt_dhhash, __wt_data_handle) dhhash[WT_HASH_ARRAY_SIZE];
 	/* Locked: data handle list */
@@ -181,6 +191,8 @@ struct __wt_connection_impl
 	size_t							session_scratch_max;	/* Max scratch memory per session */
 
 	uint32_t						hazard_max;		/* Hazard array size */
+	int								hazard_epoch;	/*ڼʹhazard epochpage*/
+	volatile uint64_t				hazard_gen;		/*hazard epochȫִevictionpage*/
 	
 	WT_CACHE*						cache;
 	uint64_t						cache_size;
@@ -203,7 +215,8 @@ struct __wt_connection_impl
 	int								compact_in_memory_pass;	/* Compaction serialization */
 
 	uint32_t						stat_flags;
-	WT_CONNECTION_STATS				stats;
+	WT_CONNECTION_STATS				stats;		/* Summed statistics, filled in when read */
+	WT_CONNECTION_STATS_SHARD		stat_shard[WT_STAT_CONN_SHARDS];	/* Statistics updated by sessions */
 
 	WT_ASYNC*						async;		/* Async structure */
 	int								async_cfg;	/* Global async configuration */
@@ -260,6 +273,26 @@ struct __wt_connection_impl
 	time_t							sweep_idle_time;/* Handle sweep idle time */
 	time_t							sweep_interval;/* Handle sweep interval */
 
+	/*
+	 * The history store: old versions of evicted row-store leaf pages that
+	 * running transactions may still read.  Eviction and the sweep share
+	 * the cursor under the spinlock, readers use their session's cursor;
+	 * eviction holds the read lock while writing versions so checkpoints
+	 * can't start.
+	 */
+	WT_SPINLOCK						hs_lock;	/* History store cursor lock */
+	WT_RWLOCK*						hs_ckpt_lock;/* History store checkpoint lock */
+	WT_SESSION_IMPL*				hs_session;	/* History store session */
+	WT_CURSOR*						hs_cursor;	/* History store cursor */
+	uint32_t						hs_fileid;	/* History store btree ID */
+	uint64_t						hs_seq;		/* History store record sequence */
+	uint64_t						hs_max_txn;	/* Largest ID that replaced a version */
+	uint32_t						hs_sweep_id;/* History store sweep position */
+	WT_ITEM							hs_sweep_key;
+	uint64_t						hs_sweep_seq;
+	int								hs_sweep_kept;
+	volatile int					hs_open;	/* History store is open */
+
 	/* Locked: collator list */
 	TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
 
@@ -50,7 +50,14 @@
 		{ NULL, 0, 0, NULL, 0 },	/* WT_ITEM value */		\
 	0,				/* int saved_err */		\
 	NULL,				/* internal_uri */		\
-	0				/* uint32_t flags */		\
+	0,				/* uint32_t flags */		\
+	__wt_cursor_search_batch,					\
+	__wt_cursor_insert_batch,					\
+		{ NULL, 0, 0, NULL, 0 },	/* WT_ITEM batch_values */	\
+	0,				/* uri_hash */			\
+	NULL,				/* cache_key */		\
+	NULL,				/* cache */			\
+	NULL				/* reopen */			\
 }
 
 #define	WT_CBT_ACTIVE			0x01	/* Active in the tree */
@@ -60,6 +67,9 @@
 #define	WT_CBT_MAX_RECORD		0x10	/* Col-store: past end-of-table */
 #define	WT_CBT_SEARCH_SMALLEST	0x20	/* Row-store: small-key insert list */
 
+/*cursorôpage󱻵ɨ裬֮Ҷpageevictionȼ*/
+#define	WT_BTCUR_SCAN_PAGES		8
+
 struct __wt_cursor_backup_entry
 {
 	char*			name;			/*file name*/
@@ -85,6 +95,7 @@ struct __wt_cursor_btree
 {
 	WT_CURSOR		iface;
 	WT_BTREE*		btree;
+	uint32_t		open_gen;						/*cursor cacheʱbtree handleopen_gen*/
 	WT_REF*			ref;							/*ǰpageĲοϢ*/
 
 	uint32_t		slot;							/*WT_COL/WT_ROW 0-based slot*/
@@ -111,6 +122,11 @@ struct __wt_cursor_btree
 	uint64_t		last_standard_recno;
 	/**/
 	uint32_t		row_iteration_slot;
+
+	uint64_t		sample_size;					/*next_random_sampleõС*/
+	uint64_t		sample_cnt;						/*ǰѾصļ¼*/
+
+	uint32_t		scan_pages;						/*next/prevpage*/
 	
 	WT_COL*			cip_saved;
 
@@ -120,6 +136,8 @@ struct __wt_cursor_btree
 
 	WT_UPDATE*		modify_update;
 
+	WT_UPDATE*		hs_upd;						/*history storeİ汾*/
+
 	uint8_t			v;
 	uint8_t			append_tree;
 
@@ -168,14 +186,19 @@ struct __wt_cursor_index
 
 	WT_CURSOR *child;
 	WT_CURSOR **cg_cursors;
+
+	int covered;		/* Values come from the index, value_plan refers to the child */
 };
 
 struct __wt_cursor_json 
 {
 	char	*key_buf;				/* JSON formatted string */
+	size_t	key_buf_alloc;			/* Allocated size of key_buf */
 	char	*value_buf;				/* JSON formatted string */
+	size_t	value_buf_alloc;		/* Allocated size of value_buf */
 	WT_CONFIG_ITEM key_names;		/* Names of key columns */
 	WT_CONFIG_ITEM value_names;		/* Names of value columns */
+	int		oneline;				/* Separate columns with ", " */
 };
 
 struct __wt_cursor_log 
@@ -233,6 +256,22 @@ struct __wt_cursor_stat {
 
 #define WT_CURSOR_STATS(cursor)		(((WT_CURSOR_STAT *)cursor)->stats_first)
 
+/*
+ * WT_INDEX_BATCH --
+ *	Index keys inserted through a table cursor, buffered and applied to the
+ * index in index key order instead of one random index write per row.
+ */
+struct __wt_index_batch {
+	WT_ITEM		keys;		/* Buffered keys, back to back */
+	size_t*		offs;		/* Start of each key in the buffer */
+	size_t		offs_alloc;
+	uint32_t	entries;	/* Number of buffered keys */
+	int			applied;	/* Keys went in through ordinary inserts */
+};
+
+/*bulk loadûindex_batchʱÿֽ*/
+#define	WT_INDEX_BATCH_BULK_MAX		(64 * WT_MEGABYTE)
+
 struct __wt_cursor_table 
 {
 	WT_CURSOR iface;
@@ -248,6 +287,16 @@ struct __wt_cursor_table
 								* overlapping set_value calls.
 								*/
 	WT_CURSOR **idx_cursors;
+
+	/*
+	 * Batched index keys, one per index.  Outside bulk loads they are
+	 * written when the transaction resolves, with autocommit that's the
+	 * end of every operation so batching only pays off in explicit
+	 * transactions.
+	 */
+	WT_INDEX_BATCH *idx_batch;
+	uint64_t idx_batch_max;		/* Bytes buffered per index */
+	int idx_batch_on;			/* Batch index inserts */
 };
 
 #define	WT_CURSOR_PRIMARY(cursor)		(((WT_CURSOR_TABLE *)cursor)->cg_cursors[0])
@@ -23,6 +23,9 @@
 #define	WT_DHANDLE_LOCK_ONLY	        0x10	/* Handle only used as a lock */
 #define	WT_DHANDLE_OPEN					0x20	/* Handle is open */
 
+/*dhandleڴconnectionɾsession_ref*/
+#define	WT_DHANDLE_REF_DEAD				UINT32_MAX
+
 struct __wt_data_handle
 {
 	WT_RWLOCK*					rwlock;	
@@ -32,6 +35,7 @@ struct __wt_data_handle
 
 	uint32_t					session_ref;		/* Sessions referencing this handle */
 	int32_t						session_inuse;		/* Sessions using this handle */
+	uint32_t					open_gen;			/* Incremented each time the handle is opened */
 	time_t						timeofdeath;		/* Use count went to 0 */
 
 	uint64_t					name_hash;			/* Hash of name */
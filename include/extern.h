@@ -83,6 +83,11 @@ extern int __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash);
 extern int __wt_bloom_get(WT_BLOOM *bloom, WT_ITEM *key);
 extern int __wt_bloom_close(WT_BLOOM *bloom);
 extern int __wt_bloom_drop(WT_BLOOM *bloom, const char *config);
+extern int __wt_ahi_create(WT_SESSION_IMPL *session, uint32_t entries);
+extern int __wt_ahi_destroy(WT_SESSION_IMPL *session);
+extern int __wt_ahi_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key, uint64_t hash, int *foundp);
+extern void __wt_ahi_insert(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, uint64_t hash);
+extern void __wt_ahi_page_invalidate(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_compact(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_compact_page_skip(WT_SESSION_IMPL *session, WT_REF *ref, int *skipp);
 extern void __wt_btcur_iterate_setup(WT_CURSOR_BTREE *cbt, int next);
@@ -92,6 +97,8 @@ extern int __wt_btcur_reset(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_search(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_search_near(WT_CURSOR_BTREE *cbt, int *exactp);
 extern int __wt_btcur_insert(WT_CURSOR_BTREE *cbt);
+extern int __wt_btcur_search_batch(WT_CURSOR_BTREE *cbt, const WT_ITEM *keys, WT_ITEM *values, int *results, uint32_t count);
+extern int __wt_btcur_insert_batch(WT_CURSOR_BTREE *cbt, const WT_ITEM *keys, const WT_ITEM *values, uint32_t count);
 extern int __wt_btcur_update_check(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_remove(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_update(WT_CURSOR_BTREE *cbt);
@@ -99,6 +106,9 @@ extern int __wt_btcur_next_random(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_compare(WT_CURSOR_BTREE *a_arg, WT_CURSOR_BTREE *b_arg, int *cmpp);
 extern int __wt_btcur_equals( WT_CURSOR_BTREE *a_arg, WT_CURSOR_BTREE *b_arg, int *equalp);
 extern int __wt_btcur_range_truncate(WT_CURSOR_BTREE *start, WT_CURSOR_BTREE *stop);
+extern int __wt_btcur_count_range(WT_CURSOR_BTREE *start, WT_CURSOR_BTREE *stop, int approximate, uint64_t *countp);
+extern int __wt_btree_count_range(WT_SESSION_IMPL *session, WT_ITEM *start, WT_ITEM *stop, int approximate, uint64_t *countp);
+extern int __wt_btree_rank_key(WT_SESSION_IMPL *session, uint64_t rank, int approximate, WT_ITEM *key);
 extern int __wt_btcur_close(WT_CURSOR_BTREE *cbt);
 extern int __wt_debug_set_verbose(WT_SESSION_IMPL *session, const char *v);
 extern int __wt_debug_addr_print( WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size);
@@ -167,11 +177,13 @@ extern int __wt_page_modify_alloc(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *key, WT_ITEM *value, WT_UPDATE *upd, int is_remove);
 extern int __wt_row_insert_alloc(WT_SESSION_IMPL *session, WT_ITEM *key, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep);
 extern int __wt_update_alloc( WT_SESSION_IMPL *session, WT_ITEM *value, WT_UPDATE **updp, size_t *sizep);
-extern WT_UPDATE *__wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd);
+extern WT_UPDATE *__wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd);
 extern void __wt_update_obsolete_free( WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd);
+extern void __wt_update_obsolete_page(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_search_insert( WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key);
 extern int __wt_row_search(WT_SESSION_IMPL *session, WT_ITEM *srch_key, WT_REF *leaf, WT_CURSOR_BTREE *cbt, int insert);
 extern int __wt_row_random(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
+extern int __wt_row_random_sample(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
 extern int __wt_config_initn( WT_SESSION_IMPL *session, WT_CONFIG *conf, const char *str, size_t len);
 extern int __wt_config_init(WT_SESSION_IMPL *session, WT_CONFIG *conf, const char *str);
 extern int __wt_config_subinit( WT_SESSION_IMPL *session, WT_CONFIG *conf, WT_CONFIG_ITEM *item);
@@ -188,6 +200,10 @@ extern int __wt_config_subgets(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cfg, co
 extern void __wt_conn_foc_discard(WT_SESSION_IMPL *session);
 extern int __wt_configure_method(WT_SESSION_IMPL *session, const char *method, const char *uri, const char *config, const char *type, const char *check);
 extern int __wt_config_check(WT_SESSION_IMPL *session, const WT_CONFIG_ENTRY *entry, const char *config, size_t config_len);
+extern int __wt_config_compile(WT_SESSION_IMPL *session, const char *method, const char *config, const char **compiledp);
+extern WT_CONFIG_COMPILED *__wt_config_compiled_find(WT_SESSION_IMPL *session, const char *config);
+extern int __wt_config_compiled_get(WT_SESSION_IMPL *session, WT_CONFIG_COMPILED *cc, WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value);
+extern void __wt_config_compiled_discard(WT_SESSION_IMPL *session);
 extern int __wt_config_collapse( WT_SESSION_IMPL *session, const char **cfg, char **config_ret);
 extern int __wt_config_merge( WT_SESSION_IMPL *session, const char **cfg, const char **config_ret);
 extern int __wt_config_concat( WT_SESSION_IMPL *session, const char **cfg, char **config_ret);
@@ -212,6 +228,13 @@ extern int __wt_cache_config(WT_SESSION_IMPL *session, int reconfigure, const ch
 extern int __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[]);
 extern void __wt_cache_stats_update(WT_SESSION_IMPL *session);
 extern int __wt_cache_destroy(WT_SESSION_IMPL *session);
+extern int __wt_cache_mem_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_cache_mem_destroy(WT_SESSION_IMPL *session);
+extern int __wt_cache_mem_register(WT_SESSION_IMPL *session, size_t size);
+extern int __wt_cache_mem_calloc(WT_SESSION_IMPL *session, size_t number, size_t size, void *retp);
+extern int __wt_cache_mem_realloc(WT_SESSION_IMPL *session, size_t *bytes_allocated_ret, size_t bytes_to_allocate, int aligned, void *retp);
+extern void __wt_cache_mem_free(WT_SESSION_IMPL *session, void *p);
+extern void __wt_cache_mem_stats_update(WT_SESSION_IMPL *session);
 extern int __wt_cache_pool_config(WT_SESSION_IMPL *session, const char **cfg);
 extern int __wt_conn_cache_pool_open(WT_SESSION_IMPL *session);
 extern int __wt_conn_cache_pool_destroy(WT_SESSION_IMPL *session);
@@ -220,6 +243,7 @@ extern int __wt_checkpoint_server_create(WT_SESSION_IMPL *session, const char *c
 extern int __wt_checkpoint_server_destroy(WT_SESSION_IMPL *session);
 extern int __wt_checkpoint_signal(WT_SESSION_IMPL *session, wt_off_t logsize);
 extern int __wt_conn_dhandle_find(WT_SESSION_IMPL *session, const char *name, const char *ckpt, uint32_t flags);
+extern int __wt_conn_dhandle_find_ref(WT_SESSION_IMPL *session, const char *name, const char *ckpt, uint64_t hash);
 extern int __wt_conn_btree_sync_and_close(WT_SESSION_IMPL *session, int final, int force);
 extern int __wt_conn_btree_get(WT_SESSION_IMPL *session, const char *name, const char *ckpt, const char *cfg[], uint32_t flags);
 extern int __wt_conn_btree_apply(WT_SESSION_IMPL *session, int apply_checkpoints, const char *uri, int (*func)(WT_SESSION_IMPL *, const char *[]), const char *cfg[]);
@@ -230,6 +254,16 @@ extern int __wt_conn_dhandle_discard_single(WT_SESSION_IMPL *session, int final)
 extern int __wt_conn_dhandle_discard(WT_SESSION_IMPL *session);
 extern int __wt_connection_init(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_hs_create(WT_SESSION_IMPL *session);
+extern int __wt_hs_destroy(WT_SESSION_IMPL *session);
+extern int __wt_hs_cursor_close(WT_SESSION_IMPL *session);
+extern int __wt_hs_evict_begin(WT_SESSION_IMPL *session, int *lockedp, uint64_t *resolvedp);
+extern int __wt_hs_evict_end(WT_SESSION_IMPL *session);
+extern int __wt_hs_insert(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key, uint64_t seq, uint64_t stop_txn, WT_ITEM *value);
+extern int __wt_hs_search(WT_SESSION_IMPL *session, WT_ITEM *key, WT_UPDATE **updp);
+extern int __wt_hs_cursor_read(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ROW *rip, WT_UPDATE **updp);
+extern int __wt_hs_update_check(WT_SESSION_IMPL *session, WT_PAGE *page, WT_ITEM *key);
+extern int __wt_hs_sweep(WT_SESSION_IMPL *session);
 extern int __wt_log_truncate_files( WT_SESSION_IMPL *session, WT_CURSOR *cursor, const char *cfg[]);
 extern int __wt_logmgr_create(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_logmgr_open(WT_SESSION_IMPL *session);
@@ -237,6 +271,7 @@ extern int __wt_logmgr_destroy(WT_SESSION_IMPL *session);
 extern int __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[]);
 extern int __wt_connection_close(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[]);
+extern void __wt_conn_stat_refresh(WT_SESSION_IMPL *session);
 extern void __wt_conn_stat_init(WT_SESSION_IMPL *session);
 extern int __wt_statlog_log_one(WT_SESSION_IMPL *session);
 extern int __wt_statlog_create(WT_SESSION_IMPL *session, const char *cfg[]);
@@ -252,6 +287,8 @@ extern int __wt_curconfig_open(WT_SESSION_IMPL *session, const char *uri, const
 extern int __wt_curds_open( WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_DATA_SOURCE *dsrc, WT_CURSOR **cursorp);
 extern int __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp);
 extern int __wt_curfile_update_check(WT_CURSOR *cursor);
+extern int __wt_curfile_cache_child(WT_CURSOR *cursor);
+extern int __wt_curfile_reopen_child(WT_CURSOR *owner, WT_CURSOR *cursor);
 extern int __wt_curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[], int bulk, int bitmap, WT_CURSOR **cursorp);
 extern int __wt_curfile_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
 extern int __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
@@ -285,16 +322,30 @@ extern int __wt_cursor_get_value(WT_CURSOR *cursor, ...);
 extern int __wt_cursor_get_valuev(WT_CURSOR *cursor, va_list ap);
 extern void __wt_cursor_set_value(WT_CURSOR *cursor, ...);
 extern void __wt_cursor_set_valuev(WT_CURSOR *cursor, va_list ap);
+extern int __wt_cursor_pack_compiled(WT_SESSION_IMPL* session, WT_CURSOR* cursor, int key, WT_PACK_COMPILED** pcp);
 extern int __wt_cursor_close(WT_CURSOR *cursor);
+extern int __wt_cursor_cache_key(WT_CURSOR *cursor, const char *uri, const char *config);
+extern int __wt_cursor_cache(WT_CURSOR *cursor);
+extern void __wt_cursor_reopen(WT_CURSOR *cursor);
+extern void __wt_cursor_cache_child(WT_CURSOR *cursor);
+extern void __wt_cursor_reopen_child(WT_CURSOR *owner, WT_CURSOR *cursor);
+extern int __wt_cursor_cache_get(WT_SESSION_IMPL *session, const char *uri, const char *config, WT_CURSOR **cursorp);
+extern int __wt_cursor_cache_discard(WT_SESSION_IMPL *session);
 extern int __wt_cursor_equals(WT_CURSOR *cursor, WT_CURSOR *other, int *equalp);
 extern int __wt_cursor_reconfigure(WT_CURSOR *cursor, const char *config);
 extern int __wt_cursor_dup_position(WT_CURSOR *to_dup, WT_CURSOR *cursor);
+extern int __wt_cursor_batch_value(WT_SESSION_IMPL *session, WT_CURSOR *cursor, const WT_ITEM *value, WT_ITEM *out);
+extern void __wt_cursor_batch_fixup(WT_CURSOR *cursor, WT_ITEM *values, const int *results, const uint32_t *order, uint32_t count);
+extern int __wt_cursor_search_batch(WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, uint32_t count);
+extern int __wt_cursor_insert_batch(WT_CURSOR *cursor, const WT_ITEM *keys, const WT_ITEM *values, uint32_t count);
 extern int __wt_cursor_init(WT_CURSOR *cursor, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
 extern int __wt_curtable_get_key(WT_CURSOR *cursor, ...);
 extern int __wt_curtable_get_value(WT_CURSOR *cursor, ...);
 extern void __wt_curtable_set_key(WT_CURSOR *cursor, ...);
 extern void __wt_curtable_set_value(WT_CURSOR *cursor, ...);
 extern int __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop);
+extern int __wt_curtable_idx_batch_txn(WT_SESSION_IMPL* session, int commit);
+extern int __wt_curtable_idx_batch_read(WT_SESSION_IMPL* session, WT_TABLE* table);
 extern int __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[], WT_CURSOR **cursorp);
 extern int __wt_evict_file(WT_SESSION_IMPL *session, int syncop);
 extern void __wt_evict_list_clear_page(WT_SESSION_IMPL *session, WT_REF *ref);
@@ -356,31 +407,41 @@ extern int __wt_log_slot_wait(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
 extern int64_t __wt_log_slot_release(WT_LOGSLOT *slot, uint64_t size);
 extern int __wt_log_slot_free(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
 extern int __wt_log_slot_grow_buffers(WT_SESSION_IMPL *session, size_t newsize);
+extern int __wt_lsm_range_del_insert(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_CURSOR *rc, const WT_ITEM *start, const WT_ITEM *stop);
 extern int __wt_clsm_init_merge( WT_CURSOR *cursor, u_int start_chunk, uint32_t start_id, u_int nchunks);
 extern int __wt_clsm_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
+extern int __wt_clsm_range_truncate(WT_SESSION_IMPL *session, WT_CURSOR *start, WT_CURSOR *stop);
 extern int __wt_lsm_manager_config(WT_SESSION_IMPL *session, const char **cfg);
 extern int __wt_lsm_manager_reconfig(WT_SESSION_IMPL *session, const char **cfg);
 extern int __wt_lsm_manager_start(WT_SESSION_IMPL *session);
+extern void __wt_lsm_manager_bandwidth(WT_SESSION_IMPL *session, int merge, uint64_t bytes, struct timespec *start);
 extern void __wt_lsm_manager_free_work_unit( WT_SESSION_IMPL *session, WT_LSM_WORK_UNIT *entry);
 extern int __wt_lsm_manager_destroy(WT_SESSION_IMPL *session);
 extern int __wt_lsm_manager_clear_tree( WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_manager_pop_entry( WT_SESSION_IMPL *session, uint32_t type, WT_LSM_WORK_UNIT **entryp);
 extern int __wt_lsm_manager_push_entry(WT_SESSION_IMPL *session, uint32_t type, uint32_t flags, WT_LSM_TREE *lsm_tree);
-extern int __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks, WT_LSM_CHUNK *chunk);
+extern int __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks, WT_LSM_CHUNK **chunks, u_int nparts);
+extern int __wt_lsm_merge_policy(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, u_int *policyp);
+extern const char *__wt_lsm_merge_policy_name(u_int policy);
 extern int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id);
 extern int __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern int __wt_curstat_lsm_init( WT_SESSION_IMPL *session, const char *uri, WT_CURSOR_STAT *cst);
 extern int __wt_lsm_tree_close_all(WT_SESSION_IMPL *session);
 extern int __wt_lsm_tree_bloom_name(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t id, const char **retp);
+extern int __wt_lsm_tree_range_del_name(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t id, const char **retp);
 extern int __wt_lsm_tree_chunk_name(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t id, const char **retp);
 extern int __wt_lsm_tree_set_chunk_size( WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk);
 extern int __wt_lsm_tree_setup_chunk( WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk);
 extern int __wt_lsm_tree_setup_bloom( WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk);
+extern int __wt_lsm_tree_setup_range_del(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk);
+extern int __wt_lsm_tree_range_del_create(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk);
 extern int __wt_lsm_tree_create(WT_SESSION_IMPL *session, const char *uri, int exclusive, const char *config);
 extern int __wt_lsm_tree_get(WT_SESSION_IMPL *session, const char *uri, int exclusive, WT_LSM_TREE **treep);
 extern void __wt_lsm_tree_release(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern void __wt_lsm_tree_throttle( WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int decrease_only);
+extern void __wt_lsm_tree_throttle_admit(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, size_t size);
+extern uint64_t __wt_lsm_tree_throttle_debt(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_tree_switch(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_tree_retire_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks);
 extern int __wt_lsm_tree_drop( WT_SESSION_IMPL *session, const char *name, const char *cfg[]);
@@ -462,6 +523,8 @@ extern int __wt_mmap(WT_SESSION_IMPL *session, WT_FH *fh, void *mapp, size_t *le
 extern int __wt_mmap_preload(WT_SESSION_IMPL *session, const void *p, size_t size);
 extern int __wt_mmap_discard(WT_SESSION_IMPL *session, void *p, size_t size);
 extern int __wt_munmap(WT_SESSION_IMPL *session, WT_FH *fh, void *map, size_t len, void **mappingcookie);
+extern int __wt_mmap_huge(WT_SESSION_IMPL *session, size_t len, size_t align, void *mapp, int *hugep);
+extern int __wt_munmap_huge(WT_SESSION_IMPL *session, void *map, size_t len);
 extern int __wt_cond_alloc(WT_SESSION_IMPL *session, const char *name, int is_signalled, WT_CONDVAR **condp);
 extern int __wt_cond_wait(WT_SESSION_IMPL *session, WT_CONDVAR *cond, uint64_t usecs);
 extern int __wt_cond_signal(WT_SESSION_IMPL *session, WT_CONDVAR *cond);
@@ -507,6 +570,10 @@ extern int __wt_struct_confchk(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *v);
 extern int __wt_struct_size(WT_SESSION_IMPL *session, size_t *sizep, const char *fmt, ...);
 extern int __wt_struct_pack(WT_SESSION_IMPL *session, void *buffer, size_t size, const char *fmt, ...);
 extern int __wt_struct_unpack(WT_SESSION_IMPL *session, const void *buffer, size_t size, const char *fmt, ...);
+extern int __wt_struct_compile(WT_SESSION_IMPL* session, const char* fmt, WT_PACK_COMPILED** pcp);
+extern void __wt_struct_compiled_free(WT_SESSION_IMPL* session, WT_PACK_COMPILED** pcp);
+extern void __wt_struct_compiled_discard(WT_SESSION_IMPL* session);
+extern int __wt_struct_unpack_batch(WT_SESSION_IMPL* session, WT_PACK_COMPILED* pc, const WT_ITEM* records, u_int nrecords, void** columns);
 extern int __wt_ovfl_discard_add(WT_SESSION_IMPL *session, WT_PAGE *page, WT_CELL *cell);
 extern void __wt_ovfl_discard_free(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_ovfl_reuse_search(WT_SESSION_IMPL *session, WT_PAGE *page, uint8_t **addrp, size_t *addr_sizep, const void *value, size_t value_size);
@@ -578,6 +645,8 @@ extern void __wt_session_close_cache(WT_SESSION_IMPL *session);
 extern int __wt_session_get_btree(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint, const char *cfg[], uint32_t flags);
 extern int __wt_session_lock_checkpoint(WT_SESSION_IMPL *session, const char *checkpoint);
 extern int __wt_salvage(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_session_dump(WT_SESSION_IMPL *session, const char *uri, const char *filename, const char *cfg[]);
+extern int __wt_session_load(WT_SESSION_IMPL *session, const char *uri, const char *filename, const char *cfg[]);
 extern uint32_t __wt_cksum(const void *chunk, size_t len);
 extern void __wt_cksum_init(void);
 extern void __wt_event_handler_set(WT_SESSION_IMPL *session, WT_EVENT_HANDLER *handler);
@@ -607,6 +676,7 @@ extern uint64_t __wt_hash_fnv64(const void *string, size_t len);
 extern int __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, int *busyp);
 extern int __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern void __wt_hazard_close(WT_SESSION_IMPL *session);
+extern int __wt_hazard_gen_wait(WT_SESSION_IMPL *session);
 extern int __wt_raw_to_hex( WT_SESSION_IMPL *session, const uint8_t *from, size_t size, WT_ITEM *to);
 extern int __wt_raw_to_esc_hex( WT_SESSION_IMPL *session, const uint8_t *from, size_t size, WT_ITEM *to);
 extern int __wt_hex2byte(const u_char *from, u_char *to);
@@ -618,6 +688,11 @@ extern void __wt_huffman_close(WT_SESSION_IMPL *session, void *huffman_arg);
 extern int __wt_print_huffman_code(void *huffman_arg, uint16_t symbol);
 extern int __wt_huffman_encode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *from_arg, size_t from_len, WT_ITEM *to_buf);
 extern int __wt_huffman_decode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *from_arg, size_t from_len, WT_ITEM *to_buf);
+extern void __wt_latency_record(WT_SESSION_IMPL *session, u_int op, struct timespec *start);
+extern void __wt_latency_aggregate(WT_SESSION_IMPL *session, WT_LATENCY_HIST *hist);
+extern void __wt_latency_clear(WT_SESSION_IMPL *session);
+extern void __wt_latency_stats_update(WT_SESSION_IMPL *session);
+extern int __wt_latency_statlog(WT_SESSION_IMPL *session, FILE *fp, const char *stamp, const char *name);
 extern int __wt_spin_lock_register_lock(WT_SESSION_IMPL *session, WT_SPINLOCK *t);
 extern void __wt_spin_lock_unregister_lock(WT_SESSION_IMPL *session, WT_SPINLOCK *t);
 extern int __wt_spin_lock_register_caller(WT_SESSION_IMPL *session, const char *name, const char *file, int line, int *idp);
@@ -633,6 +708,8 @@ extern int __wt_buf_grow_worker(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t s
 extern int __wt_buf_fmt(WT_SESSION_IMPL *session, WT_ITEM *buf, const char *fmt, ...) WT_GCC_FUNC_DECL_ATTRIBUTE((format (printf, 3, 4)));
 extern int __wt_buf_catfmt(WT_SESSION_IMPL *session, WT_ITEM *buf, const char *fmt, ...) WT_GCC_FUNC_DECL_ATTRIBUTE((format (printf, 3, 4)));
 extern int __wt_scr_alloc_func(WT_SESSION_IMPL *session, size_t size, WT_ITEM **scratchp);
+extern int __wt_io_buf_get(WT_SESSION_IMPL *session, WT_ITEM **bufp);
+extern void __wt_io_buf_put(WT_SESSION_IMPL *session, WT_ITEM **bufp);
 extern void __wt_scr_discard(WT_SESSION_IMPL *session);
 extern void *__wt_ext_scr_alloc( WT_EXTENSION_API *wt_api, WT_SESSION *wt_session, size_t size);
 extern void __wt_ext_scr_free(WT_EXTENSION_API *wt_api, WT_SESSION *wt_session, void *p);
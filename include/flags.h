@@ -36,26 +36,30 @@
 #define	WT_READ_NO_GEN					0x00000008
 #define	WT_READ_NO_WAIT					0x00000010
 #define	WT_READ_PREV					0x00000020
-#define	WT_READ_SKIP_INTL				0x00000040
-#define	WT_READ_TRUNCATE				0x00000080
-#define	WT_READ_WONT_NEED				0x00000100
-#define	WT_SESSION_CAN_WAIT				0x00000001
-#define	WT_SESSION_CLEAR_EVICT_WALK			0x00000002
-#define	WT_SESSION_DISCARD_FORCE			0x00000004
-#define	WT_SESSION_HANDLE_LIST_LOCKED			0x00000008
-#define	WT_SESSION_INTERNAL				0x00000010
-#define	WT_SESSION_LOGGING_INMEM			0x00000020
-#define	WT_SESSION_NO_CACHE				0x00000040
-#define	WT_SESSION_NO_CACHE_CHECK			0x00000080
-#define	WT_SESSION_NO_DATA_HANDLES			0x00000100
-#define	WT_SESSION_NO_LOGGING				0x00000200
-#define	WT_SESSION_NO_SCHEMA_LOCK			0x00000400
-#define	WT_SESSION_SALVAGE_CORRUPT_OK			0x00000800
-#define	WT_SESSION_SCHEMA_LOCKED			0x00001000
-#define	WT_SESSION_SERVER_ASYNC				0x00002000
-#define	WT_SESSION_TABLE_LOCKED				0x00004000
+#define	WT_READ_SCAN					0x00000040
+#define	WT_READ_SKIP_INTL				0x00000080
+#define	WT_READ_TRUNCATE				0x00000100
+#define	WT_READ_WONT_NEED				0x00000200
+#define	WT_SESSION_CACHE_CURSORS			0x00000001
+#define	WT_SESSION_CAN_WAIT				0x00000002
+#define	WT_SESSION_CLEAR_EVICT_WALK			0x00000004
+#define	WT_SESSION_DISCARD_FORCE			0x00000008
+#define	WT_SESSION_HANDLE_LIST_LOCKED			0x00000010
+#define	WT_SESSION_INTERNAL				0x00000020
+#define	WT_SESSION_LOGGING_INMEM			0x00000040
+#define	WT_SESSION_NO_CACHE				0x00000080
+#define	WT_SESSION_NO_CACHE_CHECK			0x00000100
+#define	WT_SESSION_NO_DATA_HANDLES			0x00000200
+#define	WT_SESSION_NO_LOGGING				0x00000400
+#define	WT_SESSION_NO_SCHEMA_LOCK			0x00000800
+#define	WT_SESSION_NO_TXN				0x00001000
+#define	WT_SESSION_SALVAGE_CORRUPT_OK			0x00002000
+#define	WT_SESSION_SCHEMA_LOCKED			0x00004000
+#define	WT_SESSION_SERVER_ASYNC				0x00008000
+#define	WT_SESSION_TABLE_LOCKED				0x00010000
 #define	WT_SKIP_UPDATE_ERR				0x00000002
-#define	WT_SKIP_UPDATE_RESTORE				0x00000004
+#define	WT_SKIP_UPDATE_HS				0x00000004
+#define	WT_SKIP_UPDATE_RESTORE				0x00000008
 #define	WT_SYNC_CHECKPOINT				0x00000001
 #define	WT_SYNC_CLOSE					0x00000002
 #define	WT_SYNC_DISCARD					0x00000004
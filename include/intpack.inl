@@ -110,6 +110,16 @@ static inline int __wt_vunpack_posint(const uint8_t **pp, size_t maxlen, uint64_
 	len = (*p++ & 0xf);
 	WT_SIZE_CHECK(len + 1, maxlen);
 
+#if defined(__GNUC__) && !defined(WORDS_BIGENDIAN)
+	/*ٻ8ֽʱһζֽڽλֽڵѭ*/
+	if (maxlen > sizeof(x) && len != 0 && len <= sizeof(x)) {
+		memcpy(&x, p, sizeof(x));
+		*retp = __builtin_bswap64(x) >> ((sizeof(x) - len) << 3);
+		*pp = p + len;
+		return (0);
+	}
+#endif
+
 	for (x = 0; len != 0; --len)
 		x = (x << 8) | *p++;
 
@@ -252,7 +262,6 @@ static inline int __wt_vunpack_int(const uint8_t **pp, size_t maxlen, int64_t *x
 		*xp = (int64_t)(GET_BITS(*p++, 5, 0) << 8);
 		*xp |= *p++;
 		*xp += NEG_2BYTE_MIN;
-		p += 2;
 		break;
 
 	case NEG_1BYTE_MARKER:
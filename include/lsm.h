@@ -28,7 +28,6 @@ struct __wt_lsm_worker_args
 #define	WT_CLSM_ITERATE_PREV    0x04    /* Backward iteration */
 #define	WT_CLSM_MERGE           0x08    /* Merge cursor, don't update */
 #define	WT_CLSM_MINOR_MERGE		0x10    /* Minor merge, include tombstones */
-#define	WT_CLSM_MULTIPLE        0x20    /* Multiple cursors have values for the current key */
 #define	WT_CLSM_OPEN_READ		0x40    /* Open for reads */
 #define	WT_CLSM_OPEN_SNAPSHOT	0x80    /* Open for snapshot isolation */
 
@@ -48,14 +47,25 @@ struct __wt_cursor_lsm
 	WT_CURSOR**		cursors;					/* Cursor handles. */
 	size_t			cursor_alloc;
 
+	WT_CURSOR**		range_dels;					/* Range tombstone cursor handles, cursors±һһӦ */
+	size_t			range_del_alloc;
+
 	WT_CURSOR*		current;     				/* The current cursor for iteration */
+
+	/*
+	 * Merge heap for iteration: the slots of the positioned chunk cursors,
+	 * ordered by key in the iteration direction, newer chunks first among
+	 * equal keys.  Only valid while WT_CLSM_ITERATE_NEXT/PREV is set.
+	 */
+	u_int*			heap;
+	size_t			heap_alloc;
+	u_int			heap_entries;
+
 	WT_LSM_CHUNK*	primary_chunk;				/* The current primary chunk */
 
 	uint64_t*		switch_txn;					/* Switch txn for each chunk */
 	size_t			txnid_alloc;
 
-	u_int			update_count;				/* Updates performed. */
-
 	uint32_t		flags;
 };
 
@@ -64,12 +74,19 @@ struct __wt_cursor_lsm
 #define	WT_LSM_CHUNK_MERGING	0x02
 #define	WT_LSM_CHUNK_ONDISK		0x04
 #define	WT_LSM_CHUNK_STABLE		0x08
+#define	WT_LSM_CHUNK_RANGE_DEL	0x10
 
 /*LSM CHUNKṹ*/
 struct  __wt_lsm_chunk
 {
 	const char*		uri;						/* data sourceuri */
 	const char*		bloom_uri;					/* Ӧbloom filter */
+	/*
+	 * Range tombstones written to this chunk: a btree keyed by the start
+	 * of each removed range, the value is the inclusive stop key.  A range
+	 * tombstone hides the keys of the older chunks only.
+	 */
+	const char*		range_del_uri;
 	struct timespec create_ts;					/* ʱ */
 	uint64_t		count;						/* chunk洢ļ¼ */		
 	uint64_t		size;						/* chunkĿռС */
@@ -133,11 +150,23 @@ struct __wt_lsm_manager
 	uint32_t		lsm_workers;	/* Current number of LSM workers */
 	uint32_t		lsm_workers_max;/* LSMworkersĿ*/
 
+	/*lsm treeworkeṛ߳flushmergeĴconnectionĲֵ*/
+	uint64_t		flush_bw;		/* Measured chunk flush bytes per second */
+	uint64_t		merge_bw;		/* Measured merge bytes per second */
+	uint32_t		throttle_trees;	/* Trees with throttled updates */
+
 	WT_LSM_WORKER_ARGS lsm_worker_cookies[WT_LSM_MAX_WORKERS];
 };
 
 #define WT_LSM_AGGRESSIVE_THRESHOLD		5
 
+/*lsm treemergeԣlsm_merge.cвԱ±һһӦ*/
+#define	WT_LSM_MERGE_LEVELED			0	/* Leveled, per-level size ratio */
+#define	WT_LSM_MERGE_SIZE				1	/* Size-tiered heuristic */
+#define	WT_LSM_MERGE_TIERED				2	/* Same generation runs only */
+#define	WT_LSM_MERGE_TIME_WINDOW		3	/* Chunks created in one time window */
+#define	WT_LSM_MERGE_POLICIES			4
+
 #define	LSM_TREE_MAX_QUEUE				100
 
 /*bloom filterĴ*/
@@ -176,8 +205,16 @@ struct __wt_lsm_tree
 	WT_DSRC_STATS	stats;								/*LSMͳ*/
 	uint64_t		dsk_gen;
 
-	uint64_t		ckpt_throttle;						/* Rate limiting due to checkpoints */
-	uint64_t		merge_throttle;						/* Rate limiting due to merges */
+	/*
+	 * Update throttling is a token bucket: the admitted rate is refilled
+	 * from the measured flush and merge bandwidth, the bucket itself is a
+	 * virtual clock, the time at which the updates admitted so far have
+	 * drained.
+	 */
+	uint64_t		ckpt_rate;							/* Bytes/sec admitted due to checkpoints, 0 if unlimited */
+	uint64_t		merge_rate;							/* Bytes/sec admitted due to merges, 0 if unlimited */
+	uint64_t		throttle_rate;						/* Bytes/sec admitted, 0 if unlimited */
+	volatile uint64_t throttle_tat;						/* Bucket drained time (nsecs) */
 	uint64_t		chunk_fill_ms;						/* Estimate of time to fill a chunk */
 	struct timespec last_flush_ts;						/* Timestamp last flush finished */
 	struct timespec work_push_ts;						/* Timestamp last work unit added */
@@ -191,6 +228,14 @@ struct __wt_lsm_tree
 	uint64_t		chunk_size;
 	uint64_t		chunk_max;							/* Maximum chunk a merge creates */
 	u_int			merge_min, merge_max;				/* ٶٸchunkһϲٸ*/
+	u_int			merge_policy;						/* Merge policy, WT_LSM_MERGE_* */
+	u_int			merge_ratio;						/* Leveled: size ratio between levels */
+	u_int			merge_threads;						/* Key ranges a merge is split into */
+	uint64_t		merge_window;						/* Time-window: window length (secs) */
+
+	/*дŴļݣflushдֽmergeдֽ, ־ûlsm meta*/
+	uint64_t		bytes_flushed;						/* Bytes written by chunk flushes */
+	uint64_t		bytes_merged;						/* Bytes written by merges */
 
 	u_int			merge_idle;							/* Count of idle merge threads */
 
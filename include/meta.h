@@ -26,6 +26,8 @@
 
 #define	WT_METAFILE_ID		0			/* Metadata file ID */
 
+#define	WT_HS_URI		"file:WiredTigerHS.wt"		/* History store URI */
+
 #define	WT_METADATA_VERSION	"WiredTiger version"		/* Version keys */
 #define	WT_METADATA_VERSION_STR	"WiredTiger version string"
 
@@ -43,6 +43,22 @@ typedef struct
 	int					genname;
 } WT_PACK_NAME;
 
+/*
+ * WT_PACK_COMPILED --
+ *	A format string parsed once: repeat counts are expanded to one entry per
+ * field, so records are packed and unpacked by walking an array instead of
+ * parsing the format for every record.
+ */
+struct __wt_pack_compiled
+{
+	const char*			src;			/* Format string compiled, not owned */
+	char*				fmt;			/* Copy of the format */
+	WT_PACK_VALUE*		fields;			/* One entry per field */
+	u_int				nfields;
+	int					fixed;			/* All fields have a fixed packed size */
+	size_t				fixed_len;		/* Packed size of a fixed record */
+};
+
 /*ͨfmtַһWT_PACK*/
 static inline int __pack_initn(WT_SESSION_IMPL* session, WT_PACK* pack, const char* fmt, size_t len)
 {
@@ -647,6 +663,107 @@ static inline int __wt_struct_unpackv(WT_SESSION_IMPL* session, const void* buff
 	return 0;
 }
 
+/*
+ * __unpack_read_fast --
+ *	Version of __unpack_read for compiled formats: fixed-width fields and
+ * single byte packed integers, the common case for small values, are decoded
+ * without going through the general switch.
+ */
+static inline int __unpack_read_fast(WT_SESSION_IMPL* session, WT_PACK_VALUE* pv, const uint8_t** pp, size_t maxlen)
+{
+	const uint8_t *p;
+
+	p = *pp;
+	if (maxlen != 0) {
+		switch (pv->type) {
+		case 'B':
+		case 't':
+			pv->u.u = *p;
+			*pp = p + 1;
+			return (0);
+		case 'H':
+		case 'I':
+		case 'L':
+		case 'Q':
+		case 'r':
+			if ((*p & 0xc0) != POS_1BYTE_MARKER)
+				break;
+			pv->u.u = GET_BITS(*p, 6, 0);
+			*pp = p + 1;
+			return (0);
+		case 'h':
+		case 'i':
+		case 'l':
+		case 'q':
+			if ((*p & 0xc0) == POS_1BYTE_MARKER)
+				pv->u.i = (int64_t)GET_BITS(*p, 6, 0);
+			else if ((*p & 0xc0) == NEG_1BYTE_MARKER)
+				pv->u.i = NEG_1BYTE_MIN + (int64_t)GET_BITS(*p, 6, 0);
+			else
+				break;
+			*pp = p + 1;
+			return (0);
+		}
+	}
+
+	return (__unpack_read(session, pv, pp, maxlen));
+}
+
+/*ñĸʽpackĳ*/
+static inline int __wt_struct_sizev_compiled(WT_SESSION_IMPL* session, WT_PACK_COMPILED* pc, size_t* sizep, va_list ap)
+{
+	WT_PACK_VALUE pv;
+	size_t total;
+	u_int i;
+
+	for (total = 0, i = 0; i < pc->nfields; ++i) {
+		pv = pc->fields[i];
+		WT_PACK_GET(session, pv, ap);
+		total += __pack_size(session, &pv);
+	}
+
+	*sizep = total;
+	return (0);
+}
+
+/*ñĸʽpackbuffer*/
+static inline int __wt_struct_packv_compiled(WT_SESSION_IMPL* session, WT_PACK_COMPILED* pc, void* buffer, size_t size, va_list ap)
+{
+	WT_PACK_VALUE pv;
+	uint8_t *p, *end;
+	u_int i;
+
+	p = buffer;
+	end = p + size;
+	for (i = 0; i < pc->nfields; ++i) {
+		pv = pc->fields[i];
+		WT_PACK_GET(session, pv, ap);
+		WT_RET(__pack_write(session, &pv, &p, (size_t)(end - p)));
+	}
+
+	WT_ASSERT(session, p <= end);
+	return (0);
+}
+
+/*ñĸʽbufferunpackеfield*/
+static inline int __wt_struct_unpackv_compiled(WT_SESSION_IMPL* session, WT_PACK_COMPILED* pc, const void* buffer, size_t size, va_list ap)
+{
+	WT_PACK_VALUE pv;
+	const uint8_t *p, *end;
+	u_int i;
+
+	p = buffer;
+	end = p + size;
+	for (i = 0; i < pc->nfields; ++i) {
+		pv = pc->fields[i];
+		WT_RET(__unpack_read_fast(session, &pv, &p, (size_t)(end - p)));
+		WT_UNPACK_PUT(session, pv, ap);
+	}
+
+	WT_ASSERT(session, p <= end);
+	return (0);
+}
+
 /*0ѹжϼsizeռǷϷ*/
 static inline void __wt_struct_size_adjust(WT_SESSION_IMPL *session, size_t *sizep)
 {
@@ -41,6 +41,9 @@ struct __wt_index {
 	const char*		key_plan;		/* Key projection plan */
 	const char*		value_plan;		/* Value projection plan */
 
+	WT_CONFIG_ITEM	incconf;		/* Columns stored in the index value */
+	const char*		inc_plan;		/* Index value projection plan */
+
 	const char*		idxkey_format;	/* Index key format (hides primary) */
 	const char*		exkey_format;	/* Key format for custom extractors */
 
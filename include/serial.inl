@@ -173,10 +173,13 @@ static inline int __wt_update_serial(WT_SESSION_IMPL *session, WT_PAGE *page,
 
 	if(upd->next != NULL){
 		F_CAS_ATOMIC(page, WT_PAGE_SCANNING, ret);
-		if(ret != 0)
+		if(ret != 0){
+			/*߳ɨ裬ûмupdate lisṱ̵߳ĺ̨*/
+			page->modify->update_gc_pending = 1;
 			return 0;
+		}
 		/*ڵupdate list,õupdԪͷ*/
-		obsolete = __wt_update_obsolete_check(session, upd->next);
+		obsolete = __wt_update_obsolete_check(session, page, upd->next);
 		F_CLR_ATOMIC(page, WT_PAGE_SCANNING);
 		if(obsolete != NULL)
 			__wt_update_obsolete_free(session, page, obsolete);
@@ -6,9 +6,9 @@
 struct __wt_data_handle_cache
 {
 	WT_DATA_HANDLE* dhandle;
+	uint64_t		name_hash;		/*dhandle namehash, ѰַбȽ*/
 
 	SLIST_ENTRY(__wt_data_handle_cache) l;
-	SLIST_ENTRY(__wt_data_handle_cache) hashl;
 };
 
 struct __wt_hazard
@@ -66,12 +66,23 @@ struct __wt_session_impl
 	u_int					scratch_alloc;
 	size_t					scratch_cached;
 
+	/*ȡʹõĶI/Oأڴֱƽpage image*/
+#define	WT_SESSION_IO_BUFS		4
+	WT_ITEM*				io_bufs[WT_SESSION_IO_BUFS];
+
+	/*key/value formatformatĵֱַӳ*/
+#define	WT_SESSION_PACK_CACHE	16
+	WT_PACK_COMPILED*		pack_cache[WT_SESSION_PACK_CACHE];
+
 	WT_ITEM					err;
 
 	WT_TXN_ISOLATION		isolation;
 	WT_TXN					txn;
 
 	u_int					ncursors;
+	u_int					ncursors_cached;				/*cursor cacheлcursor*/
+	u_int					idx_batch_cursors;				/*άtable cursorύʱҪӦǵkey*/
+	WT_CURSOR*				hs_cursor;						/*history storecursorһζʱ*/
 
 	void*					block_manager;					/*һBLOCK WT_EXTWT_SIZEĶ󻺳*/
 	int	(*block_manager_cleanup)(WT_SESSION_IMPL *);
@@ -93,9 +104,17 @@ struct __wt_session_impl
 #define WT_SESSION_CLEAR_SIZE(s) (WT_PTRDIFF(&(s)->rnd[0], s))
 	uint32_t				rnd[2];		/*Ĳ״̬*/
 
-	SLIST_HEAD(__dhandles_hash, __wt_data_handle_cache) *dhhash;
+	/*dhandle cacheĿѰַhashС2ݴΣsessionʱͷ*/
+#define	WT_SESSION_DHTABLE_MIN	64
+	WT_DATA_HANDLE_CACHE**	dhtable;
+	uint32_t				dhtable_size;
+	uint32_t				dhtable_cnt;
 	SLIST_HEAD(__tables_hash, __wt_table) *tablehash;
 
+	/*رպ󻺴cursoruri hashͰsessionʱͷ*/
+#define	WT_SESSION_CURSOR_CACHE_MAX	128
+	TAILQ_HEAD(__cursors_cache, __wt_cursor) *cursor_cache;
+
 	struct __wt_split_stash
 	{
 		uint64_t			split_gen;
@@ -107,12 +126,19 @@ struct __wt_session_impl
 	size_t					split_stash_alloc;  /*sessionܵĻ*/
 
 	uint64_t				split_gen;		/*ձʾֵ*/
+	volatile uint64_t		dhandle_gen;	/*connection dhandle hashʱgeneration*/
+	volatile uint64_t		hazard_gen;		/*sessionhazard epoch0ʾepoch*/
 
 #define	WT_SESSION_FIRST_USE(s)		((s)->hazard == NULL)
 #define WT_HAZARD_INCR		10
+#define WT_HAZARD_GEN_SPINS	1000
 
 	uint32_t				hazard_size;
 	uint32_t				nhazard;
+	uint32_t				hazard_inuse;	/*hazardʹùλãevictionֻɨ赽*/
 	WT_HAZARD*				hazard;
+
+	/*ӳֱͼֻɱsession߳д룬sessionʱ*/
+	WT_LATENCY_HIST			latency[WT_LATENCY_OPS];
 };
 /**************************************************************/
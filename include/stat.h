@@ -70,24 +70,37 @@ struct __wt_stats
 } while (0)
 
 
+/*
+ * Connection statistics are updated in WT_STAT_CONN_SHARDS copies, selected
+ * by session ID, so threads bumping the same hot counter don't share a cache
+ * line.  The shards are summed into WT_CONNECTION_IMPL.stats when statistics
+ * are read.  Values that are set rather than counted always go to shard 0,
+ * so the sum is the value last set.
+ */
+#define	WT_STAT_CONN_SHARDS		16
+
+#define	WT_STAT_CONN_SHARD(session)									\
+	(&S2C(session)->stat_shard[(session)->id & (WT_STAT_CONN_SHARDS - 1)].stats)
+#define	WT_STAT_CONN_SHARD_SET(session)	(&S2C(session)->stat_shard[0].stats)
+
 #define	WT_STAT_FAST_CONN_ATOMIC_DECRV(session, fld, value)		\
-	WT_STAT_FAST_ATOMIC_DECRV(session, &S2C(session)->stats, fld, value)
+	WT_STAT_FAST_ATOMIC_DECRV(session, WT_STAT_CONN_SHARD(session), fld, value)
 #define	WT_STAT_FAST_CONN_ATOMIC_DECR(session, fld)			\
-	WT_STAT_FAST_ATOMIC_DECR(session, &S2C(session)->stats, fld)
+	WT_STAT_FAST_ATOMIC_DECR(session, WT_STAT_CONN_SHARD(session), fld)
 #define	WT_STAT_FAST_CONN_ATOMIC_INCRV(session, fld, value)		\
-	WT_STAT_FAST_ATOMIC_INCRV(session, &S2C(session)->stats, fld, value)
+	WT_STAT_FAST_ATOMIC_INCRV(session, WT_STAT_CONN_SHARD(session), fld, value)
 #define	WT_STAT_FAST_CONN_ATOMIC_INCR(session, fld)			\
-	WT_STAT_FAST_ATOMIC_INCR(session, &S2C(session)->stats, fld)
+	WT_STAT_FAST_ATOMIC_INCR(session, WT_STAT_CONN_SHARD(session), fld)
 #define	WT_STAT_FAST_CONN_DECR(session, fld)				\
-	WT_STAT_FAST_DECR(session, &S2C(session)->stats, fld)
+	WT_STAT_FAST_DECR(session, WT_STAT_CONN_SHARD(session), fld)
 #define	WT_STAT_FAST_CONN_DECRV(session, fld, value)			\
-	WT_STAT_FAST_DECRV(session, &S2C(session)->stats, fld, value)
+	WT_STAT_FAST_DECRV(session, WT_STAT_CONN_SHARD(session), fld, value)
 #define	WT_STAT_FAST_CONN_INCR(session, fld)				\
-	WT_STAT_FAST_INCR(session, &S2C(session)->stats, fld)
+	WT_STAT_FAST_INCR(session, WT_STAT_CONN_SHARD(session), fld)
 #define	WT_STAT_FAST_CONN_INCRV(session, fld, value)			\
-	WT_STAT_FAST_INCRV(session, &S2C(session)->stats, fld, value)
+	WT_STAT_FAST_INCRV(session, WT_STAT_CONN_SHARD(session), fld, value)
 #define	WT_STAT_FAST_CONN_SET(session, fld, value)			\
-	WT_STAT_FAST_SET(session, &S2C(session)->stats, fld, value)
+	WT_STAT_FAST_SET(session, WT_STAT_CONN_SHARD_SET(session), fld, value)
 
 
 #define	WT_STAT_FAST_DATA_DECRV(session, fld, value) do {		\
@@ -110,7 +123,54 @@ struct __wt_stats
 	session, &(session)->dhandle->stats, fld, value);	\
 } while (0)
 
-#define	WT_CONN_STAT(session, fld)	WT_STAT(&S2C(session)->stats, fld)
+/*ȡһõconnectionͳֵõֵǱshard 0*/
+#define	WT_CONN_STAT(session, fld)	WT_STAT(WT_STAT_CONN_SHARD_SET(session), fld)
+
+/*
+ * Latency histograms: log-linear buckets in microseconds, each power of two
+ * is split into WT_LATENCY_SUB linear sub-buckets.  Histograms are kept in
+ * the session and only written by the session's own thread, so recording
+ * needs no atomics; statistics cursors sum them across the session array.
+ */
+#define	WT_LATENCY_SUB_BITS		2
+#define	WT_LATENCY_SUB			(1 << WT_LATENCY_SUB_BITS)
+#define	WT_LATENCY_GROUPS		31						/* Up to 2^31 usecs */
+#define	WT_LATENCY_BUCKETS		((WT_LATENCY_GROUPS - WT_LATENCY_SUB_BITS + 1) * WT_LATENCY_SUB)
+
+/*ҪͳӳٵĲ*/
+#define	WT_LATENCY_BLOCK_WRITE		0	/* __wt_block_write_off */
+#define	WT_LATENCY_CACHE_READ		1	/* __wt_cache_read */
+#define	WT_LATENCY_CACHE_WAIT		2	/* __wt_cache_wait stalls */
+#define	WT_LATENCY_CURSOR_INSERT	3
+#define	WT_LATENCY_CURSOR_REMOVE	4
+#define	WT_LATENCY_CURSOR_SEARCH	5
+#define	WT_LATENCY_CURSOR_UPDATE	6
+#define	WT_LATENCY_EVICT_PAGE		7	/* __wt_evict of a single page */
+#define	WT_LATENCY_LOG_SLOT_WAIT	8
+#define	WT_LATENCY_LOG_SYNC			9	/* Log file fsync */
+#define	WT_LATENCY_OPS				10
+
+struct __wt_latency_hist
+{
+	uint64_t count;							/* Operations recorded */
+	uint64_t total;							/* Total usecs */
+	uint64_t max;							/* Slowest operation, usecs */
+	uint64_t bucket[WT_LATENCY_BUCKETS];
+};
+
+/*ʼʱֻдfastͳʱŶȡʱ*/
+#define	WT_LATENCY_BEGIN(session, start) do {						\
+	if (FLD_ISSET(S2C(session)->stat_flags, WT_CONN_STAT_FAST))	\
+		(void)__wt_epoch(session, &(start));						\
+	else															\
+		(start).tv_sec = 0;											\
+} while (0)
+
+/*ʱ¼sessionֱͼ*/
+#define	WT_LATENCY_END(session, op, start) do {						\
+	if ((start).tv_sec != 0)										\
+		__wt_latency_record(session, op, &(start));					\
+} while (0)
 
 #define WT_CONNECTION_STATS_BASE 1000
 
@@ -155,8 +215,11 @@ struct __wt_connection_stats
 	WT_STATS cache_eviction_force_delete;
 	WT_STATS cache_eviction_force_fail;
 	WT_STATS cache_eviction_hazard;
+	WT_STATS cache_eviction_hazard_epoch;
+	WT_STATS cache_eviction_hs;
 	WT_STATS cache_eviction_internal;
 	WT_STATS cache_eviction_maximum_page_size;
+	WT_STATS cache_eviction_promote;
 	WT_STATS cache_eviction_queue_empty;
 	WT_STATS cache_eviction_queue_not_empty;
 	WT_STATS cache_eviction_server_evicting;
@@ -165,18 +228,29 @@ struct __wt_connection_stats
 	WT_STATS cache_eviction_split;
 	WT_STATS cache_eviction_walk;
 	WT_STATS cache_eviction_worker_evicting;
+	WT_STATS cache_hs_insert;
+	WT_STATS cache_hs_remove;
+	WT_STATS cache_hs_search;
 	WT_STATS cache_inmem_split;
+	WT_STATS cache_mem_fallback;
+	WT_STATS cache_mem_regions;
+	WT_STATS cache_mem_slab_bytes;
 	WT_STATS cache_overhead;
 	WT_STATS cache_pages_dirty;
 	WT_STATS cache_pages_inuse;
 	WT_STATS cache_read;
+	WT_STATS cache_read_scan;
+	WT_STATS cache_update_gc;
+	WT_STATS cache_update_gc_pages;
 	WT_STATS cache_write;
 	WT_STATS cond_wait;
+	WT_STATS cursor_cache;
 	WT_STATS cursor_create;
 	WT_STATS cursor_insert;
 	WT_STATS cursor_next;
 	WT_STATS cursor_prev;
 	WT_STATS cursor_remove;
+	WT_STATS cursor_reopen;
 	WT_STATS cursor_reset;
 	WT_STATS cursor_search;
 	WT_STATS cursor_search_near;
@@ -188,6 +262,46 @@ struct __wt_connection_stats
 	WT_STATS dh_session_handles;
 	WT_STATS dh_session_sweeps;
 	WT_STATS file_open;
+	WT_STATS latency_block_write_max;
+	WT_STATS latency_block_write_p50;
+	WT_STATS latency_block_write_p99;
+	WT_STATS latency_block_write_p999;
+	WT_STATS latency_cache_read_max;
+	WT_STATS latency_cache_read_p50;
+	WT_STATS latency_cache_read_p99;
+	WT_STATS latency_cache_read_p999;
+	WT_STATS latency_cache_wait_max;
+	WT_STATS latency_cache_wait_p50;
+	WT_STATS latency_cache_wait_p99;
+	WT_STATS latency_cache_wait_p999;
+	WT_STATS latency_cursor_insert_max;
+	WT_STATS latency_cursor_insert_p50;
+	WT_STATS latency_cursor_insert_p99;
+	WT_STATS latency_cursor_insert_p999;
+	WT_STATS latency_cursor_remove_max;
+	WT_STATS latency_cursor_remove_p50;
+	WT_STATS latency_cursor_remove_p99;
+	WT_STATS latency_cursor_remove_p999;
+	WT_STATS latency_cursor_search_max;
+	WT_STATS latency_cursor_search_p50;
+	WT_STATS latency_cursor_search_p99;
+	WT_STATS latency_cursor_search_p999;
+	WT_STATS latency_cursor_update_max;
+	WT_STATS latency_cursor_update_p50;
+	WT_STATS latency_cursor_update_p99;
+	WT_STATS latency_cursor_update_p999;
+	WT_STATS latency_evict_page_max;
+	WT_STATS latency_evict_page_p50;
+	WT_STATS latency_evict_page_p99;
+	WT_STATS latency_evict_page_p999;
+	WT_STATS latency_log_slot_wait_max;
+	WT_STATS latency_log_slot_wait_p50;
+	WT_STATS latency_log_slot_wait_p99;
+	WT_STATS latency_log_slot_wait_p999;
+	WT_STATS latency_log_sync_max;
+	WT_STATS latency_log_sync_p50;
+	WT_STATS latency_log_sync_p99;
+	WT_STATS latency_log_sync_p999;
 	WT_STATS log_buffer_grow;
 	WT_STATS log_buffer_size;
 	WT_STATS log_bytes_payload;
@@ -220,8 +334,11 @@ struct __wt_connection_stats
 	WT_STATS log_write_lsn;
 	WT_STATS log_writes;
 	WT_STATS lsm_checkpoint_throttle;
+	WT_STATS lsm_flush_bandwidth;
+	WT_STATS lsm_merge_bandwidth;
 	WT_STATS lsm_merge_throttle;
 	WT_STATS lsm_rows_merged;
+	WT_STATS lsm_throttle_trees;
 	WT_STATS lsm_work_queue_app;
 	WT_STATS lsm_work_queue_manager;
 	WT_STATS lsm_work_queue_max;
@@ -262,6 +379,13 @@ struct __wt_connection_stats
 	WT_STATS write_io;
 };
 
+/*connectionͳƵһƬƬ֮ټһcache lineֹfalse sharing*/
+struct __wt_connection_stats_shard
+{
+	WT_CONNECTION_STATS stats;
+	uint8_t pad[WT_CACHE_LINE_ALIGNMENT];
+};
+
 /*֯״̬ͳ*/
 #define	WT_DSRC_STATS_BASE	2000
 struct __wt_dsrc_stats 
@@ -283,12 +407,15 @@ struct __wt_dsrc_stats
 	WT_STATS bloom_page_evict;
 	WT_STATS bloom_page_read;
 	WT_STATS bloom_size;
+	WT_STATS btree_ahi_hit;
+	WT_STATS btree_ahi_miss;
 	WT_STATS btree_checkpoint_generation;
 	WT_STATS btree_column_deleted;
 	WT_STATS btree_column_fix;
 	WT_STATS btree_column_internal;
 	WT_STATS btree_column_variable;
 	WT_STATS btree_compact_rewrite;
+	WT_STATS btree_count_subtree_skip;
 	WT_STATS btree_entries;
 	WT_STATS btree_fixed_len;
 	WT_STATS btree_maximum_depth;
@@ -300,6 +427,19 @@ struct __wt_dsrc_stats
 	WT_STATS btree_overflow;
 	WT_STATS btree_row_internal;
 	WT_STATS btree_row_leaf;
+	WT_STATS btree_sample_entries;
+	WT_STATS btree_sample_key_gt1k;
+	WT_STATS btree_sample_key_le16;
+	WT_STATS btree_sample_key_le1k;
+	WT_STATS btree_sample_key_le256;
+	WT_STATS btree_sample_key_le64;
+	WT_STATS btree_sample_prefix_distinct;
+	WT_STATS btree_sample_records;
+	WT_STATS btree_sample_value_gt1k;
+	WT_STATS btree_sample_value_le16;
+	WT_STATS btree_sample_value_le1k;
+	WT_STATS btree_sample_value_le256;
+	WT_STATS btree_sample_value_le64;
 	WT_STATS cache_bytes_read;
 	WT_STATS cache_bytes_write;
 	WT_STATS cache_eviction_checkpoint;
@@ -322,6 +462,8 @@ struct __wt_dsrc_stats
 	WT_STATS compress_write;
 	WT_STATS compress_write_fail;
 	WT_STATS compress_write_too_small;
+	WT_STATS cursor_batch_leaf_reuse;
+	WT_STATS cursor_batch_prefetch;
 	WT_STATS cursor_create;
 	WT_STATS cursor_insert;
 	WT_STATS cursor_insert_bulk;
@@ -339,7 +481,13 @@ struct __wt_dsrc_stats
 	WT_STATS lsm_chunk_count;
 	WT_STATS lsm_generation_max;
 	WT_STATS lsm_lookup_no_bloom;
+	WT_STATS lsm_lookup_range_deleted;
 	WT_STATS lsm_merge_throttle;
+	WT_STATS lsm_range_tombstones;
+	WT_STATS lsm_space_amplification;
+	WT_STATS lsm_throttle_debt;
+	WT_STATS lsm_throttle_rate;
+	WT_STATS lsm_write_amplification;
 	WT_STATS rec_dictionary;
 	WT_STATS rec_multiblock_internal;
 	WT_STATS rec_multiblock_leaf;
@@ -48,6 +48,12 @@ static inline int __wt_txn_modify(WT_SESSION_IMPL* session, WT_UPDATE* upd)
 	WT_DECL_RET;
 	WT_TXN_OP *op;
 
+	/*history storeд벻κдɼ*/
+	if (F_ISSET(session, WT_SESSION_NO_TXN)) {
+		upd->txnid = WT_TXN_NONE;
+		return 0;
+	}
+
 	WT_RET(__txn_next_op(session, &op));
 	op->type = F_ISSET(session, WT_SESSION_LOGGING_INMEM) ? TXN_OP_INMEM : TXN_OP_BASIC;
 	op->u.upd = upd;
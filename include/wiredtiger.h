@@ -63,6 +63,7 @@ struct __wt_session;	    typedef struct __wt_session WT_SESSION;
 ***************************************************/
 #define	WT_ITEM_ALIGNED					0x00000001
 #define	WT_ITEM_INUSE					0x00000002
+#define	WT_ITEM_CACHE					0x00000004	/*ڲʹ, page image, cacheڴз*/
 
 struct __wt_item
 {
@@ -150,6 +151,24 @@ struct __wt_cursor
 	const char*				internal_uri;
 
 	uint32_t					flags;
+
+	/*ķ׷гԱ֮󣬲ıгԱƫ*/
+	/*ѯkeysrawʽkeyҵvaluevaluesresults[i]Ϊ0WT_NOTFOUND*/
+	int						__F(search_batch)(WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, uint32_t count);
+	/*rawʽkey/valueһ*/
+	int						__F(insert_batch)(WT_CURSOR *cursor, const WT_ITEM *keys, const WT_ITEM *values, uint32_t count);
+
+	/*
+	 * Library-private state, applications must not use it.  It follows all
+	 * of the public members so their offsets don't change.
+	 */
+	/*search_batchصvalueһcursorرǰЧ*/
+	WT_ITEM					batch_values;
+	/*session cursor cacheʹãuri_hashurihashֵcache_keyuriʹcursorʱ*/
+	uint64_t				uri_hash;
+	const char*				cache_key;
+	int						(*cache)(WT_CURSOR *cursor);
+	int						(*reopen)(WT_CURSOR *cursor);
 };
 
 /*cursor flagʶֵ*/
@@ -167,6 +186,9 @@ struct __wt_cursor
 #define	WT_CURSTD_VALUE_EXT		0x0400	/* Value points out of the tree. */
 #define	WT_CURSTD_VALUE_INT		0x0800	/* Value points into the tree. */
 #define	WT_CURSTD_VALUE_SET		(WT_CURSTD_VALUE_EXT | WT_CURSTD_VALUE_INT)
+/*flag׷еֵ֮*/
+#define	WT_CURSTD_CACHEABLE		0x1000	/* Park in the session cache on close. */
+#define	WT_CURSTD_CACHED		0x2000	/* Parked in the session cache. */
 
 /*첽Ͷ*/
 typedef enum{
@@ -231,6 +253,14 @@ struct __wt_session
 	int							__F(rollback_transaction)(WT_SESSION *session, const char *config);
 	int							__F(checkpoint)(WT_SESSION *session, const char *config);
 	int							__F(transaction_pinned_range)(WT_SESSION* session, uint64_t *range);
+	/*JSONʽ/һм¼*/
+	int							__F(dump)(WT_SESSION *session, const char *uri, const char *filename, const char *config);
+	int							__F(load)(WT_SESSION *session, const char *uri, const char *filename, const char *config);
+	/*ͳstartstopcursorkey֮ļ¼cursorһΪNULL*/
+	int							__F(count_range)(WT_SESSION *session, WT_HANDLE_NULLABLE(WT_CURSOR) *start,
+												WT_HANDLE_NULLABLE(WT_CURSOR) *stop, const char *config, uint64_t *countp);
+	/*cursorλrank(0ʼ)һзWT_NOTFOUND*/
+	int							__F(position_rank)(WT_SESSION *session, WT_CURSOR *cursor, uint64_t rank, const char *config);
 };
 
 /*wt connection,connectionǶӦһdatabaseʵ*/
@@ -251,6 +281,8 @@ struct __wt_connection
 	int							__F(add_compressor)(WT_CONNECTION *connection, const char *name, WT_COMPRESSOR *compressor, const char *config);
 	int							__F(add_extractor)(WT_CONNECTION *connection, const char *name, WT_EXTRACTOR *extractor, const char *config);
 	WT_EXTENSION_API*			__F(get_extension_api)(WT_CONNECTION *wt_conn);
+	/*Ϊmethod("session.open_cursor")ãصַconnectionرǰЧԭʹ*/
+	int							__F(compile_configuration)(WT_CONNECTION *connection, const char *method, const char *config, const char **compiledp);
 };
 
 /*WiredTigerݿAPI*/
@@ -282,6 +314,12 @@ int								wiredtiger_struct_pack(WT_SESSION *session, void *buffer, size_t size
 int								wiredtiger_struct_size(WT_SESSION *session, size_t *sizep, const char *format, ...);
 
 int								wiredtiger_struct_unpack(WT_SESSION *session, const void *buffer, size_t size, const char *format, ...);
+/*
+ * unpackʽͬļ¼ÿfield⵽columnsжӦ飬¼±:
+ * зint64_t޷bit fieldͼ¼uint64_tַconst char *
+ * 'u'WT_ITEMcolumnsΪNULLfield
+ */
+int								wiredtiger_struct_unpack_batch(WT_SESSION *session, const char *format, const WT_ITEM *records, u_int nrecords, void **columns);
 
 int								wiredtiger_pack_start(WT_SESSION *session, const char *format, void *buffer, size_t size, WT_PACK_STREAM **psp);
 
@@ -29,6 +29,10 @@ extern "C" {
 
 struct __wt_addr;
 typedef struct __wt_addr WT_ADDR;
+struct __wt_ahi;
+typedef struct __wt_ahi WT_AHI;
+struct __wt_ahi_entry;
+typedef struct __wt_ahi_entry WT_AHI_ENTRY;
 struct __wt_async;
 typedef struct __wt_async WT_ASYNC;
 struct __wt_async_cursor;
@@ -57,8 +61,14 @@ struct __wt_btree;
 typedef struct __wt_btree WT_BTREE;
 struct __wt_cache;
 typedef struct __wt_cache WT_CACHE;
+struct __wt_cache_mem;
+typedef struct __wt_cache_mem WT_CACHE_MEM;
 struct __wt_cache_pool;
 typedef struct __wt_cache_pool WT_CACHE_POOL;
+struct __wt_cache_region;
+typedef struct __wt_cache_region WT_CACHE_REGION;
+struct __wt_cache_slab;
+typedef struct __wt_cache_slab WT_CACHE_SLAB;
 struct __wt_cell;
 typedef struct __wt_cell WT_CELL;
 struct __wt_cell_unpack;
@@ -79,6 +89,10 @@ struct __wt_config;
 typedef struct __wt_config WT_CONFIG;
 struct __wt_config_check;
 typedef struct __wt_config_check WT_CONFIG_CHECK;
+struct __wt_config_compiled;
+typedef struct __wt_config_compiled WT_CONFIG_COMPILED;
+struct __wt_config_compiled_key;
+typedef struct __wt_config_compiled_key WT_CONFIG_COMPILED_KEY;
 struct __wt_config_entry;
 typedef struct __wt_config_entry WT_CONFIG_ENTRY;
 struct __wt_config_parser_impl;
@@ -87,6 +101,8 @@ struct __wt_connection_impl;
 typedef struct __wt_connection_impl WT_CONNECTION_IMPL;
 struct __wt_connection_stats;
 typedef struct __wt_connection_stats WT_CONNECTION_STATS;
+struct __wt_connection_stats_shard;
+typedef struct __wt_connection_stats_shard WT_CONNECTION_STATS_SHARD;
 struct __wt_connection_stats_spinlock;
 typedef struct __wt_connection_stats_spinlock WT_CONNECTION_STATS_SPINLOCK;
 struct __wt_cursor_backup;
@@ -141,10 +157,14 @@ struct __wt_ikey;
 typedef struct __wt_ikey WT_IKEY;
 struct __wt_index;
 typedef struct __wt_index WT_INDEX;
+struct __wt_index_batch;
+typedef struct __wt_index_batch WT_INDEX_BATCH;
 struct __wt_insert;
 typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
 typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_latency_hist;
+typedef struct __wt_latency_hist WT_LATENCY_HIST;
 struct __wt_log_desc;
 typedef struct __wt_log_desc WT_LOG_DESC;
 struct __wt_log_op_desc;
@@ -181,6 +201,8 @@ struct __wt_ovfl_track;
 typedef struct __wt_ovfl_track WT_OVFL_TRACK;
 struct __wt_ovfl_txnc;
 typedef struct __wt_ovfl_txnc WT_OVFL_TXNC;
+struct __wt_pack_compiled;
+typedef struct __wt_pack_compiled WT_PACK_COMPILED;
 struct __wt_page;
 typedef struct __wt_page WT_PAGE;
 struct __wt_page_deleted;
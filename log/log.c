@@ -746,6 +746,7 @@ static int __log_release(WT_SESSION_IMPL* session, WT_LOGSLOT* slot, int* freep)
 	WT_LSN sync_lsn;
 	size_t write_size;
 	int locked, yield_count;
+	struct timespec start;
 	WT_DECL_SPINLOCK_ID(id);	
 
 	conn = S2C(session);
@@ -812,7 +813,9 @@ static int __log_release(WT_SESSION_IMPL* session, WT_LOGSLOT* slot, int* freep)
 		if (F_ISSET(slot, SLOT_SYNC) && LOG_CMP(&log->sync_lsn, &slot->slot_end_lsn) < 0) {
 			WT_ERR(__wt_verbose(session, WT_VERB_LOG, "log_release: sync log %s", log->log_fh->name));
 			WT_STAT_FAST_CONN_INCR(session, log_sync);
+			WT_LATENCY_BEGIN(session, start);
 			WT_ERR(__wt_fsync(session, log->log_fh));
+			WT_LATENCY_END(session, WT_LATENCY_LOG_SYNC, start);
 			/*sync_lsn֪ͨ߳log->sync_lsn˸ı䣬½бȶж*/
 			log->sync_lsn = sync_lsn;
 			WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
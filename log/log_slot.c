@@ -220,16 +220,21 @@ int __wt_log_slot_notify(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 /*ȴslot leaderķдλ*/
 int __wt_log_slot_wait(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 {
+	struct timespec start;
 	int yield_count = 0;
 
-	WT_UNUSED(session);
+	/*slotѾʱʱֻͳȴ*/
+	if (slot->slot_state <= WT_LOG_SLOT_DONE)
+		return 0;
 
+	WT_LATENCY_BEGIN(session, start);
 	while (slot->slot_state > WT_LOG_SLOT_DONE){
 		if (++yield_count < 1000)
 			__wt_yield();
 		else
 			__wt_sleep(0, 200);
 	}
+	WT_LATENCY_END(session, WT_LATENCY_LOG_SLOT_WAIT, start);
 
 	return 0;
 }
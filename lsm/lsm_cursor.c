@@ -252,6 +252,108 @@ static inline void __clsm_deleted_decode(WT_CURSOR_LSM *clsm, WT_ITEM *value)
 		--value->size;
 }
 
+/*
+ * __clsm_range_covered --
+ *	Check if a key is covered by a range tombstone of the chunks in slots
+ * [start, end).  The ranges in one chunk never overlap, the only candidate
+ * is the last range starting at or before the key.
+ */
+static int __clsm_range_covered(WT_CURSOR_LSM* clsm, u_int start, u_int end, const WT_ITEM* key, int* coveredp)
+{
+	WT_CURSOR *rc;
+	WT_DECL_RET;
+	WT_ITEM stop;
+	WT_SESSION_IMPL *session;
+	u_int i;
+	int cmp;
+
+	*coveredp = 0;
+	if (clsm->range_dels == NULL)
+		return 0;
+
+	session = (WT_SESSION_IMPL *)clsm->iface.session;
+	for (i = start; i < end && !*coveredp; ++i) {
+		if ((rc = clsm->range_dels[i]) == NULL)
+			continue;
+
+		rc->set_key(rc, key);
+		if ((ret = rc->search_near(rc, &cmp)) == 0 && cmp > 0)
+			ret = rc->prev(rc);
+		if (ret == 0 && (ret = rc->get_value(rc, &stop)) == 0 &&
+			(ret = __wt_compare(session, clsm->lsm_tree->collator, key, &stop, &cmp)) == 0)
+			*coveredp = (cmp <= 0);
+
+		WT_TRET(rc->reset(rc));
+		WT_RET_NOTFOUND_OK(ret);
+	}
+
+	return 0;
+}
+
+/*
+ * __wt_lsm_range_del_insert --
+ *	Insert the range [start, stop] into a range tombstone file, merging it
+ * with the ranges it overlaps so the ranges in the file stay disjoint.
+ */
+int __wt_lsm_range_del_insert(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, WT_CURSOR* rc, const WT_ITEM* start, const WT_ITEM* stop)
+{
+	WT_DECL_ITEM(lower);
+	WT_DECL_ITEM(upper);
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	int cmp;
+
+	WT_ERR(__wt_scr_alloc(session, start->size, &lower));
+	WT_ERR(__wt_buf_set(session, lower, start->data, start->size));
+	WT_ERR(__wt_scr_alloc(session, stop->size, &upper));
+	WT_ERR(__wt_buf_set(session, upper, stop->data, stop->size));
+
+	/*ǰһΧ[start, stop]صʼkeyʼϲ*/
+	rc->set_key(rc, lower);
+	if ((ret = rc->search_near(rc, &cmp)) == 0 && cmp > 0)
+		ret = rc->prev(rc);
+	if (ret == 0) {
+		WT_ERR(rc->get_key(rc, &key));
+		WT_ERR(rc->get_value(rc, &value));
+		WT_ERR(__wt_compare(session, lsm_tree->collator, &value, lower, &cmp));
+		if (cmp >= 0) {
+			WT_ERR(__wt_compare(session, lsm_tree->collator, &value, upper, &cmp));
+			if (cmp > 0)
+				WT_ERR(__wt_buf_set(session, upper, value.data, value.size));
+			WT_ERR(__wt_buf_set(session, lower, key.data, key.size));
+		}
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+	/*ɾʼkey[lower, upper]еķΧϲµķΧ*/
+	rc->set_key(rc, lower);
+	if ((ret = rc->search_near(rc, &cmp)) == 0 && cmp < 0)
+		ret = rc->next(rc);
+	for (; ret == 0; ret = rc->next(rc)) {
+		WT_ERR(rc->get_key(rc, &key));
+		WT_ERR(__wt_compare(session, lsm_tree->collator, &key, upper, &cmp));
+		if (cmp > 0)
+			break;
+
+		WT_ERR(rc->get_value(rc, &value));
+		WT_ERR(__wt_compare(session, lsm_tree->collator, &value, upper, &cmp));
+		if (cmp > 0)
+			WT_ERR(__wt_buf_set(session, upper, value.data, value.size));
+		WT_ERR(rc->remove(rc));
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+	rc->set_key(rc, lower);
+	rc->set_value(rc, upper);
+	WT_ERR(rc->insert(rc));
+
+err:
+	WT_TRET(rc->reset(rc));
+	__wt_scr_free(session, &lower);
+	__wt_scr_free(session, &upper);
+	return ret;
+}
+
 /*رlsm treeϲҪcursorĶ*/
 static int __clsm_close_cursors(WT_CURSOR_LSM* clsm, u_int start, u_int end)
 {
@@ -271,6 +373,10 @@ static int __clsm_close_cursors(WT_CURSOR_LSM* clsm, u_int start, u_int end)
 			clsm->blooms[i] = NULL;
 			WT_RET(__wt_bloom_close(bloom));
 		}
+		if (clsm->range_dels != NULL && (c = clsm->range_dels[i]) != NULL) {
+			clsm->range_dels[i] = NULL;
+			WT_RET(c->close(c));
+		}
 	}
 
 	return 0;
@@ -387,6 +493,10 @@ retry:
 			/* Make sure the Bloom config matches. */
 			if (clsm->blooms[ngood] == NULL && F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 				break;
+
+			/*chunk½˷Χɾļ*/
+			if (clsm->range_dels[ngood] == NULL && F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+				break;
 		}
 
 		/* Spurious generation bump? */
@@ -437,6 +547,7 @@ retry:
 
 	WT_ERR(__wt_realloc_def(session, &clsm->bloom_alloc, nchunks, &clsm->blooms));
 	WT_ERR(__wt_realloc_def(session, &clsm->cursor_alloc, nchunks, &clsm->cursors));
+	WT_ERR(__wt_realloc_def(session, &clsm->range_del_alloc, nchunks, &clsm->range_dels));
 
 	clsm->nchunks = nchunks;
 
@@ -478,6 +589,16 @@ retry:
 		if (!F_ISSET(clsm, WT_CLSM_MERGE) && F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_bloom_open(session, chunk->bloom_uri, lsm_tree->bloom_bit_count, c, &clsm->blooms[i]));
 
+		/*Χɾļchunkһ̣̺checkpointжȡ*/
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL)) {
+			WT_ASSERT(session, clsm->range_dels[i] == NULL);
+			ret = __wt_open_cursor(session, chunk->range_del_uri, c, F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) ? ckpt_cfg : NULL, &clsm->range_dels[i]);
+			if (ret == WT_NOTFOUND && F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+				ret = __wt_open_cursor(session, chunk->range_del_uri, c, NULL, &clsm->range_dels[i]);
+			WT_ERR(ret);
+			F_SET(clsm->range_dels[i], WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
+		}
+
 		/* Child cursors always use overwrite and raw mode. */
 		F_SET(*cp, WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
 	}
@@ -526,53 +647,167 @@ int __wt_clsm_init_merge(WT_CURSOR *cursor, u_int start_chunk, uint32_t start_id
 	return ret;
 }
 
-/*lsm treeд򿪵cursorСcursor
- *lsm treeеǰcursorеֵλcursor
- */
-static int __clsm_get_current(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int smallest, int *deletedp)
+/*slot aǷslot bǰ棺keyСǰkeyǰkeyͬʱµchunkǰ*/
+static inline int __clsm_heap_before(WT_SESSION_IMPL* session, WT_CURSOR_LSM* clsm, u_int a, u_int b, int forward, int* beforep)
 {
-	WT_CURSOR *c, *current;
-	int cmp, multiple;
-	u_int i;
+	int cmp;
 
-	current = NULL;
-	multiple = 0;
+	WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree, clsm->cursors[a], clsm->cursors[b], cmp));
+	*beforep = (cmp == 0) ? a > b : (forward ? cmp < 0 : cmp > 0);
+	return 0;
+}
 
-	WT_FORALL_CURSORS(clsm, c, i){
-		if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-			continue;
-		/*µcursor*/
-		if (current == NULL) {
-			current = c;
-			continue;
+/*posλõԪµ*/
+static int __clsm_heap_sift_down(WT_SESSION_IMPL* session, WT_CURSOR_LSM* clsm, u_int pos, int forward)
+{
+	u_int child, *heap, slot;
+	int before;
+
+	heap = clsm->heap;
+	slot = heap[pos];
+	while ((child = 2 * pos + 1) < clsm->heap_entries) {
+		if (child + 1 < clsm->heap_entries) {
+			WT_RET(__clsm_heap_before(session, clsm, heap[child + 1], heap[child], forward, &before));
+			if (before)
+				++child;
 		}
+		WT_RET(__clsm_heap_before(session, clsm, heap[child], slot, forward, &before));
+		if (!before)
+			break;
+		heap[pos] = heap[child];
+		pos = child;
+	}
+	heap[pos] = slot;
 
-		/*Сcursor*/
-		WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree, c, current, cmp));
-		if (smallest ? cmp < 0 : cmp > 0) {
-			current = c;
-			multiple = 0;
-		} 
-		else if (cmp == 0)
-			multiple = 1;
+	return 0;
+}
+
+/*һchunk cursor뵽*/
+static int __clsm_heap_push(WT_SESSION_IMPL* session, WT_CURSOR_LSM* clsm, u_int slot, int forward)
+{
+	u_int *heap, parent, pos;
+	int before;
+
+	heap = clsm->heap;
+	for (pos = clsm->heap_entries++; pos > 0; pos = parent) {
+		parent = (pos - 1) / 2;
+		WT_RET(__clsm_heap_before(session, clsm, slot, heap[parent], forward, &before));
+		if (!before)
+			break;
+		heap[pos] = heap[parent];
+	}
+	heap[pos] = slot;
+
+	return 0;
+}
+
+/*ƳѶ*/
+static int __clsm_heap_pop(WT_SESSION_IMPL* session, WT_CURSOR_LSM* clsm, int forward)
+{
+	if (--clsm->heap_entries == 0)
+		return 0;
+
+	clsm->heap[0] = clsm->heap[clsm->heap_entries];
+	return __clsm_heap_sift_down(session, clsm, 0, forward);
+}
+
+/*Ѿλchunk cursorѣʼһαʱ*/
+static int __clsm_heap_build(WT_SESSION_IMPL* session, WT_CURSOR_LSM* clsm, int forward)
+{
+	WT_CURSOR *c;
+	u_int i, n;
+
+	clsm->heap_entries = 0;
+	if (clsm->nchunks == 0)
+		return 0;
+
+	WT_RET(__wt_realloc_def(session, &clsm->heap_alloc, clsm->nchunks, &clsm->heap));
+
+	n = 0;
+	WT_FORALL_CURSORS(clsm, c, i) {
+		if (F_ISSET(c, WT_CURSTD_KEY_INT))
+			clsm->heap[n++] = i;
+	}
+	clsm->heap_entries = n;
+
+	for (i = n / 2; i > 0;)
+		WT_RET(__clsm_heap_sift_down(session, clsm, --i, forward));
+
+	return 0;
+}
+
+/*
+ * __clsm_heap_step --
+ *	Move the cursors positioned on the current key one step in the
+ * iteration direction.  The top of the heap is taken out first: it does not
+ * move until the end, so its key is stable while the other chunk cursors
+ * holding the same key are found at the top of the heap and stepped.  Each
+ * cursor moved costs O(log N) comparisons instead of a scan of all chunks.
+ */
+static int __clsm_heap_step(WT_SESSION_IMPL* session, WT_CURSOR_LSM* clsm, int forward)
+{
+	WT_CURSOR *c, *top;
+	WT_DECL_RET;
+	u_int slot;
+	int cmp;
+
+	if (clsm->heap_entries == 0)
+		return 0;
+
+	slot = clsm->heap[0];
+	top = clsm->cursors[slot];
+	WT_ERR(__clsm_heap_pop(session, clsm, forward));
+
+	while (clsm->heap_entries > 0) {
+		c = clsm->cursors[clsm->heap[0]];
+		WT_ERR(WT_LSM_CURCMP(session, clsm->lsm_tree, c, top, cmp));
+		if (cmp != 0)
+			break;
+
+		if ((ret = (forward ? c->next(c) : c->prev(c))) == WT_NOTFOUND)
+			WT_ERR(__clsm_heap_pop(session, clsm, forward));
+		else {
+			WT_ERR(ret);
+			WT_ERR(__clsm_heap_sift_down(session, clsm, 0, forward));
+		}
 	}
 
+	if ((ret = (forward ? top->next(top) : top->prev(top))) == WT_NOTFOUND)
+		ret = 0;
+	else if (ret == 0)
+		ret = __clsm_heap_push(session, clsm, slot, forward);
+
+err:
+	/*Ѿ´αʱkey¶λ*/
+	if (ret != 0)
+		F_CLR(clsm, WT_CLSM_ITERATE_NEXT | WT_CLSM_ITERATE_PREV);
+	return ret;
+}
+
+/*Ѷchunk cursorΪlsm treeĵǰcursorKVֵlsm cursor*/
+static int __clsm_get_current(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int *deletedp)
+{
+	WT_CURSOR *c, *current;
+	u_int slot;
+
 	c = &clsm->iface;
-	if ((clsm->current = current) == NULL) {
+	if (clsm->heap_entries == 0) {
+		clsm->current = NULL;
 		F_CLR(c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 		return (WT_NOTFOUND);
 	}
 
-	if (multiple)
-		F_SET(clsm, WT_CLSM_MULTIPLE);
-	else
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
+	slot = clsm->heap[0];
+	current = clsm->current = clsm->cursors[slot];
 
 	WT_RET(current->get_key(current, &c->key));
 	WT_RET(current->get_value(current, &c->value));
 
 	F_CLR(c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	/*keyڸµchunkбΧɾͱɾһ*/
 	if ((*deletedp = __clsm_deleted(clsm, &c->value)) == 0)
+		WT_RET(__clsm_range_covered(clsm, slot + 1, clsm->nchunks, &c->key, deletedp));
+	if (*deletedp == 0)
 		F_SET(c, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
 
 	return 0;
@@ -608,7 +843,7 @@ static int __clsm_next(WT_CURSOR* cursor)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int check, cmp, deleted;
+	int cmp, deleted;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 
@@ -617,8 +852,6 @@ static int __clsm_next(WT_CURSOR* cursor)
 	WT_ERR(__clsm_enter(clsm, 0, 0));
 
 	if(clsm->current == NULL || !F_ISSET(clsm, WT_CLSM_ITERATE_NEXT)){
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
-
 		WT_FORALL_CURSORS(clsm, c, i) {
 			if (!F_ISSET(cursor, WT_CURSTD_KEY_SET)) {
 				WT_ERR(c->reset(c));
@@ -629,12 +862,8 @@ static int __clsm_next(WT_CURSOR* cursor)
 				if ((ret = c->search_near(c, &cmp)) == 0) {
 					if (cmp < 0)
 						ret = c->next(c);
-					else if (cmp == 0) {
-						if (clsm->current == NULL)
-							clsm->current = c;
-						else
-							F_SET(clsm, WT_CLSM_MULTIPLE);
-					}
+					else if (cmp == 0 && clsm->current == NULL)
+						clsm->current = c;
 				} 
 				else
 					F_CLR(c, WT_CURSTD_KEY_SET);
@@ -643,38 +872,18 @@ static int __clsm_next(WT_CURSOR* cursor)
 		}
 		F_SET(clsm, WT_CLSM_ITERATE_NEXT);
 		F_CLR(clsm, WT_CLSM_ITERATE_PREV);
+		WT_ERR(__clsm_heap_build(session, clsm, 1));
 		if(clsm->current != NULL)
 			goto retry;
 	}
 	else{
 retry:
-		/*
-		 * If there are multiple cursors on that key, move them
-		 * forward.
-		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = 0;
-			WT_FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-					continue;
-
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session, clsm->lsm_tree, c, clsm->current, cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->next(c));
-				}
-				if (c == clsm->current)
-					check = 1;
-			}
-		}
-
-		/* Move the smallest cursor forward. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->next(c));
+		/* Move the cursors on the current key forward. */
+		WT_ERR(__clsm_heap_step(session, clsm, 1));
 	}
 
-	/* Find the cursor(s) with the smallest key. KVԱΪɾôҪ*/
-	if ((ret = __clsm_get_current(session, clsm, 1, &deleted)) == 0 && deleted)
+	/* Find the cursor with the smallest key. KVԱΪɾôҪ*/
+	if ((ret = __clsm_get_current(session, clsm, &deleted)) == 0 && deleted)
 		goto retry;
 
 err:	
@@ -694,7 +903,7 @@ static int __clsm_prev(WT_CURSOR *cursor)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int check, cmp, deleted;
+	int cmp, deleted;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 
@@ -704,7 +913,6 @@ static int __clsm_prev(WT_CURSOR *cursor)
 
 	/* If we aren't positioned for a reverse scan, get started. */
 	if (clsm->current == NULL || !F_ISSET(clsm, WT_CLSM_ITERATE_PREV)) {
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
 		WT_FORALL_CURSORS(clsm, c, i) {
 			if (!F_ISSET(cursor, WT_CURSTD_KEY_SET)) {
 				WT_ERR(c->reset(c));
@@ -715,50 +923,28 @@ static int __clsm_prev(WT_CURSOR *cursor)
 				if ((ret = c->search_near(c, &cmp)) == 0) {
 					if (cmp > 0)
 						ret = c->prev(c);
-					else if (cmp == 0) {
-						if (clsm->current == NULL)
-							clsm->current = c;
-						else
-							F_SET(clsm, WT_CLSM_MULTIPLE);
-					}
+					else if (cmp == 0 && clsm->current == NULL)
+						clsm->current = c;
 				}
 			}
 			WT_ERR_NOTFOUND_OK(ret);
 		}
 		F_SET(clsm, WT_CLSM_ITERATE_PREV);
 		F_CLR(clsm, WT_CLSM_ITERATE_NEXT);
+		WT_ERR(__clsm_heap_build(session, clsm, 0));
 
 		/* We just positioned *at* the key, now move. */
 		if (clsm->current != NULL)
 			goto retry;
 	} 
 	else {
-retry:	/*
-		 * If there are multiple cursors on that key, move them
-		 * backwards.
-		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = 0;
-			WT_FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session, clsm->lsm_tree, c, clsm->current, cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->prev(c));
-				}
-				if (c == clsm->current)
-					check = 1;
-			}
-		}
-
-		/* Move the smallest cursor backwards. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->prev(c));
+retry:
+		/* Move the cursors on the current key backwards. */
+		WT_ERR(__clsm_heap_step(session, clsm, 0));
 	}
 
-	/* Find the cursor(s) with the largest key. */
-	if ((ret = __clsm_get_current(session, clsm, 0, &deleted)) == 0 && deleted)
+	/* Find the cursor with the largest key. */
+	if ((ret = __clsm_get_current(session, clsm, &deleted)) == 0 && deleted)
 		goto retry;
 
 err:	
@@ -826,7 +1012,7 @@ static int __clsm_lookup(WT_CURSOR_LSM *clsm, WT_ITEM *value)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int have_hash;
+	int covered, have_hash;
 
 	c = NULL;
 	cursor = &clsm->iface;
@@ -834,6 +1020,15 @@ static int __clsm_lookup(WT_CURSOR_LSM *clsm, WT_ITEM *value)
 	session = (WT_SESSION_IMPL *)cursor->session;
 
 	WT_FORALL_CURSORS(clsm, c, i){
+		/*µɲңڲchunk֮ǰһ(µ)chunkеķΧɾ*/
+		if (i + 1 < clsm->nchunks) {
+			WT_ERR(__clsm_range_covered(clsm, i + 1, i + 2, &cursor->key, &covered));
+			if (covered) {
+				WT_STAT_FAST_INCR(session, &clsm->lsm_tree->stats, lsm_lookup_range_deleted);
+				WT_ERR(WT_NOTFOUND);
+			}
+		}
+
 		/*ȶbloom filterԼ*/
 		bloom = NULL;
 		if ((bloom = clsm->blooms[i]) != NULL) {
@@ -916,10 +1111,11 @@ static int __clsm_search_near(WT_CURSOR* cursor, int *exactp)
 	WT_CURSOR_LSM *clsm;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
-	u_int i;
+	u_int i, slot;
 	int cmp, deleted, exact;
 
 	closest = NULL;
+	slot = 0;
 	clsm = (WT_CURSOR_LSM *)cursor;
 	deleted = exact = 0;
 
@@ -941,6 +1137,7 @@ static int __clsm_search_near(WT_CURSOR* cursor, int *exactp)
 		/* Do we have an exact match? */
 		if (cmp == 0) {
 			closest = c;
+			slot = i;
 			exact = 1;
 			break;
 		}
@@ -955,12 +1152,16 @@ static int __clsm_search_near(WT_CURSOR* cursor, int *exactp)
 		}
 
 		/*ȷcursor*/
-		if (closest == NULL)
+		if (closest == NULL) {
 			closest = c;
+			slot = i;
+		}
 		else {
 			WT_ERR(WT_LSM_CURCMP(session, clsm->lsm_tree, c, closest, cmp));
-			if (cmp < 0)
+			if (cmp < 0) {
 				closest = c;
+				slot = i;
+			}
 		}
 	}
 
@@ -975,6 +1176,8 @@ static int __clsm_search_near(WT_CURSOR* cursor, int *exactp)
 		clsm->current = closest;
 		closest = NULL;
 		deleted = __clsm_deleted(clsm, &cursor->value);
+		if (!deleted)
+			WT_ERR(__clsm_range_covered(clsm, slot + 1, clsm->nchunks, &cursor->key, &deleted));
 		if (!deleted)
 			__clsm_deleted_decode(clsm, &cursor->value);
 		else if ((ret = cursor->next(cursor)) == 0) {
@@ -1038,19 +1241,10 @@ static inline int __clsm_put(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, cons
 		WT_RET((position && i == 0) ? c->update(c) : c->insert(c));
 	}
 
-	if ((++clsm->primary_chunk->count % 100 == 0 || ++clsm->update_count >= 100) &&
-		lsm_tree->merge_throttle + lsm_tree->ckpt_throttle > 0) {
-			clsm->update_count = 0;
-			WT_STAT_FAST_INCRV(session, &clsm->lsm_tree->stats,
-				lsm_checkpoint_throttle, lsm_tree->ckpt_throttle);
-			WT_STAT_FAST_CONN_INCRV(session,
-				lsm_checkpoint_throttle, lsm_tree->ckpt_throttle);
-			WT_STAT_FAST_INCRV(session, &clsm->lsm_tree->stats,
-				lsm_merge_throttle, lsm_tree->merge_throttle);
-			WT_STAT_FAST_CONN_INCRV(session,
-				lsm_merge_throttle, lsm_tree->merge_throttle);
-			__wt_sleep(0, lsm_tree->ckpt_throttle + lsm_tree->merge_throttle);
-	}
+	++clsm->primary_chunk->count;
+
+	/*flushmergeʱÿ°ԼĴСtoken bucketп۳*/
+	__wt_lsm_tree_throttle_admit(session, lsm_tree, key->size + value->size);
 
 	return 0;
 }
@@ -1148,6 +1342,103 @@ err:
 	return (ret);
 }
 
+/*
+ * __wt_clsm_range_truncate --
+ *	WT_SESSION::truncate with a range for LSM cursors.  Rather than a
+ * tombstone for every key, one range tombstone is written into the primary
+ * chunk, it hides the range in all of the older chunks.  A range tombstone
+ * doesn't cover the chunk it is written to, the keys already in the primary
+ * chunk still get ordinary tombstones.
+ */
+int __wt_clsm_range_truncate(WT_SESSION_IMPL* session, WT_CURSOR* start, WT_CURSOR* stop)
+{
+	WT_CURSOR *c, *last, *rc;
+	WT_CURSOR_LSM *clsm;
+	WT_DECL_ITEM(lower);
+	WT_DECL_ITEM(upper);
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	const char *cfg[2];
+	int cmp;
+
+	/*ûʼλõķΧkeyɾ*/
+	if (start == NULL)
+		return (__wt_range_truncate(start, stop));
+
+	clsm = (WT_CURSOR_LSM *)start;
+	last = NULL;
+
+	WT_CURSOR_NEEDKEY(start);
+	WT_ERR(__wt_scr_alloc(session, start->key.size, &lower));
+	WT_ERR(__wt_buf_set(session, lower, start->key.data, start->key.size));
+
+	/*ûнλãΧһֱһkey*/
+	WT_ERR(__wt_scr_alloc(session, 0, &upper));
+	if (stop != NULL) {
+		WT_CURSOR_NEEDKEY(stop);
+		WT_ERR(__wt_buf_set(session, upper, stop->key.data, stop->key.size));
+	}
+	else {
+		cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+		cfg[1] = NULL;
+		WT_ERR(__wt_open_cursor(session, start->uri, NULL, cfg, &last));
+
+		/*ǿյĻһkeystart֮ǰΧûҪɾkey*/
+		if ((ret = last->prev(last)) == WT_NOTFOUND) {
+			ret = 0;
+			goto err;
+		}
+		WT_ERR(ret);
+		WT_ERR(__wt_compare(session, clsm->lsm_tree->collator, &last->key, lower, &cmp));
+		if (cmp < 0)
+			goto err;
+		WT_ERR(__wt_buf_set(session, upper, last->key.data, last->key.size));
+	}
+
+	/*ΧkeyѾstartλ*/
+	WT_ERR(__clsm_reset_cursors(clsm, NULL));
+	F_CLR(start, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+
+	/*primary chunkϻûзΧɾļʱȴȻ´cursor*/
+	for (;;) {
+		WT_ERR(__clsm_enter(clsm, 0, 1));
+		if ((rc = clsm->range_dels[clsm->nchunks - 1]) != NULL)
+			break;
+		WT_ERR(__wt_lsm_tree_range_del_create(session, clsm->lsm_tree, clsm->primary_chunk));
+	}
+
+	/*primary chunkѾڷΧеkeyдͨtombstone*/
+	c = clsm->cursors[clsm->nchunks - 1];
+	c->set_key(c, lower);
+	if ((ret = c->search_near(c, &cmp)) == 0 && cmp < 0)
+		ret = c->next(c);
+	for (; ret == 0; ret = c->next(c)) {
+		WT_ERR(c->get_key(c, &key));
+		WT_ERR(__wt_compare(session, clsm->lsm_tree->collator, &key, upper, &cmp));
+		if (cmp > 0)
+			break;
+
+		WT_ERR(c->get_value(c, &value));
+		if (!__clsm_deleted(clsm, &value)) {
+			c->set_value(c, &__tombstone);
+			WT_ERR(c->update(c));
+		}
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+	WT_ERR(c->reset(c));
+
+	WT_ERR(__wt_lsm_range_del_insert(session, clsm->lsm_tree, rc, lower, upper));
+	WT_STAT_FAST_INCR(session, &clsm->lsm_tree->stats, lsm_range_tombstones);
+
+err:
+	__clsm_leave(clsm);
+	if (last != NULL)
+		WT_TRET(last->close(last));
+	__wt_scr_free(session, &lower);
+	__wt_scr_free(session, &upper);
+	return ret;
+}
+
 /*رһlsm cursor*/
 static int __clsm_close(WT_CURSOR* cursor)
 {
@@ -1161,6 +1452,8 @@ static int __clsm_close(WT_CURSOR* cursor)
 	WT_TRET(__clsm_close_cursors(clsm, 0, clsm->nchunks));
 	__wt_free(session, clsm->blooms);
 	__wt_free(session, clsm->cursors);
+	__wt_free(session, clsm->heap);
+	__wt_free(session, clsm->range_dels);
 	__wt_free(session, clsm->switch_txn);
 
 	/*cursor*/
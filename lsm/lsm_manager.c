@@ -174,6 +174,35 @@ err:
 	return ret;
 }
 
+/*
+ * __wt_lsm_manager_bandwidth --
+ *	Fold a completed flush or merge into the connection's bandwidth
+ * estimate.  Workers race on the update, a lost sample doesn't matter.
+ */
+void __wt_lsm_manager_bandwidth(WT_SESSION_IMPL* session, int merge, uint64_t bytes, struct timespec* start)
+{
+	WT_LSM_MANAGER *manager;
+	struct timespec stop;
+	uint64_t bw, nsecs, *bwp;
+
+	manager = &S2C(session)->lsm_manager;
+
+	if (bytes == 0 || __wt_epoch(session, &stop) != 0)
+		return;
+	if ((nsecs = WT_TIMEDIFF(stop, *start)) == 0)
+		nsecs = 1;
+
+	bw = (uint64_t)(((double)bytes * WT_BILLION) / nsecs);
+	bwp = merge ? &manager->merge_bw : &manager->flush_bw;
+	/*ָƽռ1/4*/
+	*bwp = *bwp == 0 ? bw : (3 * *bwp + bw) / 4;
+
+	if (merge)
+		WT_STAT_FAST_CONN_SET(session, lsm_merge_bandwidth, manager->merge_bw);
+	else
+		WT_STAT_FAST_CONN_SET(session, lsm_flush_bandwidth, manager->flush_bw);
+}
+
 /*ͷŵһlsm worker unit*/
 void __wt_lsm_manager_free_work_unit(WT_SESSION_IMPL *session, WT_LSM_WORK_UNIT *entry)
 {
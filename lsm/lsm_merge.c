@@ -5,27 +5,100 @@
 
 static int __lsm_merge_span(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int, u_int* , u_int* , uint64_t*);
 
-/*mergechunkĲ*/
-int __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks, WT_LSM_CHUNK *chunk)
+/*mergechunkĲ, mergeʱϲchunkɰkey仮ֵĶchunk滻*/
+int __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks, WT_LSM_CHUNK **chunks, u_int nparts)
 {
 	size_t chunks_after_merge;
+
+	/*ϲchunkȱϲchunkʱչchunk飬֤ĵʧ*/
+	if (nparts > nchunks)
+		WT_RET(__wt_realloc_def(session, &lsm_tree->chunk_alloc, lsm_tree->nchunks + nparts - nchunks, &lsm_tree->chunk));
+
 	/*mergechunkold chunksdrop*/
 	WT_RET(__wt_lsm_tree_retire_chunks(session, lsm_tree, start_chunk, nchunks));
 
 	chunks_after_merge = lsm_tree->nchunks - (nchunks + start_chunk);
 	/*Ѿmergechunkǵ*/
-	memmove(lsm_tree->chunk + start_chunk + 1, lsm_tree->chunk + start_chunk + nchunks, chunks_after_merge * sizeof(*lsm_tree->chunk));
+	memmove(lsm_tree->chunk + start_chunk + nparts, lsm_tree->chunk + start_chunk + nchunks, chunks_after_merge * sizeof(*lsm_tree->chunk));
 
 	/*ϲchunk*/
-	lsm_tree->nchunks -= nchunks - 1;
+	lsm_tree->nchunks = lsm_tree->nchunks + nparts - nchunks;
 	/*chunkְָλNULL*/
-	memset(lsm_tree->chunk + lsm_tree->nchunks, 0, (nchunks - 1) * sizeof(*lsm_tree->chunk));
-	lsm_tree->chunk[start_chunk] = chunk;
+	if (nchunks > nparts)
+		memset(lsm_tree->chunk + lsm_tree->nchunks, 0, (nchunks - nparts) * sizeof(*lsm_tree->chunk));
+	memcpy(lsm_tree->chunk + start_chunk, chunks, nparts * sizeof(*lsm_tree->chunk));
 
 	return 0;
 }
 
-static int __lsm_merge_span(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int id, u_int* start, u_int* end, uint64_t* records)
+/*chunkڲmergeڴbloom filter, ܱѡµmerge*/
+static inline int __lsm_merge_busy(WT_LSM_CHUNK* chunk)
+{
+	return (F_ISSET(chunk, WT_LSM_CHUNK_MERGING) || chunk->bloom_busy);
+}
+
+/*
+ * __lsm_merge_youngest --
+ *	Return the youngest chunk a merge may include: it must already have a
+ * Bloom filter or be the result of a merge, and not be involved in a merge.
+ */
+static u_int __lsm_merge_youngest(WT_LSM_TREE* lsm_tree)
+{
+	WT_LSM_CHUNK *chunk;
+	u_int end_chunk;
+
+	for (end_chunk = lsm_tree->nchunks - 1; end_chunk > 0; --end_chunk) {
+		chunk = lsm_tree->chunk[end_chunk];
+		if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
+			continue;
+
+		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) || chunk->generation > 0)
+			break;
+		else if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF) && F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+			break;
+	}
+
+	return (end_chunk);
+}
+
+/*
+ * __lsm_merge_take --
+ *	Starting from the oldest chunk in the range, take at most merge_max
+ * chunks whose merged size stays under size_max; if at least min_chunks were
+ * taken, mark them as merging and return the span.
+ */
+static int __lsm_merge_take(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int start_chunk, u_int end_chunk,
+	u_int min_chunks, uint64_t size_max, u_int* start, u_int* end, uint64_t* records)
+{
+	WT_LSM_CHUNK *chunk;
+	uint64_t record_count, size;
+	u_int i;
+
+	for (i = start_chunk, size = 0; i <= end_chunk && i - start_chunk < lsm_tree->merge_max; ++i) {
+		chunk = lsm_tree->chunk[i];
+		WT_ASSERT(session, !__lsm_merge_busy(chunk));
+		if (i > start_chunk && size + chunk->size > size_max)
+			break;
+		size += chunk->size;
+	}
+
+	if (i - start_chunk < WT_MAX(min_chunks, 2))
+		return (WT_NOTFOUND);
+
+	for (end_chunk = i - 1, record_count = 0, i = start_chunk; i <= end_chunk; ++i) {
+		F_SET(lsm_tree->chunk[i], WT_LSM_CHUNK_MERGING);
+		record_count += lsm_tree->chunk[i]->count;
+	}
+
+	*records = record_count;
+	*start = start_chunk;
+	*end = end_chunk;
+
+	return (0);
+}
+
+/*ԭеsize-tieredʽԣҲcompactֻlsm treemerge*/
+static int __lsm_merge_span_size(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int id, u_int* start, u_int* end, uint64_t* records)
 {
 	WT_LSM_CHUNK *chunk, *previous, *youngest;
 	uint32_t aggressive, max_gap, max_gen, max_level;
@@ -37,10 +110,6 @@ static int __lsm_merge_span(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_i
 	record_count = 0;
 	chunk = youngest = NULL;
 
-	*start = 0;
-	*end = 0;
-	*records = 0;
-
 	/*lsmֻڽcompact,Ҫƶһmergeʱchunk merge*/
 	if(!lsm_tree->modified || F_ISSET(lsm_tree, WT_LSM_TREE_COMPACTING)){
 		lsm_tree->merge_aggressiveness = 10;
@@ -51,30 +120,13 @@ static int __lsm_merge_span(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_i
 	merge_max = (aggressive > WT_LSM_AGGRESSIVE_THRESHOLD) ? 100 : lsm_tree->merge_min;
 	merge_min = (aggressive > WT_LSM_AGGRESSIVE_THRESHOLD) ? 2 : lsm_tree->merge_min;
 	max_gap = (aggressive + 4) / 5;
-	max_level = (lsm_tree->merge_throttle > 0) ? 0 : id + aggressive;
+	max_level = (lsm_tree->merge_rate > 0) ? 0 : id + aggressive;
 
 	if (lsm_tree->nchunks < merge_min)
 		return WT_NOTFOUND;
 
-	/*
-	 * Only include chunks that already have a Bloom filter or are the
-	 * result of a merge and not involved in a merge.
-	 * ȷmergeһchunk,chunkbloom filter
-	 */
-	for(end_chunk = lsm_tree->nchunks - 1; end_chunk > 0; --end_chunk){
-		chunk = lsm_tree->chunk[end_chunk];
-		WT_ASSERT(session, chunk != NULL);
-
-		if(!F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
-			continue;
-
-		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) || chunk->generation > 0)
-			break;
-
-		else if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF) && F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
-			break;
-	}
-
+	/*ȷmergeһchunk,chunkbloom filter*/
+	end_chunk = __lsm_merge_youngest(lsm_tree);
 	if(end_chunk < merge_min - 1)
 		return WT_NOTFOUND;
 
@@ -143,89 +195,252 @@ static int __lsm_merge_span(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_i
 	return 0;
 }
 
-/*chunks merge*/
-int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
+/*
+ * __lsm_merge_span_leveled --
+ *	Leveled merges: the run of generation 0 chunks is level 0 and is merged
+ * once it holds merge_min chunks.  Older chunks that are not at least
+ * merge_ratio times larger than everything younger belong to the same level
+ * and are merged with it, so each chunk stays merge_ratio times larger than
+ * the sum of the chunks after it.
+ */
+static int __lsm_merge_span_leveled(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int id, u_int* start, u_int* end, uint64_t* records)
 {
-	WT_BLOOM *bloom;
-	WT_CURSOR *dest, *src;
-	WT_DECL_RET;
-	WT_ITEM key, value;
 	WT_LSM_CHUNK *chunk;
-	uint32_t generation;
-	uint64_t insert_count, record_count;
-	u_int dest_id, end_chunk, i, nchunks, start_chunk, start_id;
-	u_int created_chunk, verb;
-	int create_bloom, locked, in_sync, tret;
-	const char *cfg[3];
-	const char *drop_cfg[] = { WT_CONFIG_BASE(session, session_drop), "force", NULL };
+	uint64_t run_size;
+	u_int end_chunk, start_chunk;
 
-	bloom = NULL;
-	chunk = NULL;
-	create_bloom = 0;
-	created_chunk = 0;
-	dest = src = NULL;
-	locked = 0;
-	start_id = 0;
-	in_sync = 0;
+	WT_UNUSED(id);
 
-	/*lsm treeûﵽmergeҪ*/
-	if (lsm_tree->nchunks < lsm_tree->merge_min && lsm_tree->merge_aggressiveness < WT_LSM_AGGRESSIVE_THRESHOLD)
-		return WT_NOTFOUND;
+	end_chunk = __lsm_merge_youngest(lsm_tree);
+	for (start_chunk = end_chunk + 1, run_size = 0; start_chunk > 0 && end_chunk + 1 - start_chunk < lsm_tree->merge_max; --start_chunk) {
+		chunk = lsm_tree->chunk[start_chunk - 1];
+		if (chunk->generation > 0 || __lsm_merge_busy(chunk))
+			break;
+		run_size += chunk->size;
+	}
 
-	/* lsm treeдֻһ߳̽merge chunkļ㣬ֹ߳ظ㣬Ȼ
-	 * û޸lsm treeĽṹﻹҪд*/
-	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
-	locked = 1;
+	if (end_chunk + 1 - start_chunk < lsm_tree->merge_min)
+		return (WT_NOTFOUND);
 
-	/*mergechunkΧ*/
-	WT_ERR(__lsm_merge_span(session, lsm_tree, id, &start_chunk, &end_chunk, &record_count));
-	nchunks = (end_chunk + 1) - start_chunk;
+	/*һlevel 0ݴ󲻵merge_ratioһϲ*/
+	for (; start_chunk > 0 && end_chunk + 1 - start_chunk < lsm_tree->merge_max; --start_chunk) {
+		chunk = lsm_tree->chunk[start_chunk - 1];
+		if (__lsm_merge_busy(chunk) || chunk->size >= run_size * lsm_tree->merge_ratio || run_size + chunk->size > lsm_tree->chunk_max)
+			break;
+		run_size += chunk->size;
+	}
 
-	/*ÿʼmerge*/
-	WT_ASSERT(session, nchunks > 0);
-	start_id = lsm_tree->chunk[start_chunk]->id;
+	return (__lsm_merge_take(session, lsm_tree, start_chunk, end_chunk, 2, UINT64_MAX, start, end, records));
+}
 
-	/* Find the merge generation. */
-	for (generation = 0, i = 0; i < nchunks; i++)
-		generation = WT_MAX(generation, lsm_tree->chunk[start_chunk + i]->generation + 1);
+/*tiered԰generation, time-window԰chunkʱڵĴڷ*/
+static uint64_t __lsm_merge_group(WT_LSM_TREE* lsm_tree, WT_LSM_CHUNK* chunk)
+{
+	if (lsm_tree->merge_policy == WT_LSM_MERGE_TIME_WINDOW)
+		return ((uint64_t)chunk->create_ts.tv_sec / lsm_tree->merge_window);
 
-	WT_ERR(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	return (chunk->generation);
+}
 
-	/* Allocate an ID for the merge. */
-	dest_id = WT_ATOMIC_ADD4(lsm_tree->last, 1);
+/*
+ * __lsm_merge_span_grouped --
+ *	Tiered and time-window merges: walk contiguous groups of chunks from the
+ * youngest and merge the first group with merge_min members.  A tiered merge
+ * only combines chunks of one generation, so every record is rewritten once
+ * per tier.  A time-window merge only combines chunks created in the same
+ * window, and a window that has closed is merged down to a single chunk
+ * regardless of chunk_max, so data expiring together stays together.
+ */
+static int __lsm_merge_span_grouped(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int id, u_int* start, u_int* end, uint64_t* records)
+{
+	WT_LSM_CHUNK *chunk;
+	struct timespec now;
+	uint64_t current, group;
+	u_int end_chunk, start_chunk;
+	int closed;
 
-	if(WT_VERBOSE_ISSET(session, WT_VERB_LSM)){
-		WT_ERR(__wt_verbose(session, WT_VERB_LSM, "Merging %s chunks %u-%u into %u (%" PRIu64 " records), generation %" PRIu32,
-			lsm_tree->name, start_chunk, end_chunk, dest_id, record_count, generation));
+	WT_UNUSED(id);
 
-		for (verb = start_chunk; verb <= end_chunk; verb++)
-			WT_ERR(__wt_verbose(session, WT_VERB_LSM, "%s: Chunk[%u] id %u",
-			lsm_tree->name, verb, lsm_tree->chunk[verb]->id));
+	current = UINT64_MAX;
+	if (lsm_tree->merge_policy == WT_LSM_MERGE_TIME_WINDOW) {
+		WT_RET(__wt_epoch(session, &now));
+		current = (uint64_t)now.tv_sec / lsm_tree->merge_window;
 	}
 
-	/*һchunkڴ*/
-	WT_ERR(__wt_calloc_one(session, &chunk));
-	created_chunk = 1;
-	chunk->id = dest_id;
+	for (end_chunk = __lsm_merge_youngest(lsm_tree); end_chunk > 0; end_chunk = start_chunk - 1) {
+		chunk = lsm_tree->chunk[end_chunk];
+		if (__lsm_merge_busy(chunk)) {
+			start_chunk = end_chunk;
+			continue;
+		}
 
-	/*mergechunksѾbloom filterҺϲchunksем¼,ômergeҪ¹bloom filter*/
-	if(FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) && (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
-		start_chunk > 0) && record_count > 0){
-			create_bloom = 1;
+		group = __lsm_merge_group(lsm_tree, chunk);
+		for (start_chunk = end_chunk; start_chunk > 0; --start_chunk) {
+			chunk = lsm_tree->chunk[start_chunk - 1];
+			if (__lsm_merge_busy(chunk) || __lsm_merge_group(lsm_tree, chunk) != group)
+				break;
+		}
+
+		closed = group < current;
+		if (__lsm_merge_take(session, lsm_tree, start_chunk, end_chunk, closed ? 2 : lsm_tree->merge_min,
+			closed ? UINT64_MAX : lsm_tree->chunk_max, start, end, records) == 0)
+			return (0);
+
+		if (start_chunk == 0)
+			break;
+	}
+
+	return (WT_NOTFOUND);
+}
+
+/*mergeԱ±WT_LSM_MERGE_*õchoicesһ*/
+static const struct {
+	const char* name;
+	int (*span)(WT_SESSION_IMPL*, WT_LSM_TREE*, u_int, u_int*, u_int*, uint64_t*);
+} __lsm_merge_policies[WT_LSM_MERGE_POLICIES] = {
+	{ "leveled", __lsm_merge_span_leveled },
+	{ "size", __lsm_merge_span_size },
+	{ "tiered", __lsm_merge_span_grouped },
+	{ "time_window", __lsm_merge_span_grouped }
+};
+
+/*ͨеĲҵmerge*/
+int __wt_lsm_merge_policy(WT_SESSION_IMPL* session, WT_CONFIG_ITEM* cval, u_int* policyp)
+{
+	u_int i;
+
+	for (i = 0; i < WT_LSM_MERGE_POLICIES; ++i)
+		if (WT_STRING_MATCH(__lsm_merge_policies[i].name, cval->str, cval->len)) {
+			*policyp = i;
+			return (0);
+		}
+
+	WT_RET_MSG(session, EINVAL, "unknown LSM merge policy '%.*s'", (int)cval->len, cval->str);
+}
+
+/*mergeԵ֣дlsm meta*/
+const char* __wt_lsm_merge_policy_name(u_int policy)
+{
+	return (__lsm_merge_policies[policy < WT_LSM_MERGE_POLICIES ? policy : WT_LSM_MERGE_SIZE].name);
+}
+
+/*lsm treeõĲԼmergechunkΧ*/
+static int __lsm_merge_span(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, u_int id, u_int* start, u_int* end, uint64_t* records)
+{
+	*start = 0;
+	*end = 0;
+	*records = 0;
+
+	/*ֻcompactlsm treeҪϲɾٵchunkõĲԣsizeԵaggressiveģʽ*/
+	if (!lsm_tree->modified || F_ISSET(lsm_tree, WT_LSM_TREE_COMPACTING) || lsm_tree->nchunks < 2)
+		return (__lsm_merge_span_size(session, lsm_tree, id, start, end, records));
+
+	return (__lsm_merge_policies[lsm_tree->merge_policy].span(session, lsm_tree, id, start, end, records));
+}
+
+/*
+ * Large merges are split by key range: each part reads the same chunks
+ * through its own merge cursor, but only copies the keys in [lower, upper)
+ * into its own bulk-loaded output chunk.  The outputs cover disjoint key
+ * ranges and together replace the merged chunks.
+ */
+typedef struct {
+	WT_SESSION_IMPL*	session;		/* Session doing the part */
+	WT_LSM_TREE*		lsm_tree;
+	u_int				start_chunk;	/* Chunks being merged */
+	u_int				nchunks;
+	uint32_t			start_id;
+	const WT_ITEM*		lower;			/* Range start, NULL if unbounded */
+	const WT_ITEM*		upper;			/* Range end (excluded), NULL if unbounded */
+	WT_ITEM				upper_key;		/* Buffer for the range end */
+	WT_LSM_CHUNK*		chunk;			/* Output chunk */
+	struct timespec		create_ts;		/* Output chunk create time */
+	int					create_bloom;	/* Build a Bloom filter */
+	uint64_t			record_count;	/* Records in the merged chunks */
+	uint64_t			insert_count;	/* Records written */
+	wt_thread_t			tid;
+	int					ret;
+} WT_LSM_MERGE_PART;
+
+/*
+ * __lsm_merge_split --
+ *	Choose the boundaries of the key ranges for a parallel merge from the
+ * keys of the root page of the largest chunk being merged.  A small chunk has
+ * few root entries, which reduces the number of parts.
+ */
+static int __lsm_merge_split(WT_SESSION_IMPL* session, WT_LSM_CHUNK* chunk, WT_LSM_MERGE_PART* parts, u_int* npartsp)
+{
+	WT_DECL_RET;
+	WT_PAGE *root;
+	WT_PAGE_INDEX *pindex;
+	size_t size;
+	u_int i, nparts;
+	const void *key;
+
+	nparts = *npartsp;
+
+	WT_RET(__wt_session_get_btree(session, chunk->uri, NULL, NULL, 0));
+	root = S2BT(session)->root.page;
+	if (root == NULL || root->type != WT_PAGE_ROW_INT)
+		nparts = 1;
+	else {
+		WT_ENTER_PAGE_INDEX(session);
+		WT_INTL_INDEX_GET(session, root, pindex);
+		nparts = WT_MIN(nparts, pindex->entries);
+		/*0keypageСkey, Ϊı߽*/
+		for (i = 1; ret == 0 && i < nparts; ++i) {
+			__wt_ref_key(root, pindex->index[(pindex->entries * i) / nparts], &key, &size);
+			ret = __wt_buf_set(session, &parts[i - 1].upper_key, key, size);
+		}
+		WT_LEAVE_PAGE_INDEX(session);
+	}
+	WT_TRET(__wt_session_release_btree(session));
+	WT_RET(ret);
+
+	for (i = 0; i < nparts; ++i) {
+		parts[i].lower = (i == 0) ? NULL : &parts[i - 1].upper_key;
+		parts[i].upper = (i == nparts - 1) ? NULL : &parts[i].upper_key;
 	}
+	*npartsp = nparts;
+
+	return 0;
+}
+
+/*ϲchunks[lower, upper)д뵽partchunk*/
+static int __lsm_merge_part(WT_LSM_MERGE_PART* part)
+{
+	WT_BLOOM *bloom;
+	WT_CURSOR *dest, *src;
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	WT_LSM_CHUNK *chunk;
+	WT_LSM_TREE *lsm_tree;
+	WT_SESSION_IMPL *session;
+	uint64_t insert_count;
+	int cmp, exact;
+	const char *cfg[3];
+
+	session = part->session;
+	lsm_tree = part->lsm_tree;
+	chunk = part->chunk;
+	bloom = NULL;
+	dest = src = NULL;
+	insert_count = 0;
+
 	/*ȷmergeʼchunkλúͷΧ*/
 	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
 	F_SET(src, WT_CURSTD_RAW);
-	WT_ERR(__wt_clsm_init_merge(src, start_chunk, start_id, nchunks));
+	WT_ERR(__wt_clsm_init_merge(src, part->start_chunk, part->start_id, part->nchunks));
 	/*ȡmerge chunkmetaϢ*/
 	WT_WITH_SCHEMA_LOCK(session, ret = __wt_lsm_tree_setup_chunk(session, lsm_tree, chunk));
 
 	WT_ERR(ret);
+	chunk->create_ts = part->create_ts;
 	/*һbloom filter*/
-	if(create_bloom){
+	if(part->create_bloom){
 		WT_ERR(__wt_lsm_tree_setup_bloom(session, lsm_tree, chunk));
 
-		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri, lsm_tree->bloom_config, record_count, lsm_tree->bloom_bit_count, 
+		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri, lsm_tree->bloom_config, part->record_count, lsm_tree->bloom_bit_count, 
 			lsm_tree->bloom_hash_count, &bloom));
 	}
 
@@ -237,9 +452,18 @@ int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	cfg[2] = NULL;
 	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
 
+	/*λĵһkey*/
+	if (part->lower == NULL)
+		ret = src->next(src);
+	else {
+		src->set_key(src, part->lower);
+		if ((ret = src->search_near(src, &exact)) == 0 && exact < 0)
+			ret = src->next(src);
+	}
+
 #define LSM_MERGE_CHECK_INTERVAL 1000
 	/*merge*/
-	for(insert_count = 0; (ret = src->next(src)) == 0; insert_count ++){
+	for(; ret == 0; insert_count ++, ret = src->next(src)){
 		if (insert_count % LSM_MERGE_CHECK_INTERVAL == 0) {
 			if (!F_ISSET(lsm_tree, WT_LSM_TREE_ACTIVE))
 				WT_ERR(EINTR);
@@ -250,13 +474,18 @@ int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 
 		/*¼ת*/
 		WT_ERR(src->get_key(src, &key));
+		if (part->upper != NULL) {
+			WT_ERR(__wt_compare(session, lsm_tree->collator, &key, part->upper, &cmp));
+			if (cmp >= 0)
+				break;
+		}
 		dest->set_key(dest, &key);
 		WT_ERR(src->get_value(src, &value));
 		dest->set_value(dest, &value);
 		WT_ERR(dest->insert(dest));
 
 		/*bloom filterеֵ*/
-		if (create_bloom)
+		if (bloom != NULL)
 			WT_ERR(__wt_bloom_insert(bloom, &key));
 	}
 
@@ -265,10 +494,9 @@ int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	WT_STAT_FAST_CONN_INCRV(session, lsm_rows_merged, insert_count % LSM_MERGE_CHECK_INTERVAL);
 
 	++lsm_tree->merge_progressing;
-	WT_ERR(__wt_verbose(session, WT_VERB_LSM, "Bloom size for %" PRIu64 " has %" PRIu64 " items inserted.", record_count, insert_count));
+	WT_ERR(__wt_verbose(session, WT_VERB_LSM, "Bloom size for %" PRIu64 " has %" PRIu64 " items inserted.", part->record_count, insert_count));
 
 	(void)WT_ATOMIC_ADD4(lsm_tree->merge_syncing, 1);
-	in_sync = 1;
 
 	WT_TRET(src->close(src));
 	WT_TRET(dest->close(dest));
@@ -278,7 +506,7 @@ int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	F_SET(session, WT_SESSION_NO_CACHE_CHECK);
 
 	/*bloomдװ*/
-	if(create_bloom){
+	if(bloom != NULL){
 		if (ret == 0)
 			WT_TRET(__wt_bloom_finalize(bloom));
 
@@ -291,20 +519,250 @@ int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 		bloom = NULL;
 	}
 
-	WT_ERR(ret);
-
 	/*תƺĿchunk֤*/
-	cfg[1] = "checkpoint=" WT_CHECKPOINT;
-	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
-	WT_TRET(dest->close(dest));
-	dest = NULL;
+	if (ret == 0) {
+		cfg[1] = "checkpoint=" WT_CHECKPOINT;
+		if ((ret = __wt_open_cursor(session, chunk->uri, NULL, cfg, &dest)) == 0) {
+			WT_TRET(dest->close(dest));
+			dest = NULL;
+		}
+	}
 
 	++lsm_tree->merge_progressing;
 	(void)WT_ATOMIC_SUB4(lsm_tree->merge_syncing, 1);
-	in_sync = 0;
 	WT_ERR_NOTFOUND_OK(ret);
 
 	WT_ERR(__wt_lsm_tree_set_chunk_size(session, chunk));
+	part->insert_count = insert_count;
+
+err:
+	if (src != NULL)
+		WT_TRET(src->close(src));
+
+	if (dest != NULL)
+		WT_TRET(dest->close(dest));
+
+	if (bloom != NULL)
+		WT_TRET(__wt_bloom_close(bloom));
+
+	F_CLR(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
+	return ret;
+}
+
+/*
+ * __lsm_merge_range_dels --
+ *	Copy the range tombstones of the merged chunks into the range tombstone
+ * file of the output chunk, they still hide keys in the chunks older than the
+ * merge.
+ */
+static int __lsm_merge_range_dels(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, WT_LSM_CHUNK** inputs, u_int ninputs, WT_LSM_CHUNK* chunk)
+{
+	WT_CURSOR *dest, *src;
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	u_int i;
+	const char *cfg[3];
+
+	dest = src = NULL;
+
+	WT_WITH_SCHEMA_LOCK(session, ret = __wt_lsm_tree_setup_range_del(session, lsm_tree, chunk));
+	WT_RET(ret);
+
+	cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+	cfg[1] = "raw";
+	cfg[2] = NULL;
+	WT_ERR(__wt_open_cursor(session, chunk->range_del_uri, NULL, cfg, &dest));
+
+	cfg[1] = "checkpoint=" WT_CHECKPOINT ",raw";
+	for (i = 0; i < ninputs; i++) {
+		WT_ERR(__wt_open_cursor(session, inputs[i]->range_del_uri, NULL, cfg, &src));
+		while ((ret = src->next(src)) == 0) {
+			WT_ERR(src->get_key(src, &key));
+			WT_ERR(src->get_value(src, &value));
+			WT_ERR(__wt_lsm_range_del_insert(session, lsm_tree, dest, &key, &value));
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+		WT_ERR(src->close(src));
+		src = NULL;
+	}
+
+	WT_ERR(dest->close(dest));
+	dest = NULL;
+
+	WT_WITH_SCHEMA_LOCK(session,
+		ret = __wt_schema_worker(session, chunk->range_del_uri, __wt_checkpoint, NULL, NULL, 0));
+
+err:
+	if (src != NULL)
+		WT_TRET(src->close(src));
+	if (dest != NULL)
+		WT_TRET(dest->close(dest));
+	return ret;
+}
+
+/*merge߳*/
+static WT_THREAD_RET __lsm_merge_part_thread(void* arg)
+{
+	WT_LSM_MERGE_PART *part;
+
+	part = arg;
+	part->ret = __lsm_merge_part(part);
+
+	return WT_THREAD_RET_VALUE;
+}
+
+/*chunks merge*/
+int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
+{
+	WT_DECL_RET;
+	WT_LSM_CHUNK *chunk, *largest, **chunks, **range_dels;
+	WT_LSM_MERGE_PART *part, *parts;
+	WT_SESSION *wt_session;
+	uint32_t generation;
+	uint64_t merge_bytes, record_count;
+	u_int created_chunks, end_chunk, i, nchunks, nparts, nrange_dels, parts_alloc, started, start_chunk, start_id;
+	u_int verb;
+	int create_bloom, locked, tret;
+	struct timespec create_ts, start;
+	const char *drop_cfg[] = { WT_CONFIG_BASE(session, session_drop), "force", NULL };
+
+	chunks = range_dels = NULL;
+	nrange_dels = 0;
+	create_bloom = 0;
+	locked = 0;
+	created_chunks = nparts = parts_alloc = started = 0;
+	parts = NULL;
+	start_id = 0;
+
+	/*lsm treeûﵽmergeҪ, time-windowԹرյĴchunkͿԺϲ*/
+	if (lsm_tree->nchunks < lsm_tree->merge_min && lsm_tree->merge_policy != WT_LSM_MERGE_TIME_WINDOW &&
+		lsm_tree->merge_aggressiveness < WT_LSM_AGGRESSIVE_THRESHOLD)
+		return WT_NOTFOUND;
+
+	/* lsm treeдֻһ߳̽merge chunkļ㣬ֹ߳ظ㣬Ȼ
+	 * û޸lsm treeĽṹﻹҪд*/
+	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
+	locked = 1;
+
+	/*mergechunkΧ*/
+	WT_ERR(__lsm_merge_span(session, lsm_tree, id, &start_chunk, &end_chunk, &record_count));
+	nchunks = (end_chunk + 1) - start_chunk;
+
+	/*ÿʼmerge*/
+	WT_ASSERT(session, nchunks > 0);
+	start_id = lsm_tree->chunk[start_chunk]->id;
+	/*ϲchunkchunkĴʱ䣬time-window԰ȷchunkĴ*/
+	create_ts = lsm_tree->chunk[end_chunk]->create_ts;
+
+	/* Find the merge generation and the largest chunk. */
+	for (generation = 0, merge_bytes = 0, largest = NULL, i = 0; i < nchunks; i++) {
+		chunk = lsm_tree->chunk[start_chunk + i];
+		generation = WT_MAX(generation, chunk->generation + 1);
+		merge_bytes += chunk->size;
+		if (largest == NULL || chunk->size > largest->size)
+			largest = chunk;
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+			++nrange_dels;
+	}
+
+	/*
+	 * A range tombstone only hides keys in older chunks: when the merge
+	 * includes the oldest chunk there is nothing left for it to hide and
+	 * it is dropped, otherwise it is carried into the merge output.
+	 */
+	if (start_chunk == 0)
+		nrange_dels = 0;
+	else if (nrange_dels > 0) {
+		WT_ERR(__wt_calloc_def(session, nrange_dels, &range_dels));
+		for (nrange_dels = 0, i = 0; i < nchunks; i++) {
+			chunk = lsm_tree->chunk[start_chunk + i];
+			if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+				range_dels[nrange_dels++] = chunk;
+		}
+	}
+
+	/*mergeÿ߳һchunk_sizeʱٲе߳*/
+	nparts = lsm_tree->merge_threads;
+	if (nparts > 1 && merge_bytes / lsm_tree->chunk_size < nparts)
+		nparts = WT_MAX(1, (u_int)(merge_bytes / lsm_tree->chunk_size));
+
+	/*mergechunksѾbloom filterҺϲchunksем¼,ômergeҪ¹bloom filter*/
+	if(FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) && (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
+		start_chunk > 0) && record_count > 0){
+			create_bloom = 1;
+	}
+
+	WT_ERR(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	locked = 0;
+
+	/*ϲchunkmerging״̬ᱻͷţڲ¶ȡlargest*/
+	WT_ERR(__wt_calloc_def(session, nparts, &parts));
+	parts_alloc = nparts;
+	if (nparts > 1)
+		WT_ERR(__lsm_merge_split(session, largest, parts, &nparts));
+
+	WT_ERR(__wt_calloc_def(session, nparts, &chunks));
+	for (i = 0; i < nparts; i++) {
+		part = &parts[i];
+		part->lsm_tree = lsm_tree;
+		part->start_chunk = start_chunk;
+		part->nchunks = nchunks;
+		part->start_id = start_id;
+		part->create_ts = create_ts;
+		part->create_bloom = create_bloom;
+		part->record_count = record_count;
+
+		/* Allocate an ID for the merge. */
+		WT_ERR(__wt_calloc_one(session, &part->chunk));
+		part->chunk->id = WT_ATOMIC_ADD4(lsm_tree->last, 1);
+		chunks[i] = part->chunk;
+		++created_chunks;
+	}
+
+	if(WT_VERBOSE_ISSET(session, WT_VERB_LSM)){
+		WT_ERR(__wt_verbose(session, WT_VERB_LSM, "Merging %s chunks %u-%u into %u (%" PRIu64 " records) in %u parts, generation %" PRIu32,
+			lsm_tree->name, start_chunk, end_chunk, chunks[0]->id, record_count, nparts, generation));
+
+		for (verb = start_chunk; verb <= end_chunk; verb++)
+			WT_ERR(__wt_verbose(session, WT_VERB_LSM, "%s: Chunk[%u] id %u",
+			lsm_tree->name, verb, lsm_tree->chunk[verb]->id));
+	}
+
+	WT_ERR(__wt_epoch(session, &start));
+
+	/*һɵǰworkerɣÿһ̺߳session*/
+	parts[0].session = session;
+	for (started = 1; started < nparts; ++started) {
+		part = &parts[started];
+		WT_ERR(__wt_open_internal_session(S2C(session), "lsm-merge", 1, 0, &part->session));
+		part->session->isolation = session->isolation;
+		if ((ret = __wt_thread_create(session, &part->tid, __lsm_merge_part_thread, part)) != 0) {
+			wt_session = &part->session->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+			part->session = NULL;
+			goto err;
+		}
+	}
+	ret = __lsm_merge_part(&parts[0]);
+
+	/*ȴе*/
+	for (; started > 1; --started) {
+		part = &parts[started - 1];
+		WT_TRET(__wt_thread_join(session, part->tid));
+		WT_TRET(part->ret);
+		wt_session = &part->session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		part->session = NULL;
+	}
+	WT_ERR(ret);
+
+	/*chunk˳滻ϲchunks, һchunkϵģΧɾ治Ḳchunk*/
+	if (nrange_dels > 0)
+		WT_ERR(__lsm_merge_range_dels(session, lsm_tree, range_dels, nrange_dels, chunks[0]));
+
+	for (i = 0, merge_bytes = 0; i < nparts; i++)
+		merge_bytes += chunks[i]->size;
+	__wt_lsm_manager_bandwidth(session, 1, merge_bytes, &start);
 	WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
 	locked = 1;
 
@@ -315,15 +773,22 @@ int __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 		}
 	}
 
-	/*mergerЧchunkslsm_tree->chunksƳ*/
-	WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, start_chunk, nchunks, chunk));
+	/*mergerЧchunkslsm_tree->chunksƳ, chunkһ滻*/
+	WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, start_chunk, nchunks, chunks, nparts));
 
-	if (create_bloom)
-		F_SET(chunk, WT_LSM_CHUNK_BLOOM);
-
-	chunk->count = insert_count;
-	chunk->generation = generation;
-	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+	for (i = 0; i < nparts; i++) {
+		chunk = chunks[i];
+		if (create_bloom)
+			F_SET(chunk, WT_LSM_CHUNK_BLOOM);
+		if (chunk->range_del_uri != NULL)
+			F_SET(chunk, WT_LSM_CHUNK_RANGE_DEL);
+
+		chunk->count = parts[i].insert_count;
+		chunk->generation = generation;
+		F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+		lsm_tree->bytes_merged += chunk->size;
+	}
+	created_chunks = 0;
 
 	/*lsm_treeԪϢ*/
 	if ((ret = __wt_lsm_meta_write(session, lsm_tree)) != 0)
@@ -341,20 +806,17 @@ err:
 	if (locked)
 		WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
 
-	if (in_sync)
-		(void)WT_ATOMIC_SUB4(lsm_tree->merge_syncing, 1);
-
-	if (src != NULL)
-		WT_TRET(src->close(src));
-
-	if (dest != NULL)
-		WT_TRET(dest->close(dest));
-
-	if (bloom != NULL)
-		WT_TRET(__wt_bloom_close(bloom));
+	/*߳ʧܣȴѾ߳*/
+	for (; started > 1; --started) {
+		part = &parts[started - 1];
+		WT_TRET(__wt_thread_join(session, part->tid));
+		wt_session = &part->session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
 
 	/*mergeʧܣ½chunkͷ*/
-	if(ret != 0 && created_chunk){
+	for (i = 0; i < created_chunks; i++) {
+		chunk = parts[i].chunk;
 		if (chunk->uri != NULL) {
 			WT_WITH_SCHEMA_LOCK(session, tret = __wt_schema_drop(session, chunk->uri, drop_cfg));
 			WT_TRET(tret);
@@ -365,17 +827,30 @@ err:
 			WT_TRET(tret);
 		}
 
+		if (chunk->range_del_uri != NULL) {
+			WT_WITH_SCHEMA_LOCK(session, tret = __wt_schema_drop(session, chunk->range_del_uri, drop_cfg));
+			WT_TRET(tret);
+		}
+
 		__wt_free(session, chunk->bloom_uri);
+		__wt_free(session, chunk->range_del_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
+	}
 
+	if (ret != 0 && ret != WT_NOTFOUND) {
 		if (ret == EINTR)
 			WT_TRET(__wt_verbose(session, WT_VERB_LSM, "Merge aborted due to close"));
 		else
 			WT_TRET(__wt_verbose(session, WT_VERB_LSM, "Merge failed with %s", __wt_strerror(session, ret, NULL, 0)));
 	}
 
-	F_CLR(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
+	for (i = 0; i < parts_alloc; i++)
+		__wt_buf_free(session, &parts[i].upper_key);
+	__wt_free(session, parts);
+	__wt_free(session, chunks);
+	__wt_free(session, range_dels);
+
 	return ret;
 }
 
@@ -24,6 +24,9 @@ int __wt_lsm_meta_read(WT_SESSION_IMPL* sesion, WT_LSM_TREE* lsm_tree)
 	/*lsmϢн*/
 	WT_ERR(__wt_config_init(session, &cparser, lsmconfig));
 
+	/*ûmerge_policyõtree(֮ǰİ汾tree)ʹĬϵsize*/
+	lsm_tree->merge_policy = WT_LSM_MERGE_SIZE;
+
 	/*ԸõĽ*/
 	while ((ret = __wt_config_next(&cparser, &ck, &cv)) == 0) {
 		if (WT_STRING_MATCH("key_format", ck.str, ck.len)) {
@@ -82,6 +85,21 @@ int __wt_lsm_meta_read(WT_SESSION_IMPL* sesion, WT_LSM_TREE* lsm_tree)
 			lsm_tree->merge_max = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("merge_min", ck.str, ck.len))
 			lsm_tree->merge_min = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("merge_policy", ck.str, ck.len)) {
+			/*δ֪ĲֿԽİ汾ʹĬϵsize*/
+			if (__wt_lsm_merge_policy(session, &cv, &lsm_tree->merge_policy) != 0)
+				lsm_tree->merge_policy = WT_LSM_MERGE_SIZE;
+		}
+		else if (WT_STRING_MATCH("merge_ratio", ck.str, ck.len))
+			lsm_tree->merge_ratio = (u_int)cv.val;
+		else if (WT_STRING_MATCH("merge_threads", ck.str, ck.len))
+			lsm_tree->merge_threads = (u_int)cv.val;
+		else if (WT_STRING_MATCH("merge_window", ck.str, ck.len))
+			lsm_tree->merge_window = (uint64_t)cv.val;
+		else if (WT_STRING_MATCH("bytes_flushed", ck.str, ck.len))
+			lsm_tree->bytes_flushed = (uint64_t)cv.val;
+		else if (WT_STRING_MATCH("bytes_merged", ck.str, ck.len))
+			lsm_tree->bytes_merged = (uint64_t)cv.val;
 		else if (WT_STRING_MATCH("last", ck.str, ck.len))
 			lsm_tree->last = (u_int)cv.val;
 		else if (WT_STRING_MATCH("chunks", ck.str, ck.len)) { /*ȡchunkԪϢ*/
@@ -101,6 +119,11 @@ int __wt_lsm_meta_read(WT_SESSION_IMPL* sesion, WT_LSM_TREE* lsm_tree)
 					F_SET(chunk, WT_LSM_CHUNK_BLOOM);
 					continue;
 				} 
+				else if (WT_STRING_MATCH("range_del", lk.str, lk.len)) {
+					WT_ERR(__wt_lsm_tree_range_del_name(session, lsm_tree, chunk->id, &chunk->range_del_uri));
+					F_SET(chunk, WT_LSM_CHUNK_RANGE_DEL);
+					continue;
+				}
 				else if (WT_STRING_MATCH("chunk_size", lk.str, lk.len)) {
 					chunk->size = (uint64_t)lv.val;
 					continue;
@@ -113,6 +136,10 @@ int __wt_lsm_meta_read(WT_SESSION_IMPL* sesion, WT_LSM_TREE* lsm_tree)
 					chunk->generation = (uint32_t)lv.val;
 					continue;
 				}
+				else if (WT_STRING_MATCH("create_ts", lk.str, lk.len)) {
+					chunk->create_ts.tv_sec = (time_t)lv.val;
+					continue;
+				}
 			}
 			WT_ERR_NOTFOUND_OK(ret);
 			lsm_tree->nchunks = nchunks;
@@ -125,6 +152,11 @@ int __wt_lsm_meta_read(WT_SESSION_IMPL* sesion, WT_LSM_TREE* lsm_tree)
 					F_SET(chunk, WT_LSM_CHUNK_BLOOM);
 					continue;
 				}
+				if (WT_STRING_MATCH("range_del", lk.str, lk.len)) {
+					WT_ERR(__wt_strndup(session, lv.str, lv.len, &chunk->range_del_uri));
+					F_SET(chunk, WT_LSM_CHUNK_RANGE_DEL);
+					continue;
+				}
 				WT_ERR(__wt_realloc_def(session, &lsm_tree->old_alloc, nchunks + 1, &lsm_tree->old_chunks));
 				WT_ERR(__wt_calloc_one(session, &chunk));
 				lsm_tree->old_chunks[nchunks++] = chunk;
@@ -147,6 +179,14 @@ int __wt_lsm_meta_read(WT_SESSION_IMPL* sesion, WT_LSM_TREE* lsm_tree)
 	if (lsm_tree->merge_min < 2)
 		lsm_tree->merge_min = WT_MAX(2, lsm_tree->merge_max / 2);
 
+	/*ϰ汾lsm treeûmergeԵ*/
+	if (lsm_tree->merge_ratio < 2)
+		lsm_tree->merge_ratio = 10;
+	if (lsm_tree->merge_threads == 0)
+		lsm_tree->merge_threads = 1;
+	if (lsm_tree->merge_window == 0)
+		lsm_tree->merge_window = 3600;
+
 err:
 	/*ͷlsmconfigٵڴռ*/
 	__wt_free(session, lsmconfig);
@@ -181,13 +221,22 @@ int __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		",auto_throttle=%" PRIu32
 		",merge_max=%" PRIu32
 		",merge_min=%" PRIu32
+		",merge_policy=%s"
+		",merge_ratio=%" PRIu32
+		",merge_threads=%" PRIu32
+		",merge_window=%" PRIu64
+		",bytes_flushed=%" PRIu64
+		",bytes_merged=%" PRIu64
 		",bloom=%" PRIu32
 		",bloom_bit_count=%" PRIu32
 		",bloom_hash_count=%" PRIu32,
 		lsm_tree->last, lsm_tree->chunk_count_limit,
 		lsm_tree->chunk_max, lsm_tree->chunk_size,
 		F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) ? 1 : 0,
-		lsm_tree->merge_max, lsm_tree->merge_min, lsm_tree->bloom,
+		lsm_tree->merge_max, lsm_tree->merge_min,
+		__wt_lsm_merge_policy_name(lsm_tree->merge_policy),
+		lsm_tree->merge_ratio, lsm_tree->merge_threads, lsm_tree->merge_window,
+		lsm_tree->bytes_flushed, lsm_tree->bytes_merged, lsm_tree->bloom,
 		lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count));
 
 	WT_ERR(__wt_buf_catfmt(session, buf, ",chunks=["));
@@ -202,6 +251,9 @@ int __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_buf_catfmt(session, buf, ",bloom"));
 
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+			WT_ERR(__wt_buf_catfmt(session, buf, ",range_del"));
+
 		if (chunk->size != 0)
 			WT_ERR(__wt_buf_catfmt(session, buf, ",chunk_size=%" PRIu64, chunk->size));
 
@@ -209,6 +261,9 @@ int __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			WT_ERR(__wt_buf_catfmt(session, buf, ",count=%" PRIu64, chunk->count));
 
 		WT_ERR(__wt_buf_catfmt(session, buf, ",generation=%" PRIu32, chunk->generation));
+
+		if (chunk->create_ts.tv_sec != 0)
+			WT_ERR(__wt_buf_catfmt(session, buf, ",create_ts=%" PRIu64, (uint64_t)chunk->create_ts.tv_sec));
 	}
 
 	WT_ERR(__wt_buf_catfmt(session, buf, "]"));
@@ -227,6 +282,8 @@ int __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		WT_ERR(__wt_buf_catfmt(session, buf, "\"%s\"", chunk->uri));
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_buf_catfmt(session, buf, ",bloom=\"%s\"", chunk->bloom_uri));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+			WT_ERR(__wt_buf_catfmt(session, buf, ",range_del=\"%s\"", chunk->range_del_uri));
 	}
 
 	WT_ERR(__wt_buf_catfmt(session, buf, "]"));
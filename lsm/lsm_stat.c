@@ -12,6 +12,7 @@ static int __curstat_lsm_init(WT_SESSION_IMPL* session, const char* uri, WT_CURS
 	WT_DSRC_STATS *new, *stats;
 	WT_LSM_CHUNK *chunk;
 	WT_LSM_TREE *lsm_tree;
+	uint64_t chunk_bytes, largest;
 	u_int i;
 	int locked;
 	char config[64];
@@ -48,8 +49,10 @@ static int __curstat_lsm_init(WT_SESSION_IMPL* session, const char* uri, WT_CURS
 
 	__wt_stat_init_dsrc_stats(stats);
 
-	for(i = 0; i < lsm_tree->nchunks; i++){
+	for(i = 0, chunk_bytes = largest = 0; i < lsm_tree->nchunks; i++){
 		chunk = lsm_tree->chunk[i];
+		chunk_bytes += chunk->size;
+		largest = WT_MAX(largest, chunk->size);
 		/*ʽchunkϢ*/
 		WT_ERR(__wt_buf_fmt(session, uribuf, "statistics:%s", chunk->uri));
 
@@ -91,6 +94,19 @@ static int __curstat_lsm_init(WT_SESSION_IMPL* session, const char* uri, WT_CURS
 	}
 
 	WT_STAT_SET(stats, lsm_chunk_count, lsm_tree->nchunks);
+	WT_STAT_SET(stats, lsm_throttle_debt, __wt_lsm_tree_throttle_debt(session, lsm_tree));
+	WT_STAT_SET(stats, lsm_throttle_rate, lsm_tree->throttle_rate);
+
+	/*
+	 * Write amplification is the bytes written by flushes and merges over
+	 * the bytes flushed; space amplification is the bytes held in chunks
+	 * over the largest chunk, an estimate of the live data once everything
+	 * is merged.
+	 */
+	if (lsm_tree->bytes_flushed != 0)
+		WT_STAT_SET(stats, lsm_write_amplification, ((lsm_tree->bytes_flushed + lsm_tree->bytes_merged) * 100) / lsm_tree->bytes_flushed);
+	if (largest != 0)
+		WT_STAT_SET(stats, lsm_space_amplification, (chunk_bytes * 100) / largest);
 	/*lsm_statsеͳϢܵstat*/
 	__wt_stat_aggregate_dsrc_stats(&lsm_tree->stats, stats);
 
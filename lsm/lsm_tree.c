@@ -17,6 +17,10 @@ static int __lsm_tree_discard(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, i
 
 	WT_UNUSED(final);
 
+	/*treeٲ빲ķ*/
+	if (lsm_tree->throttle_rate != 0)
+		(void)WT_ATOMIC_SUB4(S2C(session)->lsm_manager.throttle_trees, 1);
+
 	/*connectionеlsm queueƳ󣬷ֹ*/
 	if(F_ISSET(lsm_tree, WT_LSM_TREE_OPEN)){
 		/*session handler list lock*/
@@ -45,6 +49,7 @@ static int __lsm_tree_discard(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, i
 			continue;
 
 		__wt_free(session, chunk->bloom_uri);
+		__wt_free(session, chunk->range_del_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
 	}
@@ -56,6 +61,7 @@ static int __lsm_tree_discard(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, i
 		WT_ASSERT(session, chunk != NULL);
 
 		__wt_free(session, chunk->bloom_uri);
+		__wt_free(session, chunk->range_del_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
 	}
@@ -135,6 +141,21 @@ err:
 	return ret;
 }
 
+/*lsm treefilenameһchunkķΧɾļuri,ͨretp*/
+int __wt_lsm_tree_range_del_name(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t id, const char **retp)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+
+	WT_RET(__wt_scr_alloc(session, 0, &tmp));
+	WT_ERR(__wt_buf_fmt(session, tmp, "file:%s-%06" PRIu32 ".rd", lsm_tree->filename, id));
+	WT_ERR(__wt_strndup(session, tmp->data, tmp->size, retp));
+
+err:	
+	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
 /*chunk name*/
 int __wt_lsm_tree_chunk_name(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t id, const char **retp)
 {
@@ -212,6 +233,67 @@ int __wt_lsm_tree_setup_bloom(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, W
 	return ret;
 }
 
+/*chunkķΧɾļ, ߳schema lock, ļchunkʹͬ(keyʽcollator)*/
+int __wt_lsm_tree_setup_range_del(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
+
+	if (chunk->range_del_uri == NULL)
+		WT_RET(__wt_lsm_tree_range_del_name(session, lsm_tree, chunk->id, &chunk->range_del_uri));
+
+	/*chunk idǰʹùķΧɾļ*/
+	WT_RET(__lsm_tree_cleanup_old(session, chunk->range_del_uri));
+
+	return __wt_schema_create(session, chunk->range_del_uri, lsm_tree->file_config);
+}
+
+/*ڳschema lock´chunkķΧɾļswitchһȳschema lockٳtreeд*/
+static int __lsm_tree_range_del_create(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_DECL_RET;
+
+	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
+
+	/*sessionѾchunkѾǿдchunk*/
+	if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL | WT_LSM_CHUNK_ONDISK))
+		goto err;
+
+	WT_ERR(__wt_lsm_tree_setup_range_del(session, lsm_tree, chunk));
+
+	F_SET(chunk, WT_LSM_CHUNK_RANGE_DEL);
+	if ((ret = __wt_lsm_meta_write(session, lsm_tree)) != 0) {
+		F_CLR(chunk, WT_LSM_CHUNK_RANGE_DEL);
+		goto err;
+	}
+
+	/*д򿪵cursor´chunkϵķΧɾļ*/
+	++lsm_tree->dsk_gen;
+
+err:
+	WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	return ret;
+}
+
+/*
+ * __wt_lsm_tree_range_del_create --
+ *	Give the primary chunk a range tombstone file.  This is called from
+ * inside an application's truncate, the file and the metadata are created in
+ * an internal session so they don't become part of (and can't be rolled back
+ * with) the application's transaction.
+ */
+int __wt_lsm_tree_range_del_create(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *s;
+
+	WT_RET(__wt_open_internal_session(S2C(session), "lsm-range-del", 1, 0, &s));
+
+	WT_WITH_SCHEMA_LOCK(s, ret = __lsm_tree_range_del_create(s, lsm_tree, chunk));
+
+	WT_TRET((&s->iface)->close(&s->iface, NULL));
+	return ret;
+}
+
 /*һLSM TREEmetaϢд뵽meta*/
 int __wt_lsm_tree_create(WT_SESSION_IMPL *session, const char *uri, int exclusive, const char *config)
 {
@@ -309,6 +391,14 @@ int __wt_lsm_tree_create(WT_SESSION_IMPL *session, const char *uri, int exclusiv
 	lsm_tree->merge_min = (uint32_t)cval.val;
 	if (lsm_tree->merge_min > lsm_tree->merge_max)
 		WT_ERR_MSG(session, EINVAL, "LSM merge_min must be less than or equal to merge_max");
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_policy", &cval));
+	WT_ERR(__wt_lsm_merge_policy(session, &cval, &lsm_tree->merge_policy));
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_ratio", &cval));
+	lsm_tree->merge_ratio = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_threads", &cval));
+	lsm_tree->merge_threads = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_window", &cval));
+	lsm_tree->merge_window = (uint64_t)cval.val;
 
 	/*Ƚlsm treemetaϢд뵽metaУرյʱlsm tree*/
 	WT_ERR(__wt_scr_alloc(session, 0, &buf));
@@ -470,49 +560,99 @@ void __wt_lsm_tree_release(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree)
 	(void)WT_ATOMIC_SUB4(lsm_tree->refcnt, 1);
 }
 
-/* How aggressively to ramp up or down throttle due to level 0 merging */
-#define	WT_LSM_MERGE_THROTTLE_BUMP_PCT	(100 / lsm_tree->merge_max)
 /* Number of level 0 chunks that need to be present to throttle inserts */
 #define	WT_LSM_MERGE_THROTTLE_THRESHOLD	(2 * lsm_tree->merge_min)
-/* Minimal throttling time */
-#define	WT_LSM_THROTTLE_START			20
-
-#define	WT_LSM_MERGE_THROTTLE_INCREASE(val)	do {				\
-	(val) += ((val) * WT_LSM_MERGE_THROTTLE_BUMP_PCT) / 100;	\
-	if ((val) < WT_LSM_THROTTLE_START)							\
-	(val) = WT_LSM_THROTTLE_START;								\
-} while (0)
-
-#define	WT_LSM_MERGE_THROTTLE_DECREASE(val)	do {				\
-	(val) -= ((val) * WT_LSM_MERGE_THROTTLE_BUMP_PCT) / 100;	\
-	if ((val) < WT_LSM_THROTTLE_START)							\
-	(val) = 0;													\
-} while (0)
-
-/*ͨLRU Cache״̬checkpoint/mergeʱֵchunkƽʱ*/
+/* Slowest admitted update rate, bytes per second */
+#define	WT_LSM_THROTTLE_MIN_RATE		(64 * WT_KILOBYTE)
+/* Debt an update can run up without sleeping, nanoseconds */
+#define	WT_LSM_THROTTLE_BURST			(2 * WT_MILLION)
+/* Longest single sleep, microseconds */
+#define	WT_LSM_THROTTLE_MAX_SLEEP		WT_MILLION
+
+/*timespecӦ*/
+#define	WT_LSM_TS_NSEC(ts)	((uint64_t)(ts).tv_sec * WT_BILLION + (uint64_t)(ts).tv_nsec)
+
+/*
+ * __lsm_tree_throttle_set --
+ *	Install the tree's admitted rate, the smaller of the checkpoint and merge
+ * rates, and keep the connection's count of throttled trees, which divides the
+ * shared worker bandwidth between trees.
+ */
+static void __lsm_tree_throttle_set(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree)
+{
+	WT_LSM_MANAGER *manager;
+	uint64_t rate;
+
+	manager = &S2C(session)->lsm_manager;
+
+	rate = lsm_tree->ckpt_rate;
+	if (lsm_tree->merge_rate != 0 && (rate == 0 || lsm_tree->merge_rate < rate))
+		rate = lsm_tree->merge_rate;
+	if (rate != 0 && rate < WT_LSM_THROTTLE_MIN_RATE)
+		rate = WT_LSM_THROTTLE_MIN_RATE;
+
+	if (rate != 0 && lsm_tree->throttle_rate == 0)
+		(void)WT_ATOMIC_ADD4(manager->throttle_trees, 1);
+	else if (rate == 0 && lsm_tree->throttle_rate != 0) {
+		(void)WT_ATOMIC_SUB4(manager->throttle_trees, 1);
+		/*ۻծ*/
+		lsm_tree->throttle_tat = 0;
+	}
+	lsm_tree->throttle_rate = rate;
+
+	WT_STAT_FAST_CONN_SET(session, lsm_throttle_trees, manager->throttle_trees);
+}
+
+/*
+ * __lsm_tree_throttle_rate --
+ *	Choose between the current and the newly computed admission rate, 0
+ * meaning unthrottled.  With decrease_only set the throttle is only relaxed:
+ * an unthrottled tree stays unthrottled, a new rate of 0 removes the
+ * throttle, otherwise the higher rate wins.
+ */
+static uint64_t __lsm_tree_throttle_rate(uint64_t old, uint64_t rate, int decrease_only)
+{
+	if (!decrease_only)
+		return (rate);
+	if (old == 0 || rate == 0)
+		return 0;
+	return (WT_MAX(old, rate));
+}
+
+/*
+ * __wt_lsm_tree_throttle --
+ *	Work out the rate at which updates to the tree are admitted.  When
+ * chunks are waiting to be flushed, updates are admitted at a fraction of the
+ * measured flush bandwidth, the fraction shrinking as the backlog grows; when
+ * level 0 chunks are waiting to be merged, the same is done with the merge
+ * bandwidth.  The workers are shared by all trees, so the bandwidth is divided
+ * between the trees being throttled.
+ */
 void __wt_lsm_tree_throttle(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int decrease_only)
 {
 	WT_LSM_CHUNK *last_chunk, **cp, *ondisk, *prev_chunk;
-	uint64_t cache_sz, cache_used, oldtime, record_count, timediff;
-	uint32_t in_memory, gen0_chunks;
+	WT_LSM_MANAGER *manager;
+	uint64_t bw, cache_sz, cache_used, fill_bw, oldtime, rate, timediff;
+	uint32_t in_memory, gen0_chunks, share;
+
+	manager = &S2C(session)->lsm_manager;
 
-	/* lsm treechunk̫٣lsm treeֵ */
+	/* lsm treechunk̫٣ */
 	if (lsm_tree->nchunks < 3) {
-		lsm_tree->ckpt_throttle = lsm_tree->merge_throttle = 0;
+		lsm_tree->ckpt_rate = lsm_tree->merge_rate = 0;
+		__lsm_tree_throttle_set(session, lsm_tree);
 		return;
 	}
 
 	cache_sz = S2C(session)->cache_size;
 
 	/*ȷһ̵chunkڴchunkĸ*/
-	record_count = 1;
 	gen0_chunks = in_memory = 0;
 	ondisk = NULL;
 	for (cp = lsm_tree->chunk + lsm_tree->nchunks - 1; cp >= lsm_tree->chunk; --cp)
-		if (!F_ISSET(*cp, WT_LSM_CHUNK_ONDISK)) { /*ڴchunkڴм¼*/
-			record_count += (*cp)->count;
+		if (!F_ISSET(*cp, WT_LSM_CHUNK_ONDISK)) /*ڴchunk*/
 			++in_memory;
-		} else {
+		else {
 			/*ȷһ̵chunk*/
 			if (ondisk == NULL && ((*cp)->generation == 0 && !F_ISSET(*cp, WT_LSM_CHUNK_STABLE)))
 				ondisk = *cp;
@@ -524,39 +664,38 @@ void __wt_lsm_tree_throttle(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int
 
 	last_chunk = lsm_tree->chunk[lsm_tree->nchunks - 1];
 
-	/*ڴеchunk̫ٻҪcheckpoint*/
-	if(!F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) || in_memory <= 3)
-		lsm_tree->ckpt_throttle = 0;
-	else if(decrease_only)
-		;
-	else if(ondisk == NULL) /*ûchunḳôcheckpoint ʱֵŴ2*/
-		lsm_tree->ckpt_throttle = WT_MAX(WT_LSM_THROTTLE_START, 2 * lsm_tree->ckpt_throttle);
-	else{
-		/*ڴchunk¼ʱλ΢*/
-		WT_ASSERT(session, WT_TIMECMP(last_chunk->create_ts, ondisk->create_ts) >= 0);
-		timediff = WT_TIMEDIFF(last_chunk->create_ts, ondisk->create_ts);
-		lsm_tree->ckpt_throttle = (in_memory - 2) * timediff / (20 * record_count);
+	/*treetree*/
+	share = manager->throttle_trees + (lsm_tree->throttle_rate == 0 ? 1 : 0);
+
+	/*ûвʱchunkٶȹ*/
+	fill_bw = lsm_tree->chunk_fill_ms == 0 ? 0 : (lsm_tree->chunk_size * 1000) / lsm_tree->chunk_fill_ms;
 
-		/*жڴеchunkռõڴǷ񳬹cache̶ȣcheckpoint ֵŵ5,checkpointĽ*/
+	/*ڴеchunk̫ٻҪ*/
+	if (!F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) || in_memory <= 3)
+		lsm_tree->ckpt_rate = 0;
+	else if ((bw = manager->flush_bw != 0 ? manager->flush_bw : fill_bw) != 0) {
+		/*backlogԽдٶռflushıԽС*/
+		rate = (2 * bw) / ((in_memory - 1) * share);
+
+		/*ڴеchunkռõڴ泬cache80%һдٶ*/
 		cache_used = in_memory * lsm_tree->chunk_size * 2;
 		if (cache_used > cache_sz * 0.8)
-			lsm_tree->ckpt_throttle *= 5;
+			rate /= 5;
+
+		lsm_tree->ckpt_rate = __lsm_tree_throttle_rate(lsm_tree->ckpt_rate, rate, decrease_only);
 	}
 
-	/*lsm tree chunkmergemerge, ôҪmerge throttle*/
+	/*lsm tree chunkmergemerge, ôҪmerge*/
 	if (F_ISSET(lsm_tree, WT_LSM_TREE_MERGES)) {
-		/*ûгmergechunk,ômergeٶ*/
-		if (lsm_tree->nchunks < lsm_tree->merge_max)
-			lsm_tree->merge_throttle = 0;
-		else if (gen0_chunks < WT_LSM_MERGE_THROTTLE_THRESHOLD) /*ûвchunkСmergechunkСֵmergeٶ*/
-			WT_LSM_MERGE_THROTTLE_DECREASE(lsm_tree->merge_throttle);
-		else if (!decrease_only)
-			WT_LSM_MERGE_THROTTLE_INCREASE(lsm_tree->merge_throttle);
+		if (lsm_tree->nchunks < lsm_tree->merge_max || gen0_chunks < WT_LSM_MERGE_THROTTLE_THRESHOLD)
+			lsm_tree->merge_rate = 0;
+		else if ((bw = manager->merge_bw != 0 ? manager->merge_bw : fill_bw) != 0) {
+			rate = (bw * WT_LSM_MERGE_THROTTLE_THRESHOLD) / ((uint64_t)gen0_chunks * share);
+			lsm_tree->merge_rate = __lsm_tree_throttle_rate(lsm_tree->merge_rate, rate, decrease_only);
+		}
 	}
 
-	/*checkpointmergeƵʲС1*/
-	lsm_tree->ckpt_throttle = WT_MIN(1000000, lsm_tree->ckpt_throttle);
-	lsm_tree->merge_throttle = WT_MIN(1000000, lsm_tree->merge_throttle);
+	__lsm_tree_throttle_set(session, lsm_tree);
 
 	/*chunkˣôchunk ƽʱ,ûŪΪʲôģ*/
 	if (in_memory > 1 && ondisk != NULL) {
@@ -573,6 +712,63 @@ void __wt_lsm_tree_throttle(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int
 	}
 }
 
+/*
+ * __wt_lsm_tree_throttle_admit --
+ *	Charge an update to the tree's token bucket.  The bucket drains at the
+ * admitted rate: each update moves the drained time forward by size / rate,
+ * and the update sleeps for whatever the drained time is ahead of the clock
+ * beyond a small burst.  Every update pays its own share, there's no sawtooth
+ * of periodic long sleeps.
+ */
+void __wt_lsm_tree_throttle_admit(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree, size_t size)
+{
+	struct timespec now_ts;
+	uint64_t cost, now, rate, tat, new_tat, sleep_usecs;
+
+	if ((rate = lsm_tree->throttle_rate) == 0)
+		return;
+	if (__wt_epoch(session, &now_ts) != 0)
+		return;
+
+	now = WT_LSM_TS_NSEC(now_ts);
+	cost = ((uint64_t)size * WT_BILLION) / rate;
+	do {
+		tat = lsm_tree->throttle_tat;
+		new_tat = WT_MAX(tat, now) + cost;
+	} while (!WT_ATOMIC_CAS8(lsm_tree->throttle_tat, tat, new_tat));
+
+	if (new_tat <= now + WT_LSM_THROTTLE_BURST)
+		return;
+
+	sleep_usecs = WT_MIN((new_tat - now - WT_LSM_THROTTLE_BURST) / 1000, WT_LSM_THROTTLE_MAX_SLEEP);
+
+	/*õʼ¼checkpointmergeµĵȴ*/
+	if (lsm_tree->throttle_rate == lsm_tree->ckpt_rate) {
+		WT_STAT_FAST_INCRV(session, &lsm_tree->stats, lsm_checkpoint_throttle, sleep_usecs);
+		WT_STAT_FAST_CONN_INCRV(session, lsm_checkpoint_throttle, sleep_usecs);
+	}
+	else {
+		WT_STAT_FAST_INCRV(session, &lsm_tree->stats, lsm_merge_throttle, sleep_usecs);
+		WT_STAT_FAST_CONN_INCRV(session, lsm_merge_throttle, sleep_usecs);
+	}
+
+	__wt_sleep(0, (long)sleep_usecs);
+}
+
+/*treeǰծ(usecs)ҲѾɵд뻹Ҫò*/
+uint64_t __wt_lsm_tree_throttle_debt(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree)
+{
+	struct timespec now_ts;
+	uint64_t now, tat;
+
+	if (lsm_tree->throttle_rate == 0 || __wt_epoch(session, &now_ts) != 0)
+		return (0);
+
+	now = WT_LSM_TS_NSEC(now_ts);
+	tat = lsm_tree->throttle_tat;
+	return (tat > now ? (tat - now) / 1000 : 0);
+}
+
 /*ڴлlsm tree*/
 int __wt_lsm_tree_switch(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree)
 {
@@ -600,8 +796,8 @@ int __wt_lsm_tree_switch(WT_SESSION_IMPL* session, WT_LSM_TREE* lsm_tree)
 	WT_ERR(__wt_realloc_def(session, &lsm_tree->chunk_alloc, nchunks + 1, &lsm_tree->chunk));
 
 	WT_ERR(__wt_verbose(session, WT_VERB_LSM,
-		"Tree %s switch to: %" PRIu32 ", checkpoint throttle %" PRIu64
-		", merge throttle %" PRIu64, lsm_tree->name, new_id, lsm_tree->ckpt_throttle, lsm_tree->merge_throttle));
+		"Tree %s switch to: %" PRIu32 ", checkpoint rate %" PRIu64
+		", merge rate %" PRIu64, lsm_tree->name, new_id, lsm_tree->ckpt_rate, lsm_tree->merge_rate));
 
 	WT_ERR(__wt_calloc_one(session, &chunk));
 	chunk->id = new_id;
@@ -687,6 +883,8 @@ int __wt_lsm_tree_drop(WT_SESSION_IMPL* session, const char* name, const char* c
 		WT_ERR(__wt_schema_drop(session, chunk->uri, cfg));
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_schema_drop(session, chunk->bloom_uri, cfg));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+			WT_ERR(__wt_schema_drop(session, chunk->range_del_uri, cfg));
 	}
 	
 	/*ɾеold chunks schema*/
@@ -696,6 +894,8 @@ int __wt_lsm_tree_drop(WT_SESSION_IMPL* session, const char* name, const char* c
 		WT_ERR(__wt_schema_drop(session, chunk->uri, cfg));
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_schema_drop(session, chunk->bloom_uri, cfg));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+			WT_ERR(__wt_schema_drop(session, chunk->range_del_uri, cfg));
 	}
 
 	locked = 0;
@@ -754,6 +954,14 @@ int __wt_lsm_tree_rename(WT_SESSION_IMPL* session, const char* olduri, const cha
 			WT_ERR(__wt_schema_rename(session, old, chunk->uri, cfg));
 			__wt_free(session, old);
 		}
+
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL)) {
+			old = chunk->range_del_uri;
+			chunk->range_del_uri = NULL;
+			WT_ERR(__wt_lsm_tree_range_del_name(session, lsm_tree, chunk->id, &chunk->range_del_uri));
+			WT_ERR(__wt_schema_rename(session, old, chunk->range_del_uri, cfg));
+			__wt_free(session, old);
+		}
 	}
 
 	/*дһµmetaɾɵĶ*/
@@ -850,8 +1058,9 @@ int __wt_lsm_compact(WT_SESSION_IMPL *session, const char *name, int *skip)
 	WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
 	locked = 1;
 
-	/*merge ֵֹͬʱmerge*/
-	lsm_tree->merge_throttle = 0;
+	/*mergecompactڼmergeӦñ*/
+	lsm_tree->merge_rate = 0;
+	__lsm_tree_throttle_set(session, lsm_tree);
 	lsm_tree->merge_aggressiveness = 0;
 	progress = lsm_tree->merge_progressing;
 
@@ -987,6 +1196,10 @@ int __wt_lsm_tree_worker(WT_SESSION_IMPL *session, const char *uri,
 
 		if (name_func == __wt_backup_list_uri_append && F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_schema_worker(session, chunk->bloom_uri, file_func, name_func, cfg, open_flags));
+
+		/*ΧɾļchunkһҪcheckpointverifyͱ*/
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL))
+			WT_ERR(__wt_schema_worker(session, chunk->range_del_uri, file_func, name_func, cfg, open_flags));
 	}
 err:
 	if (locked)
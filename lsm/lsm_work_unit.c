@@ -198,6 +198,7 @@ int __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, W
 {
 	WT_DECL_RET;
 	WT_TXN_ISOLATION saved_isolation;
+	struct timespec start;
 
 	/*chunkѾcheckpointǱ뽫Ϊ״̬*/
 	if (F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) && !F_ISSET(chunk, WT_LSM_CHUNK_STABLE) && !chunk->evicted) {
@@ -223,6 +224,7 @@ int __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, W
 	}
 
 	WT_RET(__wt_verbose(session, WT_VERB_LSM, "LSM worker flushing %s", chunk->uri));
+	WT_RET(__wt_epoch(session, &start));
 
 	/*ĸԱʶ*/
 	if ((ret = __wt_session_get_btree(session, chunk->uri, NULL, NULL, 0)) == 0) {
@@ -243,8 +245,18 @@ int __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, W
 	if (ret != 0)
 		WT_RET_MSG(session, ret, "LSM checkpoint");
 
+	/*chunkϵķΧɾļchunkһ, ̺cursorcheckpointжȡ*/
+	if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL)) {
+		WT_WITH_SCHEMA_LOCK(session,
+			ret = __wt_schema_worker(session, chunk->range_del_uri, __wt_checkpoint, NULL, NULL, 0));
+
+		if (ret != 0)
+			WT_RET_MSG(session, ret, "LSM range tombstone checkpoint");
+	}
+
 	/* Now the file is written, get the chunk size. */
 	WT_RET(__wt_lsm_tree_set_chunk_size(session, chunk));
+	__wt_lsm_manager_bandwidth(session, 0, chunk->size, &start);
 
 	/* Update the flush timestamp to help track ongoing progress. */
 	WT_RET(__wt_epoch(session, &lsm_tree->last_flush_ts));
@@ -252,6 +264,7 @@ int __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, W
 	/* Lock the tree, mark the chunk as on disk and update the metadata. */
 	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
 	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+	lsm_tree->bytes_flushed += chunk->size;
 
 	ret = __wt_lsm_meta_write(session, lsm_tree);
 	++lsm_tree->dsk_gen;
@@ -427,6 +440,19 @@ int __wt_lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			F_CLR(chunk, WT_LSM_CHUNK_BLOOM);
 		}
 
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE_DEL)) {
+			drop_ret = __lsm_drop_file(session, chunk->range_del_uri);
+			if (drop_ret == EBUSY) {
+				++skipped;
+				continue;
+			} 
+			else if (drop_ret != ENOENT)
+				WT_ERR(drop_ret);
+
+			flush_metadata = 1;
+			F_CLR(chunk, WT_LSM_CHUNK_RANGE_DEL);
+		}
+
 		if (chunk->uri != NULL) {
 			drop_ret = __lsm_drop_file(session, chunk->uri);
 			if (drop_ret == EBUSY) {
@@ -445,6 +471,7 @@ int __wt_lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		/*old_chunks״̬*/
 		WT_ASSERT(session, lsm_tree->old_chunks[skipped] == chunk);
 		__wt_free(session, chunk->bloom_uri);
+		__wt_free(session, chunk->range_del_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, lsm_tree->old_chunks[skipped]);
 
@@ -53,6 +53,26 @@ int wiredtiger_struct_unpack(WT_SESSION *wt_session, const void *buffer, size_t
 	return ret;
 }
 
+/*
+ * wiredtiger_struct_unpack_batch --
+ *	Unpack records sharing a format into column arrays, one array per field
+ * indexed by record.  The format is parsed once for all of the records.
+ */
+int wiredtiger_struct_unpack_batch(WT_SESSION* wt_session, const char* fmt, const WT_ITEM* records, u_int nrecords, void** columns)
+{
+	WT_DECL_RET;
+	WT_PACK_COMPILED *pc;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+
+	WT_RET(__wt_struct_compile(session, fmt, &pc));
+	ret = __wt_struct_unpack_batch(session, pc, records, nrecords, columns);
+	__wt_struct_compiled_free(session, &pc);
+
+	return ret;
+}
+
 /*wt_apipack*/
 int __wt_ext_struct_pack(WT_EXTENSION_API *wt_api, WT_SESSION *wt_session,
 	void *buffer, size_t size, const char *fmt, ...)
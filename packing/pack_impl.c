@@ -89,3 +89,148 @@ int __wt_struct_unpack(WT_SESSION_IMPL *session,
 
 
 
+
+/*
+ * __wt_struct_compile --
+ *	Parse a format string once, the result is used to pack and unpack
+ * records without parsing the format again.  The compiled format keeps a copy
+ * of the format string.
+ */
+int __wt_struct_compile(WT_SESSION_IMPL* session, const char* fmt, WT_PACK_COMPILED** pcp)
+{
+	WT_DECL_PACK_VALUE(pv);
+	WT_DECL_RET;
+	WT_PACK pack;
+	WT_PACK_COMPILED *pc;
+	size_t alloc;
+
+	*pcp = NULL;
+	alloc = 0;
+
+	WT_RET(__wt_calloc_one(session, &pc));
+	pc->src = fmt;
+	pc->fixed = 1;
+	WT_ERR(__wt_strdup(session, fmt, &pc->fmt));
+
+	WT_ERR(__pack_init(session, &pack, fmt));
+	while ((ret = __pack_next(&pack, &pv)) == 0) {
+		WT_ERR(__wt_realloc_def(session, &alloc, pc->nfields + 1, &pc->fields));
+		pc->fields[pc->nfields++] = pv;
+
+		/*ֻЩpackĳȺֵ޹*/
+		switch (pv.type) {
+		case 'b':
+		case 'B':
+		case 't':
+			pc->fixed_len += 1;
+			break;
+		case 'R':
+			pc->fixed_len += sizeof(uint64_t);
+			break;
+		case 's':
+		case 'x':
+			pc->fixed_len += pv.size;
+			break;
+		case 'S':
+		case 'u':
+			if (pv.havesize) {
+				pc->fixed_len += pv.size;
+				break;
+			}
+			/* FALLTHROUGH */
+		default:
+			pc->fixed = 0;
+			break;
+		}
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+	if (!pc->fixed)
+		pc->fixed_len = 0;
+	*pcp = pc;
+
+	if (0) {
+err:
+		__wt_struct_compiled_free(session, &pc);
+	}
+	return (ret);
+}
+
+/*ͷһĸʽ*/
+void __wt_struct_compiled_free(WT_SESSION_IMPL* session, WT_PACK_COMPILED** pcp)
+{
+	WT_PACK_COMPILED *pc;
+
+	if ((pc = *pcp) == NULL)
+		return;
+
+	__wt_free(session, pc->fmt);
+	__wt_free(session, pc->fields);
+	__wt_free(session, *pcp);
+}
+
+/*ͷsessionıĸʽ*/
+void __wt_struct_compiled_discard(WT_SESSION_IMPL* session)
+{
+	u_int i;
+
+	for (i = 0; i < WT_SESSION_PACK_CACHE; ++i)
+		__wt_struct_compiled_free(session, &session->pack_cache[i]);
+}
+
+/*
+ * __wt_struct_unpack_batch --
+ *	Unpack records sharing a format into column arrays, one array per field
+ * indexed by record.  Arrays hold int64_t for signed integers, uint64_t for
+ * unsigned integers, bitfields and record numbers, const char * for strings
+ * and WT_ITEM for raw items.  Fields with a NULL array are skipped.
+ */
+int __wt_struct_unpack_batch(WT_SESSION_IMPL* session, WT_PACK_COMPILED* pc, const WT_ITEM* records, u_int nrecords, void** columns)
+{
+	WT_ITEM *item;
+	WT_PACK_VALUE pv;
+	const uint8_t *p, *end;
+	u_int f, r;
+
+	for (r = 0; r < nrecords; ++r) {
+		/*ʽֻҪһμ¼ĳ*/
+		if (pc->fixed && records[r].size < pc->fixed_len)
+			WT_RET_MSG(session, EINVAL, "record %u is too short for format '%s'", r, pc->fmt);
+
+		p = records[r].data;
+		end = p + records[r].size;
+		for (f = 0; f < pc->nfields; ++f) {
+			pv = pc->fields[f];
+			WT_RET(__unpack_read_fast(session, &pv, &p, (size_t)(end - p)));
+			if (columns[f] == NULL)
+				continue;
+
+			switch (pv.type) {
+			case 'x':
+				break;
+			case 's':
+			case 'S':
+				((const char **)columns[f])[r] = pv.u.s;
+				break;
+			case 'u':
+			case 'U':
+				item = &((WT_ITEM *)columns[f])[r];
+				item->data = pv.u.item.data;
+				item->size = pv.u.item.size;
+				break;
+			case 'b':
+			case 'h':
+			case 'i':
+			case 'l':
+			case 'q':
+				((int64_t *)columns[f])[r] = pv.u.i;
+				break;
+			default:
+				((uint64_t *)columns[f])[r] = pv.u.u;
+				break;
+			}
+		}
+	}
+
+	return (0);
+}
@@ -29,6 +29,11 @@ int __wt_realloc(WT_SESSION_IMPL* session, size_t* bytes_allocated_ret, size_t b
 	size_t bytes_allocated;
 
 	p = *(void **)retp;
+
+	/*cache huge page arenaеڴԼչ*/
+	if (p != NULL && __wt_cache_mem_owns(session, p))
+		return (__wt_cache_mem_realloc(session, bytes_allocated_ret, bytes_to_allocate, 0, retp));
+
 	bytes_allocated = (bytes_allocated_ret == NULL) ? 0 : *bytes_allocated_ret;
 	/*ԲУ*/
 	WT_ASSERT(session, (p == NULL && bytes_allocated == 0) ||
@@ -66,6 +71,9 @@ int __wt_realloc_aligned(WT_SESSION_IMPL *session, size_t *bytes_allocated_ret,
 {
 	WT_DECL_RET;
 
+	if (*(void **)retp != NULL && __wt_cache_mem_owns(session, *(void **)retp))
+		return (__wt_cache_mem_realloc(session, bytes_allocated_ret, bytes_to_allocate, 1, retp));
+
 	if (session != NULL && S2C(session)->buffer_alignment > 0) {
 		void *p, *newp;
 		size_t bytes_allocated;
@@ -158,6 +166,12 @@ void __wt_free_int(WT_SESSION_IMPL *session, const void *p_arg)
 	if (session != NULL)
 		WT_STAT_FAST_CONN_INCR(session, memory_free);
 
+	/*cache huge page arenaзڴ滹Ӧslab*/
+	if (__wt_cache_mem_owns(session, p)) {
+		__wt_cache_mem_free(session, p);
+		return;
+	}
+
 	free(p);
 }
 
@@ -1,31 +1,40 @@
 #include "wt_internal.h"
 
-/*ļжȡһַ,wt_item*/
 /*
+ * __wt_getline --
+ *	Read a line from a stream into buf, without the trailing newline.  Empty
+ * lines are skipped, an empty buffer means end-of-file.  The line is read with
+ * fgets in buffer-sized pieces rather than a character at a time, the JSON
+ * load path calls this once per record.
+ */
 int __wt_getline(WT_SESSION_IMPL *session, WT_ITEM *buf, FILE *fp)
 {
-	int c;
+	char *p;
+	size_t len;
 
 	WT_RET(__wt_buf_init(session, buf, 100));
-	
-	while((c = fgetc(fp)) != EOF){
-		WT_RET(__wt_buf_extend(session, buf, buf->size + 2));
-		if (c == '\n') {
-			if (buf->size == 0)
+
+	for (;;) {
+		p = (char *)buf->mem + buf->size;
+		if (fgets(p, (int)WT_MIN(buf->memsize - buf->size, INT_MAX), fp) == NULL)
+			break;
+
+		len = strlen(p);
+		buf->size += len;
+		if (len > 0 && p[len - 1] == '\n') {
+			if (--buf->size == 0)
 				continue;
 			break;
 		}
 
-		((char *)buf->mem)[buf->size++] = (char)c;
+		/*һûж꣬󻺳*/
+		WT_RET(__wt_buf_extend(session, buf, buf->memsize + 1));
 	}
 
-	if(c == EOF && ferror(fp))
+	if (ferror(fp))
 		WT_RET_MSG(session, __wt_errno(), "file read");
 
 	((char *)buf->mem)[buf->size] = '\0';
 
 	return 0;
-}*/
-
-
-
+}
@@ -89,3 +89,54 @@ int __wt_munmap(WT_SESSION_IMPL *session, WT_FH *fh, void *map, size_t len, void
 }
 
 
+
+/*Ϊcacheӳһlenȡalignڴ棬ʹhuge page(MAP_HUGETLB)ʧ˻صͨڴ沢ںʹ͸ҳ*/
+int __wt_mmap_huge(WT_SESSION_IMPL* session, size_t len, size_t align, void* mapp, int* hugep)
+{
+	void *map;
+	size_t maplen;
+	uintptr_t base, end;
+
+	*hugep = 0;
+
+#ifdef MAP_HUGETLB
+	/*huge pageӳַȻǰhuge pageС*/
+	map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, (wt_off_t)0);
+	if (map != MAP_FAILED && ((uintptr_t)map & (align - 1)) == 0) {
+		*hugep = 1;
+		*(void **)mapp = map;
+		return (__wt_verbose(session, WT_VERB_FILEOPS, "huge page region %p: %" WT_SIZET_FMT " bytes", map, len));
+	}
+	if (map != MAP_FAILED)
+		(void)munmap(map, len);
+#endif
+
+	/*ӳalignȣԺüǰĲ*/
+	maplen = len + align;
+	map = mmap(NULL, maplen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, (wt_off_t)0);
+	if (map == MAP_FAILED)
+		WT_RET_MSG(session, __wt_errno(), "cache region map error: failed to map %" WT_SIZET_FMT " bytes", maplen);
+
+	base = (uintptr_t)WT_ALIGN(map, align);
+	end = (uintptr_t)map + maplen;
+	if (base != (uintptr_t)map)
+		(void)munmap(map, base - (uintptr_t)map);
+	if (end != base + len)
+		(void)munmap((void *)(base + len), end - (base + len));
+
+#ifdef MADV_HUGEPAGE
+	(void)madvise((void *)base, len, MADV_HUGEPAGE);
+#endif
+
+	*(void **)mapp = (void *)base;
+	return (__wt_verbose(session, WT_VERB_FILEOPS, "cache region %p: %" WT_SIZET_FMT " bytes", (void *)base, len));
+}
+
+/*ͷ__wt_mmap_hugeӳڴ*/
+int __wt_munmap_huge(WT_SESSION_IMPL *session, void *map, size_t len)
+{
+	if (munmap(map, len) == 0)
+		return (0);
+
+	WT_RET_MSG(session, __wt_errno(), "cache region unmap error: failed to unmap %" WT_SIZET_FMT " bytes", len);
+}
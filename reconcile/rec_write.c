@@ -107,6 +107,17 @@ typedef struct
 	*/
 	int						leave_dirty;
 
+	/*
+	* Eviction can write the newest committed version of a key to the page
+	* and the versions it replaced to the history store: all updates before
+	* hs_resolved are committed or rolled back.  hs_max_txn is the largest
+	* transaction ID that replaced a version in the history store.
+	*/
+	int						hs_locked;
+	uint64_t				hs_resolved;
+	uint64_t				hs_max_txn;
+	uint64_t				hs_records;
+
 	/*
 	* Raw compression (don't get me started, as if normal reconciliation
 	* wasn't bad enough).  If an application wants absolute control over
@@ -264,6 +275,7 @@ static int  __rec_split_discard(WT_SESSION_IMPL *, WT_PAGE *);
 static int  __rec_split_fixup(WT_SESSION_IMPL *, WT_RECONCILE *);
 static int  __rec_split_row(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
 static int  __rec_split_row_promote(WT_SESSION_IMPL *, WT_RECONCILE *, WT_ITEM *, uint8_t);
+static uint64_t __rec_split_rows(WT_SESSION_IMPL *, WT_PAGE_HEADER *);
 static int  __rec_split_write(WT_SESSION_IMPL *, WT_RECONCILE *, WT_BOUNDARY *, WT_ITEM *, int);
 static int  __rec_write_init(WT_SESSION_IMPL *, WT_REF *, uint32_t, WT_SALVAGE_COOKIE *, void *);
 static int  __rec_write_wrapup(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
@@ -353,6 +365,13 @@ int __wt_reconcile(WT_SESSION_IMPL* session, WT_REF* ref, WT_SALVAGE_COOKIE* sal
 	else
 		F_CLR_ATOMIC(page, WT_PAGE_SCANNING);
 
+	if (r->hs_locked) {
+		WT_TRET(__wt_hs_evict_end(session));
+		r->hs_locked = 0;
+		if (ret == 0 && r->hs_records != 0)
+			WT_STAT_FAST_CONN_INCR(session, cache_eviction_hs);
+	}
+
 	/*
 	* Clean up the boundary structures: some workloads result in millions
 	* of these structures, and if associated with some random session that
@@ -550,6 +569,19 @@ static int __rec_write_init(WT_SESSION_IMPL* session, WT_REF* ref, uint32_t flag
 	*/
 	r->skipped_txn = S2C(session)->txn_global.last_running;
 
+	/*pageеhistory store汾ܱȡдpageҪʾ*/
+	r->hs_max_txn = WT_TXN_NONE;
+	r->hs_records = 0;
+	if (page->type == WT_PAGE_ROW_LEAF && page->dsk != NULL && F_ISSET(page->dsk, WT_PAGE_HS) && !__wt_txn_visible_all(session, page->dsk->recno))
+		r->hs_max_txn = page->dsk->recno;
+
+	r->hs_locked = 0;
+	if (F_ISSET(r, WT_SKIP_UPDATE_HS)) {
+		WT_RET(__wt_hs_evict_begin(session, &r->hs_locked, &r->hs_resolved));
+		if (!r->hs_locked)
+			F_CLR(r, WT_SKIP_UPDATE_HS);
+	}
+
 	return 0;
 }
 
@@ -645,6 +677,117 @@ static int __rec_skip_update_move(WT_SESSION_IMPL *session, WT_BOUNDARY *bnd, WT
 
 	return 0;
 }
+/*
+ * __rec_hs_older --
+ *	Return the version an update replaced: the first update before it made
+ * by another transaction, NULL if it replaced the original value.
+ */
+static inline WT_UPDATE* __rec_hs_older(WT_UPDATE* upd)
+{
+	WT_UPDATE *older;
+
+	for (older = upd->next; older != NULL; older = older->next)
+		if (older->txnid != WT_TXN_ABORTED && older->txnid != upd->txnid)
+			break;
+	return older;
+}
+
+/*
+ * __rec_hs_save --
+ *	Write the versions of a key replaced by transactions that aren't visible
+ * to everyone to the history store, and return the newest version to write
+ * to the page.  Returns EBUSY if the key's updates can't be written this way:
+ * an update isn't committed, the key was removed, or the original value is
+ * an overflow item.
+ */
+static int __rec_hs_save(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_INSERT* ins, WT_ROW* rip, WT_CELL_UNPACK* vpack, WT_UPDATE* upd_list, WT_UPDATE** updp)
+{
+	WT_DECL_ITEM(key);
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_ITEM item, *value;
+	WT_PAGE *page;
+	WT_UPDATE *newest, *older, *upd;
+	uint64_t records, seq;
+	int barrier;
+
+	page = r->page;
+
+	for (newest = upd_list; newest != NULL && newest->txnid == WT_TXN_ABORTED; newest = newest->next)
+		;
+	if (newest == NULL || WT_UPDATE_DELETED_ISSET(newest))
+		return EBUSY;
+
+	/*
+	* Count the records: one for each transaction's run of updates, until
+	* a transaction everyone can see, readers stop there.  If the key has
+	* older versions in the history store, a record replaced by transaction
+	* ID 0 (visible to everyone) separates them from the new records.
+	*/
+	barrier = rip != NULL && page->dsk != NULL && F_ISSET(page->dsk, WT_PAGE_HS);
+	for (records = 0, upd = newest; upd != NULL; upd = older) {
+		if (!TXNID_LT(upd->txnid, r->hs_resolved))
+			return EBUSY;
+		if (__wt_txn_visible_all(session, upd->txnid)) {
+			if (barrier)
+				++records;
+			break;
+		}
+		++records;
+		if ((older = __rec_hs_older(upd)) == NULL && rip != NULL && vpack != NULL && vpack->ovfl)
+			return EBUSY;
+	}
+
+	if (records != 0) {
+		WT_RET(__wt_scr_alloc(session, 0, &key));
+		WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+		if (rip != NULL)
+			WT_ERR(__wt_row_leaf_key(session, page, rip, key, 0));
+		else {
+			key->data = WT_INSERT_KEY(ins);
+			key->size = WT_INSERT_KEY_SIZE(ins);
+		}
+
+		/*µİ汾ʹøsequence*/
+		seq = WT_ATOMIC_ADD8(S2C(session)->hs_seq, records);
+		for (upd = newest; records > 0; upd = older, --seq, --records) {
+			if (__wt_txn_visible_all(session, upd->txnid)) {
+				WT_ERR(__wt_hs_insert(session, S2BT(session)->id, key, seq, WT_TXN_NONE, NULL));
+				break;
+			}
+
+			/*滻İ汾updatepageԭֵinsert֮ǰ*/
+			if ((older = __rec_hs_older(upd)) != NULL) {
+				item.data = WT_UPDATE_DATA(older);
+				item.size = older->size;
+				value = WT_UPDATE_DELETED_ISSET(older) ? NULL : &item;
+			}
+			else if (rip == NULL)
+				value = NULL;
+			else if (vpack == NULL) {
+				WT_CLEAR(item);
+				value = &item;
+			}
+			else {
+				WT_ERR(__wt_page_cell_data_ref(session, page, vpack, tmp));
+				value = tmp;
+			}
+			WT_ERR(__wt_hs_insert(session, S2BT(session)->id, key, seq, upd->txnid, value));
+
+			if (TXNID_LT(r->hs_max_txn, upd->txnid))
+				r->hs_max_txn = upd->txnid;
+			++r->hs_records;
+		}
+	}
+
+	*updp = newest;
+
+err:
+	__wt_scr_free(session, &key);
+	__wt_scr_free(session, &tmp);
+	return ret;
+}
+
 /*
  *	Return the first visible update in a list (or NULL if none are visible),
  * set a flag if any updates were skipped, track the maximum transaction ID on
@@ -652,6 +795,7 @@ static int __rec_skip_update_move(WT_SESSION_IMPL *session, WT_BOUNDARY *bnd, WT
  */
 static inline int __rec_txn_read(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_INSERT* ins, WT_ROW* rip, WT_CELL_UNPACK* vpack, WT_UPDATE** updp)
 {
+	WT_DECL_RET;
 	WT_ITEM ovfl;
 	WT_PAGE *page;
 	WT_UPDATE *upd, *upd_list, *upd_ovfl;
@@ -707,6 +851,20 @@ static inline int __rec_txn_read(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_I
 	/*update listǶsessionɼĻ践updateֵ, sessionɼ*/
 	if (__wt_txn_visible_all(session, max_txn) && !skipped)
 		return 0;
+
+	/*̭ʱȳ԰е񻹿ܶİ汾дhistory store*/
+	if (F_ISSET(r, WT_SKIP_UPDATE_HS)) {
+		if ((ret = __rec_hs_save(session, r, ins, rip, vpack, upd_list, &upd)) == 0) {
+			*updp = upd;
+			return 0;
+		}
+		if (ret != EBUSY)
+			return ret;
+		if (!F_ISSET(r, WT_SKIP_UPDATE_RESTORE)) {
+			page->modify->hs_busy_gen = r->orig_write_gen;
+			return EBUSY;
+		}
+	}
 	/*
 	 * If some updates are not globally visible, or were skipped, the page cannot be marked clean.
 	 */
@@ -1202,6 +1360,7 @@ static int __rec_is_checkpoint(WT_RECONCILE* r, WT_BOUNDARY* bnd)
 		bnd->addr.addr = NULL;
 		bnd->addr.size = 0;
 		bnd->addr.type = 0;
+		bnd->addr.rows = 0;
 		return 1;
 	}
 
@@ -1905,12 +2064,18 @@ static int __rec_split_write(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_BOUND
 
 	/* Set the zero-length value flag in the page header. */
 	if (dsk->type == WT_PAGE_ROW_LEAF){
-		F_CLR(dsk, WT_PAGE_EMPTY_V_ALL | WT_PAGE_EMPTY_V_NONE);
+		F_CLR(dsk, WT_PAGE_EMPTY_V_ALL | WT_PAGE_EMPTY_V_NONE | WT_PAGE_HS);
 
 		if (r->entries != 0 && r->all_empty_value)
 			F_SET(dsk, WT_PAGE_EMPTY_V_ALL);
 		if (r->entries != 0 && !r->any_empty_value)
 			F_SET(dsk, WT_PAGE_EMPTY_V_NONE);
+
+		/*¼滻history storeа汾IDɼ֮Ҫٲhistory store*/
+		if (r->hs_max_txn != WT_TXN_NONE) {
+			F_SET(dsk, WT_PAGE_HS);
+			dsk->recno = r->hs_max_txn;
+		}
 	}
 
 	switch (dsk->type){
@@ -1980,6 +2145,11 @@ skip_check_complete:
 		goto done;
 	}
 
+	/*ڵaddress cellм¼blockraw compressionĿѾѹȥͳ*/
+	bnd->addr.rows = 0;
+	if (btree->subtree_counts && !bnd->already_compressed && (dsk->type == WT_PAGE_ROW_INT || dsk->type == WT_PAGE_ROW_LEAF))
+		bnd->addr.rows = __rec_split_rows(session, dsk);
+
 	/*
 	* If we wrote this block before, re-use it.  Pages get written in the
 	* same block order every time, only check the appropriate slot.  The
@@ -2018,6 +2188,50 @@ err :
 	return ret;
 }
 
+/*
+ * __rec_split_rows --
+ *	Count the rows in the subtree a row-store block references: the keys of
+ * a leaf page, or the sum of the counts in an internal page's address cells.
+ * Returns the count plus one, or 0 if any child's count isn't known.
+ */
+static uint64_t __rec_split_rows(WT_SESSION_IMPL* session, WT_PAGE_HEADER* dsk)
+{
+	WT_BTREE *btree;
+	WT_CELL *cell;
+	WT_CELL_UNPACK *unpack, _unpack;
+	uint64_t rows;
+	uint32_t i;
+
+	btree = S2BT(session);
+	unpack = &_unpack;
+	rows = 1;
+
+	WT_CELL_FOREACH(btree, dsk, cell, unpack, i) {
+		__wt_cell_unpack(cell, unpack);
+		switch (unpack->type) {
+		case WT_CELL_KEY:
+		case WT_CELL_KEY_OVFL:
+			if (dsk->type == WT_PAGE_ROW_LEAF)
+				++rows;
+			break;
+		case WT_CELL_ADDR_INT:
+		case WT_CELL_ADDR_LEAF:
+		case WT_CELL_ADDR_LEAF_NO:
+			if (unpack->v == 0)
+				return 0;
+			rows += unpack->v - 1;
+			break;
+		case WT_CELL_ADDR_DEL:
+			/*fast-deleteеɼ֮ǰȷ*/
+			return 0;
+		default:
+			break;
+		}
+	}
+
+	return rows;
+}
+
 int __wt_bulk_init(WT_SESSION_IMPL* session, WT_CURSOR_BULK* cbulk)
 {
 	WT_BTREE* btree;
@@ -2888,6 +3102,7 @@ static int __rec_row_int(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_PAGE* pag
 	WT_PAGE *child;
 	WT_REF *ref;
 	size_t size;
+	uint64_t rows;
 	u_int vtype;
 	int hazard, key_onpage_ovfl, ovfl_key, state;
 	const void *p;
@@ -2979,15 +3194,19 @@ static int __rec_row_int(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_PAGE* pag
 			p = addr->addr;
 			size = addr->size;
 			vtype = (state == WT_CHILD_PROXY ? WT_CELL_ADDR_DEL : __rec_vtype(addr));
+			rows = addr->rows;
 		}
 		else{ /*ڴзaddr,cell upack*/
 			__wt_cell_unpack(ref->addr, vpack);
 			p = vpack->data;
 			size = vpack->size;
 			vtype = (state == WT_CHILD_PROXY ? WT_CELL_ADDR_DEL : (u_int)(vpack->raw));
+			rows = vpack->v;
 		}
+		if (!btree->subtree_counts || vtype == WT_CELL_ADDR_DEL)
+			rows = 0;
 
-		__rec_cell_build_addr(r, p, size, vtype, 0);
+		__rec_cell_build_addr(r, p, size, vtype, rows);
 		CHILD_RELEASE_ERR(session, hazard, ref);
 
 		/*
@@ -3063,7 +3282,7 @@ static int __rec_row_merge(WT_SESSION_IMPL* session, WT_RECONCILE* r, WT_PAGE* p
 
 		addr = &multi->addr;
 
-		__rec_cell_build_addr(r, addr->addr, addr->size, __rec_vtype(addr), 0);
+		__rec_cell_build_addr(r, addr->addr, addr->size, __rec_vtype(addr), S2BT(session)->subtree_counts ? addr->rows : 0);
 
 		/* Boundary: split or write the page. */
 		if (key->len + val->len > r->space_avail)
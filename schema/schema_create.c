@@ -249,7 +249,7 @@ int __wt_schema_index_source(WT_SESSION_IMPL* session, WT_TABLE* table, const ch
 static int __create_index(WT_SESSION_IMPL* session, const char* name, int exclusive, const char* config)
 {
 	WT_CONFIG kcols, pkcols;
-	WT_CONFIG_ITEM ckey, cval, icols, kval;
+	WT_CONFIG_ITEM ckey, cval, icols, inc, kval;
 	WT_DECL_PACK_VALUE(pv);
 	WT_DECL_RET;
 	WT_ITEM confbuf, extra_cols, fmt, namebuf;
@@ -350,8 +350,19 @@ static int __create_index(WT_SESSION_IMPL* session, const char* name, int exclus
 	if (ret != 0 && ret != WT_NOTFOUND)
 		goto err;
 
-	/* Index values are empty: all columns are packed into the index key. */
-	WT_ERR(__wt_buf_fmt(session, &fmt, "value_format=,key_format="));
+	/*
+	 * Index values are empty: all columns are packed into the index key,
+	 * unless the index covers some value columns of the table, they are
+	 * stored in the index value.
+	 */
+	WT_ERR(__wt_buf_fmt(session, &fmt, "value_format="));
+	WT_CLEAR(inc);
+	if (__wt_config_getones(session, config, "include", &inc) == 0 && inc.len != 0) {
+		if (have_extractor)
+			WT_ERR_MSG(session, EINVAL, "%s: an index with a custom extractor may not include columns", name);
+		WT_ERR(__wt_struct_reformat(session, table, inc.str, inc.len, NULL, 1, &fmt));
+	}
+	WT_ERR(__wt_buf_catfmt(session, &fmt, ",key_format="));
 
 	if (have_extractor) {
 		WT_ERR(__wt_buf_catfmt(session, &fmt, "%.*s",(int)kval.len, kval.str));
@@ -123,6 +123,7 @@ int __wt_schema_destroy_index(WT_SESSION_IMPL* session, WT_INDEX* idx)
 	__wt_free(session, idx->key_format);
 	__wt_free(session, idx->key_plan);
 	__wt_free(session, idx->value_plan);
+	__wt_free(session, idx->inc_plan);
 	__wt_free(session, idx->idxkey_format);
 	__wt_free(session, idx->exkey_format);
 	__wt_free(session, idx);
@@ -203,8 +203,27 @@ static int __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx
 	WT_ERR(__wt_buf_catfmt(session, buf, "x"));
 	WT_ERR(__wt_strndup(session, buf->data, buf->size, &idx->exkey_format));
 
-	/* By default, index cursor values are the table value columns. */
-	/* TODO Optimize to use index columns in preference to table lookups. */
+	/*
+	 * Covering indices store some table value columns in the index value,
+	 * the plan copies them out of the column groups when the index is
+	 * updated.  Compatibility: older index metadata has no include list.
+	 */
+	WT_CLEAR(idx->incconf);
+	WT_ERR_NOTFOUND_OK(__wt_config_getones(session, idx->config, "include", &idx->incconf));
+	if (idx->incconf.len != 0) {
+		WT_ERR(__wt_config_subinit(session, &colconf, &idx->incconf));
+		if ((ret = __wt_config_next(&colconf, &ckey, &cval)) == 0) {
+			WT_ERR(__wt_buf_init(session, plan, 0));
+			WT_ERR(__wt_struct_plan(session, table, idx->incconf.str, idx->incconf.len, 1, plan));
+			WT_ERR(__wt_strndup(session, plan->data, plan->size, &idx->inc_plan));
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+	}
+
+	/*
+	 * By default, index cursor values are the table value columns, index
+	 * cursors check when they're opened whether the index covers them.
+	 */
 	WT_ERR(__wt_buf_init(session, plan, 0));
 	WT_ERR(__wt_struct_plan(session, table, table->colconf.str, table->colconf.len, 1, plan));
 	WT_ERR(__wt_strndup(session, plan->data, plan->size, &idx->value_plan));
@@ -132,11 +132,15 @@ int __wt_schema_project_out(WT_SESSION_IMPL *session, WT_CURSOR **cp, const char
 	WT_CURSOR *c;
 	WT_DECL_PACK(pack);
 	WT_DECL_PACK_VALUE(pv);
+	WT_PACK_COMPILED *pc;
 	u_long arg;
+	u_int field;
 	char *proj;
 	uint8_t *p, *end;
 
 	p = end = NULL;		/* -Wuninitialized */
+	pc = NULL;
+	field = 0;
 
 	for(proj = (char*)proj_arg; *proj != '\0'; proj++){
 		arg = strtoul(proj, &proj, 10);
@@ -148,15 +152,19 @@ int __wt_schema_project_out(WT_SESSION_IMPL *session, WT_CURSOR **cp, const char
 				c->key.data = &c->recno;
 				c->key.size = sizeof(c->recno);
 				WT_RET(__pack_init(session, &pack, "R"));
+				pc = NULL;
 			} else
-				WT_RET(__pack_init(session, &pack, c->key_format));
+				WT_RET(__wt_cursor_pack_compiled(session, c, 1, &pc));
+			field = 0;
 			p = (uint8_t *)c->key.data;
 			end = p + c->key.size;
 			continue;
 
 		case WT_PROJ_VALUE:
 			c = cp[arg];
-			WT_RET(__pack_init(session, &pack, c->value_format));
+			/*ʹcolgroup cursorformatνformat*/
+			WT_RET(__wt_cursor_pack_compiled(session, c, 0, &pc));
+			field = 0;
 			p = (uint8_t *)c->value.data;
 			end = p + c->value.size;
 			continue;
@@ -171,8 +179,15 @@ int __wt_schema_project_out(WT_SESSION_IMPL *session, WT_CURSOR **cp, const char
 			case WT_PROJ_NEXT:
 			case WT_PROJ_SKIP:
 			case WT_PROJ_REUSE:
-				WT_RET(__pack_next(&pack, &pv));
-				WT_RET(__unpack_read(session, &pv, (const uint8_t **)&p, (size_t)(end - p)));
+				if (pc == NULL) {
+					WT_RET(__pack_next(&pack, &pv));
+					WT_RET(__unpack_read(session, &pv, (const uint8_t **)&p, (size_t)(end - p)));
+				} else {
+					if (field >= pc->nfields)
+						return (WT_NOTFOUND);
+					pv = pc->fields[field++];
+					WT_RET(__unpack_read_fast(session, &pv, (const uint8_t **)&p, (size_t)(end - p)));
+				}
 				/* Only copy the value out once. */
 				if (*proj != WT_PROJ_NEXT)
 					break;
@@ -144,6 +144,8 @@ int __wt_schema_range_truncate(WT_SESSION_IMPL *session, WT_CURSOR *start, WT_CU
 	} 
 	else if (WT_PREFIX_MATCH(uri, "table:"))
 		ret = __wt_table_range_truncate((WT_CURSOR_TABLE *)start, (WT_CURSOR_TABLE *)stop);
+	else if (WT_PREFIX_MATCH(uri, "lsm:"))
+		ret = __wt_clsm_range_truncate(session, start, stop);
 	else if ((dsrc = __wt_schema_get_source(session, uri)) != NULL && dsrc->range_truncate != NULL)
 		ret = dsrc->range_truncate(dsrc, &session->iface, start, stop);
 	else
@@ -53,6 +53,8 @@ static void __session_clear(WT_SESSION_IMPL* session)
 	memset(session, 0, WT_SESSION_CLEAR_SIZE(session));
 	session->hazard_size = 0;
 	session->nhazard = 0;
+	session->hazard_inuse = 0;
+	session->hazard_gen = 0;
 }
 
 /*رsession*/
@@ -76,12 +78,17 @@ static int __session_close(WT_SESSION* wt_session, const char* config)
 	if (conn->txn_global.states != NULL)
 		__wt_txn_release_snapshot(session);
 
-	/*رsessionйcursor*/
+	/*history store cursorڲcursor֪ͨӦ*/
+	WT_TRET(__wt_hs_cursor_close(session));
+
+	/*رsessionйcursorֹͣ棬ٹرcursor cacheеcursor*/
+	F_CLR(session, WT_SESSION_CACHE_CURSORS);
 	while ((cursor = TAILQ_FIRST(&session->cursors)) != NULL){
 		if (session->event_handler->handle_close != NULL)
 			WT_TRET(session->event_handler->handle_close(session->event_handler, wt_session, cursor));
 		WT_TRET(cursor->close(cursor));
 	}
+	WT_TRET(__wt_cursor_cache_discard(session));
 
 	WT_ASSERT(session, session->cursors == 0);
 
@@ -94,6 +101,7 @@ static int __session_close(WT_SESSION* wt_session, const char* config)
 
 	/* Discard scratch buffers, error memory. */
 	__wt_scr_discard(session);
+	__wt_struct_compiled_discard(session);
 	__wt_buf_free(session, &session->err);
 	/*sessionӦ*/
 	__wt_txn_destroy(session);
@@ -157,6 +165,15 @@ static int __session_reconfigure(WT_SESSION* wt_session, const char* config)
 
 	WT_TRET(__wt_session_reset_cursors(session));
 
+	/*Ƿ񻺴رյcursorرջʱͷѾcursor*/
+	WT_ERR(__wt_config_gets_def(session, cfg, "cache_cursors", 1, &cval));
+	if (cval.val)
+		F_SET(session, WT_SESSION_CACHE_CURSORS);
+	else {
+		F_CLR(session, WT_SESSION_CACHE_CURSORS);
+		WT_ERR(__wt_cursor_cache_discard(session));
+	}
+
 	/*ȷ뼶*/
 	WT_ERR(__wt_config_gets_def(session, cfg, "isolation", 0, &cval));
 	if (cval.len != 0)
@@ -276,8 +293,16 @@ static int __session_open_cursor(WT_SESSION* wt_session, const char* uri, WT_CUR
 			WT_ERR(__wt_bad_object_type(session, uri));
 	}
 
-	/*uricursor*/
-	WT_ERR(__wt_open_cursor(session, uri, NULL, cfg, &cursor));
+	/*cursor cacheвͬuriô򿪹cursor, Ҳٴһµcursor*/
+	if (F_ISSET(session, WT_SESSION_CACHE_CURSORS))
+		WT_ERR_NOTFOUND_OK(__wt_cursor_cache_get(session, uri, config, &cursor));
+
+	if (cursor == NULL) {
+		/*uricursor*/
+		WT_ERR(__wt_open_cursor(session, uri, NULL, cfg, &cursor));
+		if (cursor->cache != NULL && F_ISSET(session, WT_SESSION_CACHE_CURSORS))
+			WT_ERR(__wt_cursor_cache_key(cursor, uri, config));
+	}
 	if (to_dup != NULL)
 		WT_ERR(__wt_cursor_dup_position(to_dup, cursor));
 
@@ -379,6 +404,9 @@ static int __session_rename(WT_SESSION* wt_session, const char* uri, const char*
 	WT_ERR(__wt_str_name_check(session, uri));
 	WT_ERR(__wt_str_name_check(session, newuri));
 
+	/*cursortableã޸schemaǰر*/
+	WT_ERR(__wt_cursor_cache_discard(session));
+
 	WT_WITH_SCHEMA_LOCK(session, WT_WITH_TABLE_LOCK(session, ret = __wt_schema_rename(session, uri, newuri, cfg)));
 
 err:
@@ -414,6 +442,9 @@ static int __session_drop(WT_SESSION* wt_session, const char* uri, const char* c
 	/* Disallow objects in the WiredTiger name space. */
 	WT_ERR(__wt_str_name_check(session, uri));
 
+	/*cursortableã޸schemaǰر*/
+	WT_ERR(__wt_cursor_cache_discard(session));
+
 	WT_WITH_SCHEMA_LOCK(session, WT_WITH_TABLE_LOCK(session, ret = __wt_schema_drop(session, uri, cfg)));
 
 err:	
@@ -595,6 +626,141 @@ err:
 	API_END_RET_NOTFOUND_MAP(session, ret);
 }
 
+/*JSONʽһ*/
+static int __session_dump(WT_SESSION* wt_session, const char* uri, const char* filename, const char* config)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL(session, dump, config, cfg);
+
+	ret = __wt_session_dump(session, uri, filename, cfg);
+
+err:
+	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
+/*JSON dumpļһ󣬶󲻴ʱļͷеĸʽ*/
+static int __session_load(WT_SESSION* wt_session, const char* uri, const char* filename, const char* config)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL(session, load, config, cfg);
+
+	/* Disallow objects in the WiredTiger name space. */
+	WT_ERR(__wt_str_name_check(session, uri));
+	ret = __wt_session_load(session, uri, filename, cfg);
+
+err:
+	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
+/*
+ * __session_count_range --
+ *	WT_SESSION->count_range method.
+ */
+static int __session_count_range(WT_SESSION* wt_session, WT_CURSOR* start, WT_CURSOR* stop, const char* config, uint64_t* countp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	int cmp;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL(session, count_range, config, cfg);
+
+	*countp = 0;
+	if (start == NULL && stop == NULL)
+		WT_ERR_MSG(session, EINVAL, "the count_range method should be passed a start cursor, a stop cursor or both");
+
+	cursor = start == NULL ? stop : start;
+	if (cursor->compare == NULL)
+		WT_ERR(__wt_bad_object_type(session, cursor->uri));
+
+	/*compareͬʱcursorõͬһ󣬲Ҷkey*/
+	if (start != NULL && stop != NULL) {
+		WT_ERR(start->compare(start, stop, &cmp));
+		if (cmp > 0)
+			WT_ERR_MSG(session, EINVAL, "the start cursor position is after the stop cursor position");
+	}
+
+	WT_ERR(__wt_config_gets(session, cfg, "approximate", &cval));
+
+	/*tablecolgroupͳ*/
+	if (WT_PREFIX_MATCH(cursor->internal_uri, "table:")) {
+		if (start != NULL)
+			start = WT_CURSOR_PRIMARY(start);
+		if (stop != NULL)
+			stop = WT_CURSOR_PRIMARY(stop);
+		cursor = start == NULL ? stop : start;
+	}
+	if (!WT_PREFIX_MATCH(cursor->internal_uri, "file:"))
+		WT_ERR(__wt_bad_object_type(session, cursor->uri));
+
+	if (start != NULL)
+		WT_CURSOR_NEEDKEY(start);
+	if (stop != NULL)
+		WT_CURSOR_NEEDKEY(stop);
+	WT_WITH_BTREE(session, ((WT_CURSOR_BTREE *)cursor)->btree,
+		ret = __wt_btcur_count_range((WT_CURSOR_BTREE *)start, (WT_CURSOR_BTREE *)stop, cval.val != 0, countp));
+
+err:
+	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
+/*
+ * __session_position_rank --
+ *	WT_SESSION->position_rank method.
+ */
+static int __session_position_rank(WT_SESSION* wt_session, WT_CURSOR* cursor, uint64_t rank, const char* config)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CURSOR **cp;
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	u_int i, ncursors;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL(session, position_rank, config, cfg);
+
+	if (cursor->compare == NULL)
+		WT_ERR(__wt_bad_object_type(session, cursor->uri));
+
+	WT_ERR(__wt_config_gets(session, cfg, "approximate", &cval));
+
+	/*tablecolgroupϲ*/
+	if (WT_PREFIX_MATCH(cursor->internal_uri, "table:")) {
+		cp = ((WT_CURSOR_TABLE *)cursor)->cg_cursors;
+		ncursors = WT_COLGROUPS(((WT_CURSOR_TABLE *)cursor)->table);
+	}
+	else {
+		cp = &cursor;
+		ncursors = 1;
+	}
+	if (!WT_PREFIX_MATCH(cp[0]->internal_uri, "file:"))
+		WT_ERR(__wt_bad_object_type(session, cursor->uri));
+
+	WT_ERR(__wt_scr_alloc(session, 0, &key));
+	WT_WITH_BTREE(session, ((WT_CURSOR_BTREE *)cp[0])->btree,
+		ret = __wt_btree_rank_key(session, rank, cval.val != 0, key));
+	WT_ERR(ret);
+
+	/*keyʱbufferУǰÿcursorԼkey*/
+	__wt_cursor_set_raw_key(cursor, key);
+	for (i = 0; i < ncursors; ++i)
+		WT_ERR(__wt_buf_set(session, &cp[i]->key, cp[i]->key.data, cp[i]->key.size));
+	ret = cursor->search(cursor);
+
+err:
+	__wt_scr_free(session, &key);
+	API_END_RET(session, ret);
+}
+
 /*sessionʼһ*/
 static int __session_begin_transaction(WT_SESSION* wt_session, const char* config)
 {
@@ -770,6 +936,7 @@ int __wt_open_internal_session(WT_CONNECTION_IMPL* conn, const char* name, int u
 	* flag to avoid this: internal sessions are not closed automatically.
 	*/
 	F_SET(session, WT_SESSION_INTERNAL);
+	F_CLR(session, WT_SESSION_CACHE_CURSORS);
 
 	/*
 	* Some internal threads must keep running after we close all data
@@ -818,7 +985,11 @@ int __wt_open_session(WT_CONNECTION_IMPL* conn, WT_EVENT_HANDLER* event_handler,
 		__session_commit_transaction,
 		__session_rollback_transaction,
 		__session_checkpoint,
-		__session_transaction_pinned_range
+		__session_transaction_pinned_range,
+		__session_dump,
+		__session_load,
+		__session_count_range,
+		__session_position_rank
 	};
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session, *session_ret;
@@ -869,15 +1040,22 @@ int __wt_open_session(WT_CONNECTION_IMPL* conn, WT_EVENT_HANDLER* event_handler,
 	* If we don't have one, allocate the dhandle hash array.
 	* Allocate the table hash array as well.
 	*/
-	if (session_ret->dhhash == NULL)
-		WT_ERR(__wt_calloc(session_ret, WT_HASH_ARRAY_SIZE, sizeof(struct __dhandles_hash), &session_ret->dhhash));
+	if (session_ret->dhtable == NULL) {
+		WT_ERR(__wt_calloc_def(session_ret, WT_SESSION_DHTABLE_MIN, &session_ret->dhtable));
+		session_ret->dhtable_size = WT_SESSION_DHTABLE_MIN;
+	}
 	if (session_ret->tablehash == NULL)
 		WT_ERR(__wt_calloc(session_ret, WT_HASH_ARRAY_SIZE, sizeof(struct __tables_hash), &session_ret->tablehash));
+	if (session_ret->cursor_cache == NULL)
+		WT_ERR(__wt_calloc(session_ret, WT_HASH_ARRAY_SIZE, sizeof(struct __cursors_cache), &session_ret->cursor_cache));
 	for (i = 0; i < WT_HASH_ARRAY_SIZE; i++) {
-		SLIST_INIT(&session_ret->dhhash[i]);
 		SLIST_INIT(&session_ret->tablehash[i]);
+		TAILQ_INIT(&session_ret->cursor_cache[i]);
 	}
 
+	/*ӦõsessionĬϻرյcursorڲsession__wt_open_internal_sessionйر*/
+	F_SET(session_ret, WT_SESSION_CACHE_CURSORS);
+
 	/* Initialize transaction support: default to read-committed. */
 	session_ret->isolation = TXN_ISO_READ_COMMITTED;
 	WT_ERR(__wt_txn_init(session_ret));
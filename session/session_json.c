@@ -0,0 +1,292 @@
+/***************************************************************************
+*JSONʽʽ͵(WT_SESSION::dump/WT_SESSION::load)
+***************************************************************************/
+
+#include "wt_internal.h"
+
+/*
+ * The dump file starts with a short header describing the object, followed
+ * by one record per line:
+ *
+ *	{
+ *	    "uri" : "table:xxx",
+ *	    "key_format" : "S",
+ *	    "value_format" : "Si",
+ *	    "columns" : "k,v0,v1",
+ *	    "data" : [
+ *	{ "k" : "abc", "v0" : "def", "v1" : 1 },
+ *	...
+ *	{ "k" : "xyz", "v0" : "uvw", "v1" : 9 }
+ *	    ]
+ *	}
+ *
+ * The whole file is valid JSON.  Keeping each record on its own line lets
+ * the loader work with a single reusable line buffer, neither side ever holds
+ * more than one record in memory.
+ */
+
+/*dumploadʹõstdioС*/
+#define	WT_JSON_STREAM_BUF	(1024 * 1024)
+
+/*дdumpļͷ*/
+static int __json_dump_header(WT_SESSION_IMPL* session, FILE* fp, const char* uri, WT_CURSOR* cursor, WT_CURSOR_JSON* json)
+{
+	WT_RET(__wt_fprintf(fp, "{\n    \"uri\" : \"%s\",\n    \"key_format\" : \"%s\",\n    \"value_format\" : \"%s\",\n",
+		uri, cursor->key_format, cursor->value_format));
+
+	/*ûĶJSONʹkey0/value0֣Ҫ*/
+	if (json->key_names.len != 0 && json->value_names.len != 0)
+		WT_RET(__wt_fprintf(fp, "    \"columns\" : \"%.*s,%.*s\",\n",
+			(int)json->key_names.len, json->key_names.str, (int)json->value_names.len, json->value_names.str));
+
+	return (__wt_fprintf(fp, "    \"data\" : [\n"));
+}
+
+/*
+ * __wt_session_dump --
+ *	WT_SESSION::dump, write every record of an object to a JSON file.
+ */
+int __wt_session_dump(WT_SESSION_IMPL* session, const char* uri, const char* filename, const char* cfg[])
+{
+	WT_CURSOR *cursor;
+	WT_CURSOR_JSON *json;
+	WT_DECL_RET;
+	FILE *fp;
+	const char *key, *value;
+	const char *cur_cfg[] = { NULL, "dump=json", NULL };
+	int first;
+
+	WT_UNUSED(cfg);
+
+	cursor = NULL;
+	fp = NULL;
+	first = 1;
+
+	cur_cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+	WT_RET(__wt_open_cursor(session, uri, NULL, cur_cfg, &cursor));
+
+	/*keyvalueJSONֱcursorõĻɣ֮䲻*/
+	json = (WT_CURSOR_JSON *)cursor->json_private;
+	json->oneline = 1;
+
+	WT_ERR(__wt_fopen(session, filename, WT_FHANDLE_WRITE, 0, &fp));
+	if (setvbuf(fp, NULL, _IOFBF, WT_JSON_STREAM_BUF) != 0)
+		WT_ERR(__wt_errno());
+
+	WT_ERR(__json_dump_header(session, fp, uri, cursor, json));
+
+	while ((ret = cursor->next(cursor)) == 0) {
+		WT_ERR(cursor->get_key(cursor, &key));
+		WT_ERR(cursor->get_value(cursor, &value));
+
+		/*һ¼Ķﲹϣһ¼ûж*/
+		if ((!first && fputs(",\n", fp) == EOF) ||
+			fputs("{ ", fp) == EOF || fputs(key, fp) == EOF || fputs(", ", fp) == EOF ||
+			fputs(value, fp) == EOF || fputs(" }", fp) == EOF)
+			WT_ERR(__wt_errno());
+		first = 0;
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+	WT_ERR(__wt_fprintf(fp, "%s    ]\n}\n", first ? "" : "\n"));
+
+err:
+	WT_TRET(__wt_fclose(&fp, WT_FHANDLE_WRITE));
+	if (cursor != NULL)
+		WT_TRET(cursor->close(cursor));
+
+	return ret;
+}
+
+/*
+ * __json_load_header --
+ *	Read the dump file header up to the start of the data array, building
+ * the configuration needed to create the object.
+ */
+static int __json_load_header(WT_SESSION_IMPL* session, FILE* fp, WT_ITEM* line, WT_ITEM* config)
+{
+	size_t namelen, toklen;
+	int tok;
+	const char *name, *p, *tokstart;
+
+	WT_RET(__wt_buf_init(session, config, 0));
+
+	for (;;) {
+		WT_RET(__wt_getline(session, line, fp));
+		if (line->size == 0)
+			WT_RET_MSG(session, EINVAL, "JSON load: no data found");
+
+		/*"name" : "value"һе'{'*/
+		p = line->data;
+		WT_RET(__wt_json_token((WT_SESSION *)session, p, &tok, &tokstart, &toklen));
+		if (tok == '{')
+			continue;
+		if (tok != 's')
+			WT_RET_MSG(session, EINVAL, "JSON load: unexpected header line: %s", (const char *)line->data);
+
+		name = tokstart + 1;
+		namelen = toklen - 2;
+		if (WT_STRING_MATCH("data", name, namelen))
+			return (0);
+
+		p = tokstart + toklen;
+		WT_RET(__wt_json_token((WT_SESSION *)session, p, &tok, &tokstart, &toklen));
+		if (tok == ':') {
+			p = tokstart + toklen;
+			WT_RET(__wt_json_token((WT_SESSION *)session, p, &tok, &tokstart, &toklen));
+		}
+		if (tok != 's')
+			WT_RET_MSG(session, EINVAL, "JSON load: unexpected header line: %s", (const char *)line->data);
+
+		if (WT_STRING_MATCH("key_format", name, namelen) || WT_STRING_MATCH("value_format", name, namelen))
+			WT_RET(__wt_buf_catfmt(session, config, "%.*s=%.*s,", (int)namelen, name, (int)toklen - 2, tokstart + 1));
+		else if (WT_STRING_MATCH("columns", name, namelen))
+			WT_RET(__wt_buf_catfmt(session, config, "columns=(%.*s),", (int)toklen - 2, tokstart + 1));
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __json_load_split --
+ *	Split a record line in place into the key and value JSON strings, the
+ * first nkey columns belong to the key.  Record number keys are reduced to
+ * the number itself, that's what the dump cursor expects.  Returns NULL keys
+ * at the end of the data array.
+ */
+static int __json_load_split(WT_SESSION_IMPL* session, char* line, u_int nkey, int recno, char** keyp, char** valuep)
+{
+	size_t toklen;
+	int tok;
+	u_int cols;
+	const char *p, *tokstart;
+	char *key, *value;
+
+	*keyp = *valuep = NULL;
+
+	WT_RET(__wt_json_token((WT_SESSION *)session, line, &tok, &tokstart, &toklen));
+	if (tok == ']' || tok == 0)
+		return (0);
+	if (tok != '{')
+		WT_RET_MSG(session, EINVAL, "JSON load: expected a record, got %s", __wt_json_tokname(tok));
+
+	/*жǱ','еķָ*/
+	key = (char *)tokstart + toklen;
+	value = NULL;
+	for (p = key, cols = 0;; p = tokstart + toklen) {
+		WT_RET(__wt_json_token((WT_SESSION *)session, p, &tok, &tokstart, &toklen));
+		if (tok == 0 || tok == '{' || tok == '[')
+			WT_RET_MSG(session, EINVAL, "JSON load: malformed record: %s", line);
+		if (tok == '}') {
+			*(char *)tokstart = '\0';
+			break;
+		}
+		if (tok == ',' && ++cols == nkey && value == NULL) {
+			*(char *)tokstart = '\0';
+			value = (char *)tokstart + 1;
+		}
+	}
+	if (value == NULL)
+		WT_RET_MSG(session, EINVAL, "JSON load: record has no value: %s", line);
+
+	if (recno) {
+		for (p = key;; p = tokstart + toklen) {
+			WT_RET(__wt_json_token((WT_SESSION *)session, p, &tok, &tokstart, &toklen));
+			if (tok == 'i')
+				break;
+			if (tok == 0)
+				WT_RET_MSG(session, EINVAL, "JSON load: record number expected: %s", key);
+		}
+		key = (char *)tokstart;
+		key[toklen] = '\0';
+	}
+
+	*keyp = key;
+	*valuep = value;
+	return (0);
+}
+
+/*
+ * __wt_session_load --
+ *	WT_SESSION::load, insert the records of a JSON dump file into an object.
+ * An object that is still empty is loaded through a bulk cursor.
+ */
+int __wt_session_load(WT_SESSION_IMPL* session, const char* uri, const char* filename, const char* cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(config);
+	WT_DECL_ITEM(line);
+	WT_DECL_PACK_VALUE(pv);
+	WT_DECL_RET;
+	WT_PACK pack;
+	FILE *fp;
+	u_int nkey;
+	int bulk;
+	const char *cur_cfg[] = { NULL, NULL, NULL };
+	char *key, *value;
+
+	cursor = NULL;
+	fp = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &config));
+	WT_ERR(__wt_scr_alloc(session, 0, &line));
+
+	WT_ERR(__wt_fopen(session, filename, WT_FHANDLE_READ, 0, &fp));
+	if (setvbuf(fp, NULL, _IOFBF, WT_JSON_STREAM_BUF) != 0)
+		WT_ERR(__wt_errno());
+
+	WT_ERR(__json_load_header(session, fp, line, config));
+
+	WT_ERR(__wt_config_gets(session, cfg, "create", &cval));
+	if (cval.val != 0) {
+		WT_WITH_SCHEMA_LOCK(session, WT_WITH_TABLE_LOCK(session, ret = __wt_schema_create(session, uri, config->data)));
+		WT_ERR(ret);
+	}
+
+	/*Ϊʱʹbulk cursor֧bulk߶Ϊʱ˻صͨinsert*/
+	bulk = 0;
+	cur_cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+	WT_ERR(__wt_config_gets(session, cfg, "bulk", &cval));
+	if (cval.val != 0) {
+		cur_cfg[1] = "dump=json,bulk";
+		ret = __wt_open_cursor(session, uri, NULL, cur_cfg, &cursor);
+		if (ret == EINVAL || ret == EBUSY || ret == ENOTSUP)
+			ret = 0;
+		else {
+			WT_ERR(ret);
+			bulk = 1;
+		}
+	}
+	if (!bulk) {
+		cur_cfg[1] = "dump=json,overwrite";
+		WT_ERR(__wt_open_cursor(session, uri, NULL, cur_cfg, &cursor));
+	}
+
+	WT_ERR(__pack_init(session, &pack, cursor->key_format));
+	for (nkey = 0; (ret = __pack_next(&pack, &pv)) == 0; ++nkey)
+		;
+	WT_ERR_NOTFOUND_OK(ret);
+
+	for (;;) {
+		WT_ERR(__wt_getline(session, line, fp));
+		if (line->size == 0)
+			break;
+
+		WT_ERR(__json_load_split(session, line->mem, nkey, WT_CURSOR_RECNO(cursor), &key, &value));
+		if (key == NULL)
+			break;
+
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, value);
+		WT_ERR(cursor->insert(cursor));
+	}
+
+err:
+	if (cursor != NULL)
+		WT_TRET(cursor->close(cursor));
+	WT_TRET(__wt_fclose(&fp, WT_FHANDLE_READ));
+	__wt_scr_free(session, &config);
+	__wt_scr_free(session, &line);
+
+	return ret;
+}
@@ -3,29 +3,125 @@
 
 static int __session_dhandle_sweep(WT_SESSION_IMPL* session);
 
+/*hashsession dhandleеʼλ*/
+#define	WT_SESSION_DHTABLE_SLOT(s, hash)	((uint32_t)(hash) & ((s)->dhtable_size - 1))
 
-/*Ϊsessionһdhandle cache*/
-static int __session_add_dhandle(WT_SESSION_IMPL* session, WT_DATA_HANDLE_CACHE **dhandle_cachep)
+/*dhandle cache뵽ѰַУ֤߱пղ*/
+static void __session_dhtable_insert(WT_SESSION_IMPL* session, WT_DATA_HANDLE_CACHE* dhandle_cache)
 {
+	uint32_t slot;
+
+	for (slot = WT_SESSION_DHTABLE_SLOT(session, dhandle_cache->name_hash); session->dhtable[slot] != NULL; slot = (slot + 1) & (session->dhtable_size - 1))
+		;
+	session->dhtable[slot] = dhandle_cache;
+}
+
+/*ʳһʱһ֤̽ĳȺܶ*/
+static int __session_dhtable_grow(WT_SESSION_IMPL* session)
+{
+	WT_DATA_HANDLE_CACHE **old, *dhandle_cache;
+	uint32_t i, old_size;
+
+	if ((session->dhtable_cnt + 1) * 2 <= session->dhtable_size)
+		return 0;
+
+	old = session->dhtable;
+	old_size = session->dhtable_size;
+	WT_RET(__wt_calloc_def(session, old_size * 2, &session->dhtable));
+	session->dhtable_size = old_size * 2;
+
+	for (i = 0; i < old_size; ++i)
+		if ((dhandle_cache = old[i]) != NULL)
+			__session_dhtable_insert(session, dhandle_cache);
+
+	__wt_free(session, old);
+	return 0;
+}
+
+/*
+ * __session_dhtable_remove --
+ *	Remove an entry from the session's handle table.  Linear probing with
+ * backward shift deletion: entries after the hole move back unless their home
+ * slot lies between the hole and their current slot, so no tombstones are
+ * needed.
+ */
+static void __session_dhtable_remove(WT_SESSION_IMPL* session, WT_DATA_HANDLE_CACHE* dhandle_cache)
+{
+	uint32_t hole, home, mask, slot;
+
+	mask = session->dhtable_size - 1;
+	for (hole = WT_SESSION_DHTABLE_SLOT(session, dhandle_cache->name_hash); session->dhtable[hole] != dhandle_cache; hole = (hole + 1) & mask)
+		;
+
+	for (slot = hole;;) {
+		session->dhtable[hole] = NULL;
+		for (;;) {
+			slot = (slot + 1) & mask;
+			if (session->dhtable[slot] == NULL)
+				return;
+
+			/*ʼλ(hole, slot]֮ƶ*/
+			home = WT_SESSION_DHTABLE_SLOT(session, session->dhtable[slot]->name_hash);
+			if (hole <= slot ? (hole < home && home <= slot) : (hole < home || home <= slot))
+				continue;
+			break;
+		}
+		session->dhtable[hole] = session->dhtable[slot];
+		hole = slot;
+	}
+}
+
+/*sessiondhandleвnamecheckpointӦdhandle cache*/
+static WT_DATA_HANDLE_CACHE* __session_dhtable_find(WT_SESSION_IMPL* session, const char* uri, const char* checkpoint, uint64_t hash)
+{
+	WT_DATA_HANDLE *dhandle;
 	WT_DATA_HANDLE_CACHE *dhandle_cache;
-	uint64_t bucket;
+	uint32_t slot;
+
+	for (slot = WT_SESSION_DHTABLE_SLOT(session, hash); (dhandle_cache = session->dhtable[slot]) != NULL; slot = (slot + 1) & (session->dhtable_size - 1)) {
+		if (dhandle_cache->name_hash != hash)
+			continue;
+		dhandle = dhandle_cache->dhandle;
+		if (strcmp(uri, dhandle->name) != 0)
+			continue;
+		if (checkpoint == NULL && dhandle->checkpoint == NULL)
+			return dhandle_cache;
+		if (checkpoint != NULL && dhandle->checkpoint != NULL && strcmp(checkpoint, dhandle->checkpoint) == 0)
+			return dhandle_cache;
+	}
+
+	return NULL;
+}
+
+/*Ϊsessionһdhandle cache, have_refΪ0ʾѾdhandlesession_ref*/
+static int __session_add_dhandle(WT_SESSION_IMPL* session, int have_ref)
+{
+	WT_DATA_HANDLE_CACHE *dhandle_cache;
+	WT_DECL_RET;
+
+	dhandle_cache = NULL;
 
 	/*һdhandle cache*/
-	WT_RET(__wt_calloc_one(session, &dhandle_cache));
+	WT_ERR(__session_dhtable_grow(session));
+	WT_ERR(__wt_calloc_one(session, &dhandle_cache));
 	dhandle_cache->dhandle = session->dhandle;
+	dhandle_cache->name_hash = session->dhandle->name_hash;
 
-	/*cache뵽session cache list*/
-	bucket = dhandle_cache->dhandle->name_hash % WT_HASH_ARRAY_SIZE;
+	/*cache뵽session cache listhash*/
 	SLIST_INSERT_HEAD(&session->dhandles, dhandle_cache, l);
-	SLIST_INSERT_HEAD(&session->dhhash[bucket], dhandle_cache, hashl);
-
-	if(dhandle_cachep != NULL)
-		*dhandle_cachep = dhandle_cache;
+	__session_dhtable_insert(session, dhandle_cache);
+	++session->dhtable_cnt;
 
-	WT_ATOMIC_ADD4(session->dhandle->session_ref, 1);
+	if (!have_ref)
+		WT_ATOMIC_ADD4(session->dhandle->session_ref, 1);
 
 	/*ɾѾرջ߲õdhandle*/
 	return __session_dhandle_sweep(session);
+
+err:
+	if (have_ref)
+		(void)WT_ATOMIC_SUB4(session->dhandle->session_ref, 1);
+	return ret;
 }
 
 /*Իsessionǰdhandlelock*/
@@ -192,11 +288,9 @@ retry:
 /*dhandle_cachesessioncacheɾͷdhandle_cache*/
 static void __session_discard_btree(WT_SESSION_IMPL* session, WT_DATA_HANDLE_CACHE* dhandle_cache)
 {
-	uint64_t bucket;
-
-	bucket = dhandle_cache->dhandle->name_hash % WT_HASH_ARRAY_SIZE;
 	SLIST_REMOVE(&session->dhandles, dhandle_cache, __wt_data_handle_cache, l);
-	SLIST_REMOVE(&session->dhhash[bucket],dhandle_cache, __wt_data_handle_cache, hashl);
+	__session_dhtable_remove(session, dhandle_cache);
+	--session->dhtable_cnt;
 
 	(void)WT_ATOMIC_SUB4(dhandle_cache->dhandle->session_ref, 1);
 
@@ -246,20 +340,13 @@ WT_CONNECTION_IMPL *conn;
 	return 0;
 }
 
-/*dhandle namecheckpoint nameҵӦdhandle,dhandle뵽dhandle cache*/
-static int __session_dhandle_find(WT_SESSION_IMPL* session, const char* uri, const char* checkpoint, uint32_t flags)
-{
-	WT_RET(__wt_conn_dhandle_find(session, uri, checkpoint, flags));
-	return __session_add_dhandle(session, NULL);
-}
-
 /*ͨdhandle namecheckpoint nameҵӦdhandebtree file,btree*/
 int __wt_session_get_btree(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint, const char *cfg[], uint32_t flags)
 {
 	WT_DATA_HANDLE *dhandle;
 	WT_DATA_HANDLE_CACHE *dhandle_cache;
 	WT_DECL_RET;
-	uint64_t bucket;
+	uint64_t hash;
 
 	WT_ASSERT(session, !F_ISSET(session, WT_SESSION_NO_DATA_HANDLES));
 	WT_ASSERT(session, !LF_ISSET(WT_DHANDLE_HAVE_REF));
@@ -267,27 +354,23 @@ int __wt_session_get_btree(WT_SESSION_IMPL *session, const char *uri, const char
 	dhandle = NULL;
 
 	/*dhandle cacheв*/
-	bucket = __wt_hash_city64(uri, strlen(uri)) % WT_HASH_ARRAY_SIZE;
-	SLIST_FOREACH(dhandle_cache, &session->dhhash[bucket], hashl) {
-		dhandle = dhandle_cache->dhandle;
-		if (strcmp(uri, dhandle->name) != 0)
-			continue;
-		if (checkpoint == NULL && dhandle->checkpoint == NULL)
-			break;
-		if (checkpoint != NULL && dhandle->checkpoint != NULL && strcmp(checkpoint, dhandle->checkpoint) == 0)
-			break;
-	}
-
-	if(dhandle_cache != NULL)
-		session->dhandle = dhandle;
+	hash = __wt_hash_city64(uri, strlen(uri));
+	if ((dhandle_cache = __session_dhtable_find(session, uri, checkpoint, hash)) != NULL)
+		session->dhandle = dhandle = dhandle_cache->dhandle;
 	else{
 		/*
 		 * We didn't find a match in the session cache, now search the
-		 * shared handle list and cache any handle we find.
+		 * shared handle hash without the handle list lock and cache any
+		 * handle we find.  Handles not found here (including handles
+		 * being discarded) are found or created under the locks below.
 		 */
-		WT_WITH_DHANDLE_LOCK(session, ret = __session_dhandle_find(session, uri, checkpoint, flags));
-		dhandle = (ret == 0) ? session->dhandle : NULL;
+		ret = __wt_conn_dhandle_find_ref(session, uri, checkpoint, hash);
+		if (ret == 0) {
+			WT_RET(__session_add_dhandle(session, 1));
+			dhandle = session->dhandle;
+		}
 		WT_RET_NOTFOUND_OK(ret);
+		ret = 0;
 	}
 
 	if (dhandle != NULL) {
@@ -324,7 +407,7 @@ int __wt_session_get_btree(WT_SESSION_IMPL *session, const char *uri, const char
 
 	/*__wt_conn_btree_getл½dhandle,½ģô뽫dhandle뵽dhandle cache*/
 	if (!LF_ISSET(WT_DHANDLE_HAVE_REF))
-		WT_RET(__session_add_dhandle(session, NULL));
+		WT_RET(__session_add_dhandle(session, 0));
 
 	WT_ASSERT(session, LF_ISSET(WT_DHANDLE_LOCK_ONLY) || F_ISSET(session->dhandle, WT_DHANDLE_OPEN));
 
@@ -37,9 +37,21 @@ int __wt_hazard_set(WT_SESSION_IMPL* session, WT_REF* ref, int* busyp)
 		if (hp->page != NULL)
 			continue;
 
+		/*ȷhazard_inuse֤evictionɨʱܿλ*/
+		if ((uint32_t)(hp - session->hazard) >= session->hazard_inuse)
+			WT_PUBLISH(session->hazard_inuse, (uint32_t)(hp - session->hazard) + 1);
+
 		hp->page = ref->page;
-		/*õhazard pointerڴΪдЧִֹڴϺĴ*/
-		WT_FULL_BARRIER();
+		/*
+		 * Publish the hazard pointer before reading the ref state.  Inside
+		 * a hazard epoch, eviction waits for this session to leave the
+		 * epoch before checking hazard pointers, and entering the epoch
+		 * was already a full barrier, a compiler barrier is enough.
+		 */
+		if (session->hazard_gen != 0)
+			WT_BARRIER();
+		else
+			WT_FULL_BARRIER();
 
 		/*пܶ߳ͬʱִhp->page = ref->page ʱ̰ܳ߳page ڴ棬ʱӦ÷hazard pointerһæ״̬еȴ*/
 		if (ref->page == hp->page && ref->state == WT_REF_MEM) {
@@ -71,7 +83,9 @@ int __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page)
 		if (hp->page == page){
 			/*طҪڴ֤Ϊhp->pageNULLḶ́Ҫ֤ȫȷ*/
 			hp->page = NULL;
-			--session->nhazard; /*ֵڻ᲻ָأ*/
+			/*ûhazard pointerʱСevictionɨ跶Χ*/
+			if (--session->nhazard == 0) /*ֵڻ᲻ָأ*/
+				session->hazard_inuse = 0;
 			return 0;
 		}
 	}
@@ -105,6 +119,8 @@ void __wt_hazard_close(WT_SESSION_IMPL* session)
 		}
 	}
 
+	session->hazard_inuse = 0;
+
 	if (session->nhazard != 0)
 		__wt_errx(session, "session %p: close hazard pointer table: count didn't match entries",session);
 }
@@ -112,3 +128,49 @@ void __wt_hazard_close(WT_SESSION_IMPL* session)
 
 
 
+
+/*سǰsession֮⣬Ȼhazard epochеsessionСepoch*/
+static uint64_t __hazard_oldest_gen(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *s;
+	uint64_t gen, oldest;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = 0, s = conn->sessions, oldest = conn->hazard_gen + 1; i < session_cnt; i++, s++) {
+		if (s == session)
+			continue;
+		WT_ORDERED_READ(gen, s->hazard_gen);
+		if (gen != 0 && gen < oldest)
+			oldest = gen;
+	}
+
+	return oldest;
+}
+
+/*
+ * __wt_hazard_gen_wait --
+ *	Called by eviction with the page's ref locked: start a new hazard epoch
+ * and wait for the sessions in older epochs to leave them.  After that, every
+ * hazard pointer set to the page is visible to the hazard pointer check, and
+ * no session still in an operation can see the ref in the WT_REF_MEM state.
+ * Returns EBUSY if the sessions don't move on quickly.
+ */
+int __wt_hazard_gen_wait(WT_SESSION_IMPL* session)
+{
+	uint64_t gen;
+	u_int spins;
+
+	gen = WT_ATOMIC_ADD8(S2C(session)->hazard_gen, 1);
+
+	/*sessionĲ̣ܶȴһСʱ䣬Ȳͷpage*/
+	for (spins = 0; __hazard_oldest_gen(session) < gen; ++spins) {
+		if (spins >= WT_HAZARD_GEN_SPINS)
+			return EBUSY;
+		__wt_yield();
+	}
+
+	return 0;
+}
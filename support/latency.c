@@ -0,0 +1,214 @@
+/**************************************************************************
+*ȵ·ӳֱͼͳ, ÿsession¼Լֱͼȡͳʱ
+**************************************************************************/
+
+#include "wt_internal.h"
+
+/*ƣWT_LATENCY_*±һһӦ*/
+static const char * const __latency_names[WT_LATENCY_OPS] = {
+	"block write",
+	"cache read",
+	"cache full wait",
+	"cursor insert",
+	"cursor remove",
+	"cursor search",
+	"cursor update",
+	"page eviction",
+	"log slot wait",
+	"log sync"
+};
+
+/*usecsֱͼͰ, СWT_LATENCY_SUBֵÿֵһͰ֮ÿ2ݴηֳWT_LATENCY_SUBͰ*/
+static u_int __latency_bucket(uint64_t usecs)
+{
+	uint32_t bit, v;
+
+	if (usecs < WT_LATENCY_SUB)
+		return ((u_int)usecs);
+
+	/*ΧֵһͰ*/
+	if (usecs >= ((uint64_t)1 << WT_LATENCY_GROUPS))
+		return (WT_LATENCY_BUCKETS - 1);
+
+	v = (uint32_t)usecs;
+	bit = __wt_log2_int(v);
+	return ((u_int)((bit - WT_LATENCY_SUB_BITS + 1) * WT_LATENCY_SUB + ((v >> (bit - WT_LATENCY_SUB_BITS)) & (WT_LATENCY_SUB - 1))));
+}
+
+/*һֱͼͰǵֵ(usecs)*/
+static uint64_t __latency_bucket_max(u_int bucket)
+{
+	u_int shift, sub;
+
+	if (bucket < WT_LATENCY_SUB)
+		return (bucket);
+
+	shift = bucket / WT_LATENCY_SUB - 1;
+	sub = bucket % WT_LATENCY_SUB;
+	return ((((uint64_t)(WT_LATENCY_SUB + sub + 1)) << shift) - 1);
+}
+
+/*һֱͼͰǵСֵ(usecs)*/
+static uint64_t __latency_bucket_min(u_int bucket)
+{
+	if (bucket < WT_LATENCY_SUB)
+		return (bucket);
+
+	return (((uint64_t)(WT_LATENCY_SUB + bucket % WT_LATENCY_SUB)) << (bucket / WT_LATENCY_SUB - 1));
+}
+
+/*
+ * __latency_percentile --
+ *	Return the upper bound of the bucket holding the given per-mille rank,
+ * clamped to the largest value seen.
+ */
+static uint64_t __latency_percentile(WT_LATENCY_HIST* hist, uint64_t permille)
+{
+	uint64_t rank, seen, v;
+	u_int i;
+
+	if (hist->count == 0)
+		return (0);
+
+	/*ȡ֤p99.9ʱҲǲֲ*/
+	rank = (hist->count * permille + 999) / 1000;
+	for (i = 0, seen = 0; i < WT_LATENCY_BUCKETS; ++i) {
+		seen += hist->bucket[i];
+		if (seen >= rank)
+			break;
+	}
+	if (i == WT_LATENCY_BUCKETS)
+		return (hist->max);
+
+	v = __latency_bucket_max(i);
+	return (v > hist->max ? hist->max : v);
+}
+
+/*¼һβӳ٣ֻsessionԼ̵߳ãҪԭӲ*/
+void __wt_latency_record(WT_SESSION_IMPL* session, u_int op, struct timespec* start)
+{
+	WT_LATENCY_HIST *hist;
+	struct timespec stop;
+	uint64_t usecs;
+
+	if (__wt_epoch(session, &stop) != 0)
+		return;
+
+	/*ϵͳʱӻزʱμ¼*/
+	if (stop.tv_sec < start->tv_sec || (stop.tv_sec == start->tv_sec && stop.tv_nsec < start->tv_nsec))
+		return;
+
+	usecs = WT_TIMEDIFF(stop, *start) / 1000;
+
+	hist = &session->latency[op];
+	++hist->count;
+	hist->total += usecs;
+	if (usecs > hist->max)
+		hist->max = usecs;
+	++hist->bucket[__latency_bucket(usecs)];
+}
+
+/*
+ * __wt_latency_aggregate --
+ *	Sum the histograms of every session in the connection.  The session
+ * owners keep writing while we read, the result is a snapshot that may be
+ * off by the operations recorded during the walk.
+ */
+void __wt_latency_aggregate(WT_SESSION_IMPL* session, WT_LATENCY_HIST* hist)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LATENCY_HIST *src;
+	WT_SESSION_IMPL *s;
+	uint32_t i, session_cnt;
+	u_int b, op;
+
+	conn = S2C(session);
+	memset(hist, 0, sizeof(WT_LATENCY_HIST) * WT_LATENCY_OPS);
+
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
+		for (op = 0; op < WT_LATENCY_OPS; ++op) {
+			src = &s->latency[op];
+			if (src->count == 0)
+				continue;
+
+			hist[op].count += src->count;
+			hist[op].total += src->total;
+			if (src->max > hist[op].max)
+				hist[op].max = src->max;
+			for (b = 0; b < WT_LATENCY_BUCKETS; ++b)
+				hist[op].bucket[b] += src->bucket[b];
+		}
+	}
+}
+
+/*sessionֱͼͳһܶʧڼ¼*/
+void __wt_latency_clear(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *s;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i)
+		memset(s->latency, 0, sizeof(s->latency));
+}
+
+#define	WT_LATENCY_STAT_SET(stats, hist, op, name) do {				\
+	WT_STAT_SET(stats, latency_##name##_p50, __latency_percentile(&(hist)[op], 500));	\
+	WT_STAT_SET(stats, latency_##name##_p99, __latency_percentile(&(hist)[op], 990));	\
+	WT_STAT_SET(stats, latency_##name##_p999, __latency_percentile(&(hist)[op], 999));	\
+	WT_STAT_SET(stats, latency_##name##_max, (hist)[op].max);		\
+} while (0)
+
+/*sessionӳֱͼٷλõconnectionͳ*/
+void __wt_latency_stats_update(WT_SESSION_IMPL* session)
+{
+	WT_CONNECTION_STATS *stats;
+	WT_LATENCY_HIST hist[WT_LATENCY_OPS];
+
+	stats = &S2C(session)->stats;
+
+	__wt_latency_aggregate(session, hist);
+
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_BLOCK_WRITE, block_write);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_CACHE_READ, cache_read);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_CACHE_WAIT, cache_wait);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_CURSOR_INSERT, cursor_insert);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_CURSOR_REMOVE, cursor_remove);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_CURSOR_SEARCH, cursor_search);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_CURSOR_UPDATE, cursor_update);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_EVICT_PAGE, evict_page);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_LOG_SLOT_WAIT, log_slot_wait);
+	WT_LATENCY_STAT_SET(stats, hist, WT_LATENCY_LOG_SYNC, log_sync);
+}
+
+/*
+ * __wt_latency_statlog --
+ *	Write the non-empty buckets of every histogram to the statistics log,
+ * one line per bucket, so the full distribution can be rebuilt offline.
+ */
+int __wt_latency_statlog(WT_SESSION_IMPL* session, FILE* fp, const char* stamp, const char* name)
+{
+	WT_LATENCY_HIST hist[WT_LATENCY_OPS];
+	u_int b, op;
+
+	__wt_latency_aggregate(session, hist);
+
+	for (op = 0; op < WT_LATENCY_OPS; ++op) {
+		if (hist[op].count == 0)
+			continue;
+
+		for (b = 0; b < WT_LATENCY_BUCKETS; ++b) {
+			if (hist[op].bucket[b] == 0)
+				continue;
+
+			WT_RET(__wt_fprintf(fp, "%s %" PRIu64 " %s latency: %s histogram %" PRIu64 "-%" PRIu64 " (usecs)\n",
+				stamp, hist[op].bucket[b], name, __latency_names[op], __latency_bucket_min(b), __latency_bucket_max(b)));
+		}
+	}
+
+	return (0);
+}
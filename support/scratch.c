@@ -21,7 +21,9 @@ int __wt_buf_grow_worker(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
 
 	/*ڴط*/
 	if(size > buf->memsize){
-		if (F_ISSET(buf, WT_ITEM_ALIGNED))
+		if (F_ISSET(buf, WT_ITEM_CACHE)) /*page image, cachehuge pageڴз*/
+			WT_RET(__wt_cache_mem_realloc(session, &buf->memsize, size, F_ISSET(buf, WT_ITEM_ALIGNED) ? 1 : 0, &buf->mem));
+		else if (F_ISSET(buf, WT_ITEM_ALIGNED))
 			WT_RET(__wt_realloc_aligned(session, &buf->memsize, size, &buf->mem));
 		else
 			WT_RET(__wt_realloc(session, &buf->memsize, size, &buf->mem));
@@ -179,12 +181,80 @@ err:
 	WT_RET_MSG(session, ret, "session unable to allocate a scratch buffer");
 }
 
+/*
+ * __wt_io_buf_get --
+ *	Take an aligned block I/O buffer from the session's pool, allocating a
+ * new one when the pool is empty.  The largest pooled buffer is returned, it
+ * almost always fits the next block without growing.
+ */
+int __wt_io_buf_get(WT_SESSION_IMPL* session, WT_ITEM** bufp)
+{
+	WT_ITEM **best;
+	u_int i;
+
+	*bufp = NULL;
+
+	for (best = NULL, i = 0; i < WT_SESSION_IO_BUFS; ++i)
+		if (session->io_bufs[i] != NULL && (best == NULL || session->io_bufs[i]->memsize > (*best)->memsize))
+			best = &session->io_bufs[i];
+
+	if (best != NULL) {
+		*bufp = *best;
+		*best = NULL;
+		return (0);
+	}
+
+	WT_RET(__wt_calloc_one(session, bufp));
+	F_SET(*bufp, WT_ITEM_ALIGNED);
+	return (0);
+}
+
+/*I/Osessionĳأʱ滻СĻ*/
+void __wt_io_buf_put(WT_SESSION_IMPL* session, WT_ITEM** bufp)
+{
+	WT_ITEM *buf, **slot;
+	u_int i;
+
+	if ((buf = *bufp) == NULL)
+		return;
+	*bufp = NULL;
+
+	buf->data = buf->mem;
+	buf->size = 0;
+
+	for (slot = NULL, i = 0; i < WT_SESSION_IO_BUFS; ++i) {
+		if (session->io_bufs[i] == NULL) {
+			slot = &session->io_bufs[i];
+			break;
+		}
+		if (slot == NULL || session->io_bufs[i]->memsize < (*slot)->memsize)
+			slot = &session->io_bufs[i];
+	}
+
+	if (*slot != NULL) {
+		if ((*slot)->memsize >= buf->memsize) {
+			__wt_buf_free(session, buf);
+			__wt_free(session, buf);
+			return;
+		}
+		__wt_buf_free(session, *slot);
+		__wt_free(session, *slot);
+	}
+	*slot = buf;
+}
+
 /*ͷsession->scratchwt_item*/
 void __wt_scr_discard(WT_SESSION_IMPL *session)
 {
 	WT_ITEM **bufp;
 	u_int i;
 
+	for (i = 0; i < WT_SESSION_IO_BUFS; ++i)
+		if (session->io_bufs[i] != NULL) {
+			__wt_buf_free(session, session->io_bufs[i]);
+			__wt_free(session, session->io_bufs[i]);
+		}
+
 	for (i = 0, bufp = session->scratch; i < session->scratch_alloc; ++i, ++bufp) {
 		if (*bufp == NULL)
 			continue;
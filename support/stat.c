@@ -21,8 +21,12 @@ void
 	stats->block_major.desc = "block-manager: file major version number";
 	stats->block_size.desc = "block-manager: file size in bytes";
 	stats->block_minor.desc = "block-manager: minor version number";
+	stats->btree_ahi_hit.desc = "btree: adaptive hash index hits";
+	stats->btree_ahi_miss.desc = "btree: adaptive hash index misses";
 	stats->btree_checkpoint_generation.desc =
 		"btree: btree checkpoint generation";
+	stats->btree_count_subtree_skip.desc =
+		"btree: count_range subtrees counted without reading";
 	stats->btree_column_fix.desc =
 		"btree: column-store fixed-size leaf pages";
 	stats->btree_column_internal.desc =
@@ -44,6 +48,32 @@ void
 		"btree: pages rewritten by compaction";
 	stats->btree_row_internal.desc = "btree: row-store internal pages";
 	stats->btree_row_leaf.desc = "btree: row-store leaf pages";
+	stats->btree_sample_entries.desc =
+		"btree: sampled statistics: records sampled";
+	stats->btree_sample_key_gt1k.desc =
+		"btree: sampled statistics: keys larger than 1KB";
+	stats->btree_sample_key_le16.desc =
+		"btree: sampled statistics: keys up to 16B";
+	stats->btree_sample_key_le1k.desc =
+		"btree: sampled statistics: keys up to 1KB";
+	stats->btree_sample_key_le256.desc =
+		"btree: sampled statistics: keys up to 256B";
+	stats->btree_sample_key_le64.desc =
+		"btree: sampled statistics: keys up to 64B";
+	stats->btree_sample_prefix_distinct.desc =
+		"btree: sampled statistics: estimated distinct key prefixes";
+	stats->btree_sample_records.desc =
+		"btree: sampled statistics: approximate row count";
+	stats->btree_sample_value_gt1k.desc =
+		"btree: sampled statistics: values larger than 1KB";
+	stats->btree_sample_value_le16.desc =
+		"btree: sampled statistics: values up to 16B";
+	stats->btree_sample_value_le1k.desc =
+		"btree: sampled statistics: values up to 1KB";
+	stats->btree_sample_value_le256.desc =
+		"btree: sampled statistics: values up to 256B";
+	stats->btree_sample_value_le64.desc =
+		"btree: sampled statistics: values up to 64B";
 	stats->cache_bytes_read.desc = "cache: bytes read into cache";
 	stats->cache_bytes_write.desc = "cache: bytes written from cache";
 	stats->cache_eviction_checkpoint.desc =
@@ -88,6 +118,10 @@ void
 	stats->cursor_update_bytes.desc =
 		"cursor: cursor-update value bytes updated";
 	stats->cursor_insert.desc = "cursor: insert calls";
+	stats->cursor_batch_leaf_reuse.desc =
+	    "cursor: batch keys found on the previous leaf page";
+	stats->cursor_batch_prefetch.desc =
+	    "cursor: batch leaf pages prefetched";
 	stats->cursor_next.desc = "cursor: next calls";
 	stats->cursor_prev.desc = "cursor: prev calls";
 	stats->cursor_remove.desc = "cursor: remove calls";
@@ -106,12 +140,22 @@ void
 	stats->lsm_chunk_count.desc = "LSM: chunks in the LSM tree";
 	stats->lsm_generation_max.desc =
 		"LSM: highest merge generation in the LSM tree";
+	stats->lsm_lookup_range_deleted.desc =
+		"LSM: queries ended by a range tombstone";
 	stats->lsm_lookup_no_bloom.desc =
 		"LSM: queries that could have benefited from a Bloom filter that did not exist";
 	stats->lsm_checkpoint_throttle.desc =
 		"LSM: sleep for LSM checkpoint throttle";
+	stats->lsm_range_tombstones.desc = "LSM: range tombstones written";
 	stats->lsm_merge_throttle.desc = "LSM: sleep for LSM merge throttle";
+	stats->lsm_space_amplification.desc =
+		"LSM: space amplification (percent)";
+	stats->lsm_throttle_debt.desc = "LSM: throttle debt (usecs)";
+	stats->lsm_throttle_rate.desc =
+		"LSM: throttled update rate (bytes per second)";
 	stats->bloom_size.desc = "LSM: total size of bloom filters";
+	stats->lsm_write_amplification.desc =
+		"LSM: write amplification (percent)";
 	stats->rec_dictionary.desc = "reconciliation: dictionary matches";
 	stats->rec_suffix_compression.desc =
 		"reconciliation: internal page key bytes discarded using suffix compression";
@@ -155,6 +199,9 @@ void
 	stats->block_major.v = 0;
 	stats->block_size.v = 0;
 	stats->block_minor.v = 0;
+	stats->btree_ahi_hit.v = 0;
+	stats->btree_ahi_miss.v = 0;
+	stats->btree_count_subtree_skip.v = 0;
 	stats->btree_column_fix.v = 0;
 	stats->btree_column_internal.v = 0;
 	stats->btree_column_deleted.v = 0;
@@ -171,6 +218,19 @@ void
 	stats->btree_compact_rewrite.v = 0;
 	stats->btree_row_internal.v = 0;
 	stats->btree_row_leaf.v = 0;
+	stats->btree_sample_entries.v = 0;
+	stats->btree_sample_key_gt1k.v = 0;
+	stats->btree_sample_key_le16.v = 0;
+	stats->btree_sample_key_le1k.v = 0;
+	stats->btree_sample_key_le256.v = 0;
+	stats->btree_sample_key_le64.v = 0;
+	stats->btree_sample_prefix_distinct.v = 0;
+	stats->btree_sample_records.v = 0;
+	stats->btree_sample_value_gt1k.v = 0;
+	stats->btree_sample_value_le16.v = 0;
+	stats->btree_sample_value_le1k.v = 0;
+	stats->btree_sample_value_le256.v = 0;
+	stats->btree_sample_value_le64.v = 0;
 	stats->cache_bytes_read.v = 0;
 	stats->cache_bytes_write.v = 0;
 	stats->cache_eviction_checkpoint.v = 0;
@@ -199,6 +259,8 @@ void
 	stats->cursor_remove_bytes.v = 0;
 	stats->cursor_update_bytes.v = 0;
 	stats->cursor_insert.v = 0;
+	stats->cursor_batch_leaf_reuse.v = 0;
+	stats->cursor_batch_prefetch.v = 0;
 	stats->cursor_next.v = 0;
 	stats->cursor_prev.v = 0;
 	stats->cursor_remove.v = 0;
@@ -214,10 +276,16 @@ void
 	stats->bloom_count.v = 0;
 	stats->lsm_chunk_count.v = 0;
 	stats->lsm_generation_max.v = 0;
+	stats->lsm_lookup_range_deleted.v = 0;
 	stats->lsm_lookup_no_bloom.v = 0;
 	stats->lsm_checkpoint_throttle.v = 0;
+	stats->lsm_range_tombstones.v = 0;
 	stats->lsm_merge_throttle.v = 0;
+	stats->lsm_space_amplification.v = 0;
+	stats->lsm_throttle_debt.v = 0;
+	stats->lsm_throttle_rate.v = 0;
 	stats->bloom_size.v = 0;
+	stats->lsm_write_amplification.v = 0;
 	stats->rec_dictionary.v = 0;
 	stats->rec_suffix_compression.v = 0;
 	stats->rec_multiblock_internal.v = 0;
@@ -248,7 +316,10 @@ void
 	p->block_checkpoint_size.v += c->block_checkpoint_size.v;
 	p->block_reuse_bytes.v += c->block_reuse_bytes.v;
 	p->block_size.v += c->block_size.v;
+	p->btree_ahi_hit.v += c->btree_ahi_hit.v;
+	p->btree_ahi_miss.v += c->btree_ahi_miss.v;
 	p->btree_checkpoint_generation.v += c->btree_checkpoint_generation.v;
+	p->btree_count_subtree_skip.v += c->btree_count_subtree_skip.v;
 	p->btree_column_fix.v += c->btree_column_fix.v;
 	p->btree_column_internal.v += c->btree_column_internal.v;
 	p->btree_column_deleted.v += c->btree_column_deleted.v;
@@ -270,6 +341,19 @@ void
 	p->btree_compact_rewrite.v += c->btree_compact_rewrite.v;
 	p->btree_row_internal.v += c->btree_row_internal.v;
 	p->btree_row_leaf.v += c->btree_row_leaf.v;
+	p->btree_sample_entries.v += c->btree_sample_entries.v;
+	p->btree_sample_key_gt1k.v += c->btree_sample_key_gt1k.v;
+	p->btree_sample_key_le16.v += c->btree_sample_key_le16.v;
+	p->btree_sample_key_le1k.v += c->btree_sample_key_le1k.v;
+	p->btree_sample_key_le256.v += c->btree_sample_key_le256.v;
+	p->btree_sample_key_le64.v += c->btree_sample_key_le64.v;
+	p->btree_sample_prefix_distinct.v += c->btree_sample_prefix_distinct.v;
+	p->btree_sample_records.v += c->btree_sample_records.v;
+	p->btree_sample_value_gt1k.v += c->btree_sample_value_gt1k.v;
+	p->btree_sample_value_le16.v += c->btree_sample_value_le16.v;
+	p->btree_sample_value_le1k.v += c->btree_sample_value_le1k.v;
+	p->btree_sample_value_le256.v += c->btree_sample_value_le256.v;
+	p->btree_sample_value_le64.v += c->btree_sample_value_le64.v;
 	p->cache_bytes_read.v += c->cache_bytes_read.v;
 	p->cache_bytes_write.v += c->cache_bytes_write.v;
 	p->cache_eviction_checkpoint.v += c->cache_eviction_checkpoint.v;
@@ -298,6 +382,8 @@ void
 	p->cursor_remove_bytes.v += c->cursor_remove_bytes.v;
 	p->cursor_update_bytes.v += c->cursor_update_bytes.v;
 	p->cursor_insert.v += c->cursor_insert.v;
+	p->cursor_batch_leaf_reuse.v += c->cursor_batch_leaf_reuse.v;
+	p->cursor_batch_prefetch.v += c->cursor_batch_prefetch.v;
 	p->cursor_next.v += c->cursor_next.v;
 	p->cursor_prev.v += c->cursor_prev.v;
 	p->cursor_remove.v += c->cursor_remove.v;
@@ -314,10 +400,19 @@ void
 	p->lsm_chunk_count.v += c->lsm_chunk_count.v;
 	if (c->lsm_generation_max.v > p->lsm_generation_max.v)
 		p->lsm_generation_max.v = c->lsm_generation_max.v;
+	p->lsm_lookup_range_deleted.v += c->lsm_lookup_range_deleted.v;
 	p->lsm_lookup_no_bloom.v += c->lsm_lookup_no_bloom.v;
 	p->lsm_checkpoint_throttle.v += c->lsm_checkpoint_throttle.v;
+	p->lsm_range_tombstones.v += c->lsm_range_tombstones.v;
 	p->lsm_merge_throttle.v += c->lsm_merge_throttle.v;
+	if (c->lsm_space_amplification.v > p->lsm_space_amplification.v)
+		p->lsm_space_amplification.v = c->lsm_space_amplification.v;
+	if (c->lsm_throttle_debt.v > p->lsm_throttle_debt.v)
+		p->lsm_throttle_debt.v = c->lsm_throttle_debt.v;
+	p->lsm_throttle_rate.v += c->lsm_throttle_rate.v;
 	p->bloom_size.v += c->bloom_size.v;
+	if (c->lsm_write_amplification.v > p->lsm_write_amplification.v)
+		p->lsm_write_amplification.v = c->lsm_write_amplification.v;
 	p->rec_dictionary.v += c->rec_dictionary.v;
 	p->rec_suffix_compression.v += c->rec_suffix_compression.v;
 	p->rec_multiblock_internal.v += c->rec_multiblock_internal.v;
@@ -386,14 +481,23 @@ void
 		"cache: eviction worker thread evicting pages";
 	stats->cache_eviction_force_fail.desc =
 		"cache: failed eviction of pages that exceeded the in-memory maximum";
+	stats->cache_eviction_hazard_epoch.desc =
+		"cache: hazard epoch blocked page eviction";
 	stats->cache_eviction_hazard.desc =
 		"cache: hazard pointer blocked page eviction";
+	stats->cache_hs_remove.desc =
+		"cache: history store records removed";
+	stats->cache_hs_insert.desc =
+		"cache: history store records written";
+	stats->cache_hs_search.desc = "cache: history store searches";
 	stats->cache_inmem_split.desc = "cache: in-memory page splits";
 	stats->cache_eviction_internal.desc = "cache: internal pages evicted";
 	stats->cache_bytes_max.desc = "cache: maximum bytes configured";
 	stats->cache_eviction_maximum_page_size.desc =
 		"cache: maximum page size at eviction";
 	stats->cache_eviction_dirty.desc = "cache: modified pages evicted";
+	stats->cache_update_gc.desc =
+		"cache: obsolete update chains trimmed by the eviction walk";
 	stats->cache_eviction_deepen.desc =
 		"cache: page split during eviction deepened the tree";
 	stats->cache_pages_inuse.desc =
@@ -404,13 +508,27 @@ void
 		"cache: pages evicted because they had chains of deleted items";
 	stats->cache_eviction_app.desc =
 		"cache: pages evicted by application threads";
+	stats->cache_eviction_hs.desc =
+		"cache: pages evicted with old versions moved to the history store";
+	stats->cache_eviction_promote.desc =
+		"cache: pages promoted to the hot eviction pool";
 	stats->cache_read.desc = "cache: pages read into cache";
+	stats->cache_read_scan.desc =
+		"cache: pages read into cache at low priority by cursor scans";
+	stats->cache_update_gc_pages.desc =
+		"cache: pages scanned for obsolete updates";
 	stats->cache_eviction_fail.desc =
 		"cache: pages selected for eviction unable to be evicted";
 	stats->cache_eviction_split.desc =
 		"cache: pages split during eviction";
 	stats->cache_eviction_walk.desc = "cache: pages walked for eviction";
 	stats->cache_write.desc = "cache: pages written from cache";
+	stats->cache_mem_slab_bytes.desc =
+		"cache: huge-page slab bytes allocated";
+	stats->cache_mem_fallback.desc =
+		"cache: huge-page slab allocations served by malloc";
+	stats->cache_mem_regions.desc =
+		"cache: huge-page slab regions in use";
 	stats->cache_overhead.desc = "cache: percentage overhead";
 	stats->cache_bytes_internal.desc =
 		"cache: tracked bytes belonging to internal pages in the cache";
@@ -444,6 +562,8 @@ void
 	stats->cursor_search.desc = "cursor: cursor search calls";
 	stats->cursor_search_near.desc = "cursor: cursor search near calls";
 	stats->cursor_update.desc = "cursor: cursor update calls";
+	stats->cursor_cache.desc = "cursor: cursors cached on close";
+	stats->cursor_reopen.desc = "cursor: cursors reopened from the cache";
 	stats->dh_conn_ref.desc =
 		"data-handle: connection candidate referenced";
 	stats->dh_conn_handles.desc = "data-handle: connection dhandles swept";
@@ -451,6 +571,85 @@ void
 	stats->dh_conn_tod.desc = "data-handle: connection time-of-death sets";
 	stats->dh_session_handles.desc = "data-handle: session dhandles swept";
 	stats->dh_session_sweeps.desc = "data-handle: session sweep attempts";
+	stats->latency_block_write_p50.desc =
+		"latency: block write 50th percentile (usecs)";
+	stats->latency_block_write_p999.desc =
+		"latency: block write 99.9th percentile (usecs)";
+	stats->latency_block_write_p99.desc =
+		"latency: block write 99th percentile (usecs)";
+	stats->latency_block_write_max.desc =
+		"latency: block write maximum (usecs)";
+	stats->latency_cache_wait_p50.desc =
+		"latency: cache full wait 50th percentile (usecs)";
+	stats->latency_cache_wait_p999.desc =
+		"latency: cache full wait 99.9th percentile (usecs)";
+	stats->latency_cache_wait_p99.desc =
+		"latency: cache full wait 99th percentile (usecs)";
+	stats->latency_cache_wait_max.desc =
+		"latency: cache full wait maximum (usecs)";
+	stats->latency_cache_read_p50.desc =
+		"latency: cache read 50th percentile (usecs)";
+	stats->latency_cache_read_p999.desc =
+		"latency: cache read 99.9th percentile (usecs)";
+	stats->latency_cache_read_p99.desc =
+		"latency: cache read 99th percentile (usecs)";
+	stats->latency_cache_read_max.desc =
+		"latency: cache read maximum (usecs)";
+	stats->latency_cursor_insert_p50.desc =
+		"latency: cursor insert 50th percentile (usecs)";
+	stats->latency_cursor_insert_p999.desc =
+		"latency: cursor insert 99.9th percentile (usecs)";
+	stats->latency_cursor_insert_p99.desc =
+		"latency: cursor insert 99th percentile (usecs)";
+	stats->latency_cursor_insert_max.desc =
+		"latency: cursor insert maximum (usecs)";
+	stats->latency_cursor_remove_p50.desc =
+		"latency: cursor remove 50th percentile (usecs)";
+	stats->latency_cursor_remove_p999.desc =
+		"latency: cursor remove 99.9th percentile (usecs)";
+	stats->latency_cursor_remove_p99.desc =
+		"latency: cursor remove 99th percentile (usecs)";
+	stats->latency_cursor_remove_max.desc =
+		"latency: cursor remove maximum (usecs)";
+	stats->latency_cursor_search_p50.desc =
+		"latency: cursor search 50th percentile (usecs)";
+	stats->latency_cursor_search_p999.desc =
+		"latency: cursor search 99.9th percentile (usecs)";
+	stats->latency_cursor_search_p99.desc =
+		"latency: cursor search 99th percentile (usecs)";
+	stats->latency_cursor_search_max.desc =
+		"latency: cursor search maximum (usecs)";
+	stats->latency_cursor_update_p50.desc =
+		"latency: cursor update 50th percentile (usecs)";
+	stats->latency_cursor_update_p999.desc =
+		"latency: cursor update 99.9th percentile (usecs)";
+	stats->latency_cursor_update_p99.desc =
+		"latency: cursor update 99th percentile (usecs)";
+	stats->latency_cursor_update_max.desc =
+		"latency: cursor update maximum (usecs)";
+	stats->latency_log_slot_wait_p50.desc =
+		"latency: log slot wait 50th percentile (usecs)";
+	stats->latency_log_slot_wait_p999.desc =
+		"latency: log slot wait 99.9th percentile (usecs)";
+	stats->latency_log_slot_wait_p99.desc =
+		"latency: log slot wait 99th percentile (usecs)";
+	stats->latency_log_slot_wait_max.desc =
+		"latency: log slot wait maximum (usecs)";
+	stats->latency_log_sync_p50.desc =
+		"latency: log sync 50th percentile (usecs)";
+	stats->latency_log_sync_p999.desc =
+		"latency: log sync 99.9th percentile (usecs)";
+	stats->latency_log_sync_p99.desc =
+		"latency: log sync 99th percentile (usecs)";
+	stats->latency_log_sync_max.desc = "latency: log sync maximum (usecs)";
+	stats->latency_evict_page_p50.desc =
+		"latency: page eviction 50th percentile (usecs)";
+	stats->latency_evict_page_p999.desc =
+		"latency: page eviction 99.9th percentile (usecs)";
+	stats->latency_evict_page_p99.desc =
+		"latency: page eviction 99th percentile (usecs)";
+	stats->latency_evict_page_max.desc =
+		"latency: page eviction maximum (usecs)";
 	stats->log_slot_closes.desc = "log: consolidated slot closures";
 	stats->log_slot_races.desc = "log: consolidated slot join races";
 	stats->log_slot_transitions.desc =
@@ -496,6 +695,10 @@ void
 		"log: yields waiting for previous log file close";
 	stats->lsm_work_queue_app.desc =
 		"LSM: application work units currently queued";
+	stats->lsm_flush_bandwidth.desc =
+		"LSM: measured chunk flush bandwidth (bytes per second)";
+	stats->lsm_merge_bandwidth.desc =
+		"LSM: measured merge bandwidth (bytes per second)";
 	stats->lsm_work_queue_manager.desc =
 		"LSM: merge work units currently queued";
 	stats->lsm_rows_merged.desc = "LSM: rows merged in an LSM tree";
@@ -511,6 +714,7 @@ void
 	stats->lsm_work_units_created.desc =
 		"LSM: tree maintenance operations scheduled";
 	stats->lsm_work_queue_max.desc = "LSM: tree queue hit maximum";
+	stats->lsm_throttle_trees.desc = "LSM: trees with throttled updates";
 	stats->rec_pages.desc = "reconciliation: page reconciliation calls";
 	stats->rec_pages_eviction.desc =
 		"reconciliation: page reconciliation calls for eviction";
@@ -589,15 +793,24 @@ void
 	stats->cache_eviction_slow.v = 0;
 	stats->cache_eviction_worker_evicting.v = 0;
 	stats->cache_eviction_force_fail.v = 0;
+	stats->cache_eviction_hazard_epoch.v = 0;
 	stats->cache_eviction_hazard.v = 0;
+	stats->cache_hs_remove.v = 0;
+	stats->cache_hs_insert.v = 0;
+	stats->cache_hs_search.v = 0;
 	stats->cache_inmem_split.v = 0;
 	stats->cache_eviction_internal.v = 0;
 	stats->cache_eviction_dirty.v = 0;
+	stats->cache_update_gc.v = 0;
 	stats->cache_eviction_deepen.v = 0;
 	stats->cache_eviction_force.v = 0;
 	stats->cache_eviction_force_delete.v = 0;
 	stats->cache_eviction_app.v = 0;
+	stats->cache_eviction_hs.v = 0;
+	stats->cache_eviction_promote.v = 0;
 	stats->cache_read.v = 0;
+	stats->cache_read_scan.v = 0;
+	stats->cache_update_gc_pages.v = 0;
 	stats->cache_eviction_fail.v = 0;
 	stats->cache_eviction_split.v = 0;
 	stats->cache_eviction_walk.v = 0;
@@ -620,6 +833,8 @@ void
 	stats->cursor_search.v = 0;
 	stats->cursor_search_near.v = 0;
 	stats->cursor_update.v = 0;
+	stats->cursor_cache.v = 0;
+	stats->cursor_reopen.v = 0;
 	stats->dh_conn_ref.v = 0;
 	stats->dh_conn_handles.v = 0;
 	stats->dh_conn_sweeps.v = 0;
@@ -0,0 +1,195 @@
+#include "wiredtiger.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*count_rangeposition_rankԣcursorĽȽ*/
+
+#define WT_CONFIG	"create,cache_size=100MB"
+#define TAB_URI		"table:count"
+#define TAB_META	"key_format=S,value_format=S,subtree_counts=true,leaf_page_max=4KB,internal_page_max=4KB"
+#define ROWS		20000
+
+/*keyǲʮַ˳ֵ˳һ*/
+static void make_key(char* buf, uint32_t id)
+{
+	sprintf(buf, "%010u", id);
+}
+
+/*˳򷵻keyֵ*/
+static uint32_t walk(WT_SESSION* session, uint32_t* ids)
+{
+	WT_CURSOR *cursor;
+	const char *key;
+	uint32_t n;
+	int ret;
+
+	assert(session->open_cursor(session, TAB_URI, NULL, NULL, &cursor) == 0);
+	for (n = 0; (ret = cursor->next(cursor)) == 0; n++) {
+		assert(cursor->get_key(cursor, &key) == 0);
+		ids[n] = (uint32_t)strtoul(key, NULL, 10);
+	}
+	assert(ret == WT_NOTFOUND);
+	assert(cursor->close(cursor) == 0);
+
+	return n;
+}
+
+/*lo/hiΪ-1ʾûһ˵ı߽*/
+static void check_range(WT_SESSION* session, const uint32_t* ids, uint32_t n, int64_t lo, int64_t hi)
+{
+	WT_CURSOR *start, *stop;
+	char lo_key[32], hi_key[32];
+	uint64_t count, expect;
+	uint32_t i;
+	int approximate;
+
+	expect = 0;
+	for (i = 0; i < n; i++)
+		if ((lo < 0 || ids[i] >= lo) && (hi < 0 || ids[i] <= hi))
+			expect++;
+
+	start = stop = NULL;
+	if (lo >= 0) {
+		assert(session->open_cursor(session, TAB_URI, NULL, NULL, &start) == 0);
+		make_key(lo_key, (uint32_t)lo);
+		start->set_key(start, lo_key);
+	}
+	if (hi >= 0) {
+		assert(session->open_cursor(session, TAB_URI, NULL, NULL, &stop) == 0);
+		make_key(hi_key, (uint32_t)hi);
+		stop->set_key(stop, hi_key);
+	}
+
+	/*̲߳ûδύ޸ģͳҲӦ׼ȷ*/
+	for (approximate = 0; approximate <= 1; approximate++) {
+		assert(session->count_range(session, start, stop, approximate ? "approximate=true" : NULL, &count) == 0);
+		if (count != expect) {
+			printf("count_range [%lld, %lld] approximate=%d: %llu rows, walk counted %llu\n",
+				(long long)lo, (long long)hi, approximate, (unsigned long long)count, (unsigned long long)expect);
+			abort();
+		}
+	}
+
+	if (start != NULL)
+		assert(start->close(start) == 0);
+	if (stop != NULL)
+		assert(stop->close(stop) == 0);
+}
+
+static void check_rank(WT_SESSION* session, const uint32_t* ids, uint32_t n)
+{
+	WT_CURSOR *cursor;
+	const char *key;
+	uint32_t ranks[6], i;
+	int approximate;
+
+	ranks[0] = 0;
+	ranks[1] = 1;
+	ranks[2] = n / 3;
+	ranks[3] = n / 2;
+	ranks[4] = n - 2;
+	ranks[5] = n - 1;
+
+	assert(session->open_cursor(session, TAB_URI, NULL, NULL, &cursor) == 0);
+	for (approximate = 0; approximate <= 1; approximate++) {
+		for (i = 0; i < sizeof(ranks) / sizeof(ranks[0]); i++) {
+			assert(session->position_rank(session, cursor, ranks[i], approximate ? "approximate=true" : NULL) == 0);
+			assert(cursor->get_key(cursor, &key) == 0);
+			if ((uint32_t)strtoul(key, NULL, 10) != ids[ranks[i]]) {
+				printf("position_rank %u approximate=%d: key %s, walk found %u\n", ranks[i], approximate, key, ids[ranks[i]]);
+				abort();
+			}
+		}
+
+		/*λcursorԼ*/
+		assert(session->position_rank(session, cursor, n / 2, NULL) == 0);
+		assert(cursor->next(cursor) == 0);
+		assert(cursor->get_key(cursor, &key) == 0);
+		assert((uint32_t)strtoul(key, NULL, 10) == ids[n / 2 + 1]);
+
+		assert(session->position_rank(session, cursor, n, approximate ? "approximate=true" : NULL) == WT_NOTFOUND);
+	}
+	assert(cursor->close(cursor) == 0);
+}
+
+static void check(WT_SESSION* session, const char* phase)
+{
+	uint32_t *ids, n;
+
+	ids = malloc(sizeof(uint32_t) * ROWS * 2);
+	assert(ids != NULL);
+	n = walk(session, ids);
+
+	check_range(session, ids, n, -1, 1000);
+	check_range(session, ids, n, 5000, -1);
+	check_range(session, ids, n, 123, ROWS * 2 - 123);
+	check_range(session, ids, n, 7777, 7778);
+	check_range(session, ids, n, 0, ROWS * 2);
+	check_range(session, ids, n, ROWS * 2, -1);
+	check_rank(session, ids, n);
+
+	printf("%s: %u rows, count_range and position_rank match the cursor walk\n", phase, n);
+	free(ids);
+}
+
+static void open_session(WT_CONNECTION** connp, WT_SESSION** sessionp)
+{
+	assert(wiredtiger_open("WT_HOME", NULL, WT_CONFIG, connp) == 0);
+	assert((*connp)->open_session(*connp, NULL, NULL, sessionp) == 0);
+}
+
+int main()
+{
+	WT_CONNECTION *conn;
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	char key[32];
+	uint32_t i;
+	int ret;
+
+	ret = system("rm -rf WT_HOME && mkdir WT_HOME");
+	open_session(&conn, &session);
+
+	assert(session->create(session, TAB_URI, TAB_META) == 0);
+	assert(session->open_cursor(session, TAB_URI, NULL, NULL, &cursor) == 0);
+	for (i = 0; i < ROWS; i++) {
+		make_key(key, i * 2);
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, "value");
+		assert(cursor->insert(cursor) == 0);
+	}
+	assert(cursor->close(cursor) == 0);
+	check(session, "in memory");
+
+	/*´򿪺Ҷpageڴϣinternal pageж*/
+	assert(session->checkpoint(session, NULL) == 0);
+	assert(conn->close(conn, NULL) == 0);
+	open_session(&conn, &session);
+	check(session, "on disk");
+
+	/*ɾһkeyٲһkey޸ĵpageʹϵĲͬ*/
+	assert(session->open_cursor(session, TAB_URI, NULL, NULL, &cursor) == 0);
+	for (i = 0; i < ROWS; i += 7) {
+		make_key(key, i * 2);
+		cursor->set_key(cursor, key);
+		assert(cursor->remove(cursor) == 0);
+	}
+	for (i = 0; i < ROWS; i += 5) {
+		make_key(key, i * 2 + 1);
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, "value");
+		assert(cursor->insert(cursor) == 0);
+	}
+	assert(cursor->close(cursor) == 0);
+	check(session, "modified");
+
+	assert(session->checkpoint(session, NULL) == 0);
+	assert(conn->close(conn, NULL) == 0);
+	open_session(&conn, &session);
+	check(session, "reconciled");
+
+	assert(conn->close(conn, NULL) == 0);
+	return ret == 0 ? 0 : 1;
+}
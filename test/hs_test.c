@@ -0,0 +1,189 @@
+#include "wiredtiger.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * history store: һsnapshotڼ䣬page޸Ĳ̭
+ * (ѾWT_PAGE_HSǵpageٴα̭)ȻԼsnapshot
+ * еİ汾ύsweephistory storeеļ¼
+ */
+
+/*cacheСдfiller԰hspagecache*/
+#define WT_CONFIG	"create,cache_size=10MB,statistics=(fast),file_manager=(close_scan_interval=1)"
+#define HS_URI		"table:hs"
+#define FILLER_URI	"table:filler"
+#define ROWS		5000
+#define FILLER_ROWS	40000
+
+static char pad[1001];
+
+static int64_t stat_get(WT_SESSION* session, const char* desc)
+{
+	WT_CURSOR *cursor;
+	const char *d, *pvalue;
+	int64_t value;
+	int ret;
+
+	assert(session->open_cursor(session, "statistics:", NULL, NULL, &cursor) == 0);
+	while ((ret = cursor->next(cursor)) == 0) {
+		assert(cursor->get_value(cursor, &d, &pvalue, &value) == 0);
+		if (strcmp(d, desc) == 0)
+			break;
+	}
+	assert(ret == 0);
+	assert(cursor->close(cursor) == 0);
+
+	return value;
+}
+
+static void make_value(char* buf, int version, int key)
+{
+	sprintf(buf, "v%d-%d-%.200s", version, key, pad);
+}
+
+/*hsÿkeyµversionٲfromʼcountkey*/
+static void update(WT_SESSION* session, int version, int from, int count)
+{
+	WT_CURSOR *cursor;
+	char value[256];
+	int i;
+
+	assert(session->open_cursor(session, HS_URI, NULL, NULL, &cursor) == 0);
+	for (i = 0; i < ROWS; i++) {
+		make_value(value, version, i);
+		cursor->set_key(cursor, i);
+		cursor->set_value(cursor, value);
+		assert(cursor->update(cursor) == 0);
+	}
+	for (i = from; i < from + count; i++) {
+		make_value(value, version, i);
+		cursor->set_key(cursor, i);
+		cursor->set_value(cursor, value);
+		assert(cursor->insert(cursor) == 0);
+	}
+	assert(cursor->close(cursor) == 0);
+}
+
+/*дcacheöݣʹhs޸Ĺpagḙ*/
+static void pressure(WT_SESSION* session, int round)
+{
+	WT_CURSOR *cursor;
+	int i;
+
+	assert(session->open_cursor(session, FILLER_URI, NULL, NULL, &cursor) == 0);
+	for (i = 0; i < FILLER_ROWS; i++) {
+		cursor->set_key(cursor, round * FILLER_ROWS + i);
+		cursor->set_value(cursor, pad);
+		assert(cursor->insert(cursor) == 0);
+	}
+	assert(cursor->close(cursor) == 0);
+}
+
+/*sessionversion汾ROWSkey²keyɼ*/
+static void check(WT_SESSION* session, int version, int rows)
+{
+	WT_CURSOR *cursor;
+	const char *value;
+	char expect[256];
+	int i, key, ret;
+
+	assert(session->open_cursor(session, HS_URI, NULL, NULL, &cursor) == 0);
+
+	/*ѯ*/
+	for (i = 0; i < rows; i++) {
+		cursor->set_key(cursor, i);
+		assert(cursor->search(cursor) == 0);
+		assert(cursor->get_value(cursor, &value) == 0);
+		make_value(expect, version, i);
+		if (strcmp(value, expect) != 0) {
+			printf("key %d: read \"%.20s\", expected \"%.20s\"\n", i, value, expect);
+			abort();
+		}
+	}
+	cursor->set_key(cursor, rows);
+	assert(cursor->search(cursor) == WT_NOTFOUND);
+	assert(cursor->reset(cursor) == 0);
+
+	/**/
+	for (i = 0; (ret = cursor->next(cursor)) == 0; i++) {
+		assert(cursor->get_key(cursor, &key) == 0);
+		assert(cursor->get_value(cursor, &value) == 0);
+		make_value(expect, version, key);
+		assert(key == i && strcmp(value, expect) == 0);
+	}
+	assert(ret == WT_NOTFOUND);
+	assert(i == rows);
+
+	assert(cursor->close(cursor) == 0);
+}
+
+int main()
+{
+	WT_CONNECTION *conn;
+	WT_CURSOR *cursor;
+	WT_SESSION *reader, *session;
+	char value[256];
+	int64_t inserted, removed;
+	int i, ret, wait;
+
+	memset(pad, 'x', sizeof(pad) - 1);
+
+	ret = system("rm -rf WT_HOME && mkdir WT_HOME");
+	assert(wiredtiger_open("WT_HOME", NULL, WT_CONFIG, &conn) == 0);
+	assert(conn->open_session(conn, NULL, NULL, &session) == 0);
+	assert(conn->open_session(conn, NULL, NULL, &reader) == 0);
+
+	assert(session->create(session, HS_URI, "key_format=i,value_format=S") == 0);
+	assert(session->create(session, FILLER_URI, "key_format=i,value_format=S") == 0);
+	assert(session->open_cursor(session, HS_URI, NULL, NULL, &cursor) == 0);
+	for (i = 0; i < ROWS; i++) {
+		make_value(value, 0, i);
+		cursor->set_key(cursor, i);
+		cursor->set_value(cursor, value);
+		assert(cursor->insert(cursor) == 0);
+	}
+	assert(cursor->close(cursor) == 0);
+	assert(session->checkpoint(session, NULL) == 0);
+
+	/*snapshotֻа汾0*/
+	assert(reader->begin_transaction(reader, "isolation=snapshot") == 0);
+	check(reader, 0, ROWS);
+
+	/*һ: еkeykey̭ɰ汾дhistory store*/
+	update(session, 1, ROWS, ROWS / 2);
+	pressure(session, 0);
+	inserted = stat_get(session, "cache: history store records written");
+	printf("round 1: %lld history store records written\n", (long long)inserted);
+	assert(inserted > 0);
+	check(reader, 0, ROWS);
+	check(session, 1, ROWS + ROWS / 2);
+
+	/*ڶ: ѾWT_PAGE_HSǵpageٴα޸ḽ́*/
+	update(session, 2, ROWS + ROWS / 2, ROWS / 2);
+	pressure(session, 1);
+	printf("round 2: %lld history store records written\n",
+		(long long)stat_get(session, "cache: history store records written"));
+	assert(stat_get(session, "cache: history store records written") > inserted);
+	check(reader, 0, ROWS);
+	check(session, 2, ROWS * 2);
+	assert(stat_get(session, "cache: history store searches") > 0);
+
+	/*ύûٶhistory storeеļ¼sweep*/
+	assert(reader->commit_transaction(reader, NULL) == 0);
+	assert(session->checkpoint(session, NULL) == 0);
+	for (wait = 0; wait < 60; wait++) {
+		if ((removed = stat_get(session, "cache: history store records removed")) > 0)
+			break;
+		sleep(1);
+	}
+	printf("sweep: %lld history store records removed\n", (long long)removed);
+	assert(removed > 0);
+	check(reader, 2, ROWS * 2);
+
+	assert(conn->close(conn, NULL) == 0);
+	return ret == 0 ? 0 : 1;
+}
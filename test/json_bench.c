@@ -0,0 +1,165 @@
+#include "wiredtiger.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+/*JSON dump/load²: json_bench <¼()>loadԴȽ*/
+
+#define WT_CONFIG	"create,cache_size=1GB"
+#define TAB_META	"key_format=S,value_format=SiS,columns=(id,name,age,note)"
+#define DUMP_FILE	"json_bench.dump"
+
+static uint32_t elapsed_ms(struct timeval* b)
+{
+	struct timeval e;
+
+	gettimeofday(&e, NULL);
+	return (uint32_t)((e.tv_sec - b->tv_sec) * 1000 + (e.tv_usec - b->tv_usec) / 1000 + 1);
+}
+
+static int populate(WT_SESSION* session, uint32_t count)
+{
+	WT_CURSOR *cursor;
+	char key[32], name[64];
+	uint32_t i;
+	int ret;
+
+	if ((ret = session->create(session, "table:src", TAB_META)) != 0)
+		return ret;
+	if ((ret = session->open_cursor(session, "table:src", NULL, "bulk", &cursor)) != 0)
+		return ret;
+
+	for (i = 0; i < count; i++) {
+		sprintf(key, "%010u", i);
+		/*Ҫתַ: štabбܡַͻ*/
+		sprintf(name, "name \"%u\"\twith\\escapes\x01\r\n", i);
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, name, (int32_t)(i % 100), "a plain note that needs no escaping at all, only copying");
+		if ((ret = cursor->insert(cursor)) != 0)
+			break;
+	}
+
+	cursor->close(cursor);
+	return ret;
+}
+
+/*ȽԴloadıkeyежͬ*/
+static int verify(WT_SESSION* session, const char* uri, uint32_t count)
+{
+	WT_CURSOR *src, *dst;
+	const char *skey, *dkey, *sname, *dname, *snote, *dnote;
+	int32_t sage, dage;
+	uint32_t n;
+	int ret, sret, dret;
+
+	src = dst = NULL;
+	if ((ret = session->open_cursor(session, "table:src", NULL, NULL, &src)) != 0 ||
+		(ret = session->open_cursor(session, uri, NULL, NULL, &dst)) != 0)
+		goto err;
+
+	for (n = 0;; n++) {
+		sret = src->next(src);
+		dret = dst->next(dst);
+		if (sret == WT_NOTFOUND && dret == WT_NOTFOUND)
+			break;
+		if (sret != 0 || dret != 0) {
+			printf("verify %s: record %u, next returned %d/%d\n", uri, n, sret, dret);
+			ret = sret != 0 && sret != WT_NOTFOUND ? sret : (dret != 0 && dret != WT_NOTFOUND ? dret : EINVAL);
+			goto err;
+		}
+
+		if ((ret = src->get_key(src, &skey)) != 0 || (ret = dst->get_key(dst, &dkey)) != 0 ||
+			(ret = src->get_value(src, &sname, &sage, &snote)) != 0 || (ret = dst->get_value(dst, &dname, &dage, &dnote)) != 0)
+			goto err;
+		if (strcmp(skey, dkey) != 0 || strcmp(sname, dname) != 0 || sage != dage || strcmp(snote, dnote) != 0) {
+			printf("verify %s: record %u differs, key %s/%s, name \"%s\"/\"%s\"\n", uri, n, skey, dkey, sname, dname);
+			ret = EINVAL;
+			goto err;
+		}
+	}
+
+	if (n != count) {
+		printf("verify %s: %u records, expected %u\n", uri, n, count);
+		ret = EINVAL;
+	}
+
+err:
+	if (src != NULL)
+		src->close(src);
+	if (dst != NULL)
+		dst->close(dst);
+	return ret;
+}
+
+int main(int argc, const char* argv[])
+{
+	WT_CONNECTION *conn;
+	WT_SESSION *session;
+	struct stat sb;
+	struct timeval b;
+	uint32_t count, ms;
+	int ret;
+
+	if (argc != 2)
+		return 1;
+
+	count = (uint32_t)atoi(argv[1]) * 10000;
+
+	ret = system("rm -rf WT_HOME && mkdir WT_HOME");
+	if ((ret = wiredtiger_open("WT_HOME", NULL, WT_CONFIG, &conn)) != 0) {
+		printf("wiredtiger_open failed!\n");
+		return 1;
+	}
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		goto close_conn;
+
+	if ((ret = populate(session, count)) != 0) {
+		printf("populate failed, code = %d\n", ret);
+		goto close_conn;
+	}
+
+	gettimeofday(&b, NULL);
+	if ((ret = session->dump(session, "table:src", DUMP_FILE, NULL)) != 0) {
+		printf("dump failed, code = %d\n", ret);
+		goto close_conn;
+	}
+	ms = elapsed_ms(&b);
+	stat("WT_HOME/" DUMP_FILE, &sb);
+	printf("dump: %u records, %lld bytes, %u ms, %u records/s, %llu MB/s\n",
+		count, (long long)sb.st_size, ms, (uint32_t)((uint64_t)count * 1000 / ms), (unsigned long long)sb.st_size / 1024 * 1000 / 1024 / ms);
+
+	/*ĿΪգloadbulk cursor*/
+	gettimeofday(&b, NULL);
+	if ((ret = session->load(session, "table:dst", DUMP_FILE, NULL)) != 0) {
+		printf("bulk load failed, code = %d\n", ret);
+		goto close_conn;
+	}
+	ms = elapsed_ms(&b);
+	printf("bulk load: %u ms, %u records/s, %llu MB/s\n",
+		ms, (uint32_t)((uint64_t)count * 1000 / ms), (unsigned long long)sb.st_size / 1024 * 1000 / 1024 / ms);
+	if ((ret = verify(session, "table:dst", count)) != 0)
+		goto close_conn;
+
+	/*ĿΪգload˻صͨinsert*/
+	gettimeofday(&b, NULL);
+	if ((ret = session->load(session, "table:dst", DUMP_FILE, NULL)) != 0) {
+		printf("load failed, code = %d\n", ret);
+		goto close_conn;
+	}
+	ms = elapsed_ms(&b);
+	printf("load: %u ms, %u records/s, %llu MB/s\n",
+		ms, (uint32_t)((uint64_t)count * 1000 / ms), (unsigned long long)sb.st_size / 1024 * 1000 / 1024 / ms);
+	/*loadͬļ¼¼*/
+	if ((ret = verify(session, "table:dst", count)) != 0)
+		goto close_conn;
+	printf("verify: %u records match\n", count);
+
+close_conn:
+	if (conn->close(conn, NULL) != 0)
+		printf("wiredtiger_close failed!\n");
+
+	return ret == 0 ? 0 : 1;
+}
@@ -119,6 +119,57 @@ void test_pack_struct()
 	printf("i1 = %d, i2 = %d, i3 = %s\n", i1, i2, s);
 }
 
+/*unpackԣunpackȽ*/
+#define BATCH_RECORDS	100
+
+void test_pack_batch()
+{
+	WT_ITEM records[BATCH_RECORDS];
+	char bufs[BATCH_RECORDS][64], name[32], *s;
+	const char *names[BATCH_RECORDS];
+	int64_t ids[BATCH_RECORDS];
+	uint64_t ages[BATCH_RECORDS];
+	void *columns[4];
+	size_t len;
+	int32_t i1;
+	uint32_t i, u1;
+
+	for (i = 0; i < BATCH_RECORDS; i++) {
+		sprintf(name, "name%u", i * 7);
+		/*ͶֽڵpackedҪǵ*/
+		assert(wiredtiger_struct_size((WT_SESSION *)session, &len, "iSIx", (int32_t)i * 1000 - 50000, name, i * 3) == 0);
+		assert(len <= sizeof(bufs[i]));
+		assert(wiredtiger_struct_pack((WT_SESSION *)session, bufs[i], len, "iSIx", (int32_t)i * 1000 - 50000, name, i * 3) == 0);
+		records[i].data = bufs[i];
+		records[i].size = len;
+	}
+
+	columns[0] = ids;
+	columns[1] = names;
+	columns[2] = ages;
+	columns[3] = NULL;
+	assert(wiredtiger_struct_unpack_batch((WT_SESSION *)session, "iSIx", records, BATCH_RECORDS, columns) == 0);
+
+	for (i = 0; i < BATCH_RECORDS; i++) {
+		assert(wiredtiger_struct_unpack((WT_SESSION *)session, records[i].data, records[i].size, "iSIx", &i1, &s, &u1) == 0);
+		assert(ids[i] == i1);
+		assert(strcmp(names[i], s) == 0);
+		assert(ages[i] == u1);
+	}
+
+	/*fieldд*/
+	columns[0] = NULL;
+	names[0] = NULL;
+	assert(wiredtiger_struct_unpack_batch((WT_SESSION *)session, "iSIx", records, 1, columns) == 0);
+	assert(names[0] != NULL && strcmp(names[0], "name0") == 0);
+
+	/*¼ȶʽʱ*/
+	records[0].size = 2;
+	assert(wiredtiger_struct_unpack_batch((WT_SESSION *)session, "RR", records, 1, columns) == EINVAL);
+
+	printf("batch unpack: %u records ok\n", BATCH_RECORDS);
+}
+
 const uint8_t data[16] ={
 	0x01, 0x02, 0x03, 0x04,
 	0x01, 0x02, 0x03, 0x04,
@@ -179,6 +230,7 @@ int main()
 	//test_pack();
 	//test_pack_unpack();
 	//test_pack_struct();
+	test_pack_batch();
 	test_pack_log();
 
 	close_wt_session();
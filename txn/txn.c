@@ -283,6 +283,10 @@ int __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	if(!F_ISSET(txn, TXN_RUNNING))
 		WT_RET_MSG(session, EINVAL, "No transaction is active");
 
+	/*table cursorkeyҲ־ύǰд*/
+	if (session->idx_batch_cursors != 0)
+		ret = __wt_curtable_idx_batch_txn(session, 1);
+
 	/*֪ͨϲDBMSύ״̬*/
 	if(txn->notify != NULL)
 		WT_TRET(txn->notify->notify(txn->notify, (WT_SESSION *)session, txn->id, 1));
@@ -333,6 +337,9 @@ int __wt_txn_rollback(WT_SESSION_IMPL* session, const char* cfg[])
 	if (!F_ISSET(txn, TXN_RUNNING))
 		WT_RET_MSG(session, EINVAL, "No transaction is active");
 
+	if (session->idx_batch_cursors != 0)
+		WT_TRET(__wt_curtable_idx_batch_txn(session, 0));
+
 	/* Rollback notification. */
 	if (txn->notify != NULL)
 		WT_TRET(txn->notify->notify(txn->notify, (WT_SESSION *)session, txn->id, 0));
@@ -241,14 +241,14 @@ int  __wt_txn_checkpoint(WT_SESSION_IMPL* session, const char* cfg[])
 	{ WT_CONFIG_BASE(session, session_begin_transaction),
 	"isolation=snapshot", NULL };
 	void *saved_meta_next;
-	int full, logging, tracking;
+	int full, hs_locked, logging, tracking;
 	u_int i;
 
 	conn = S2C(session);
 	txn_global = &conn->txn_global;
 	saved_isolation = session->isolation;
 	txn = &session->txn;
-	full = logging = tracking = 0;
+	full = hs_locked = logging = tracking = 0;
 
 	/* Ensure the metadata table is open before taking any locks. */
 	WT_RET(__wt_metadata_open(session));
@@ -315,6 +315,17 @@ int  __wt_txn_checkpoint(WT_SESSION_IMPL* session, const char* cfg[])
 	 */
 	if (full)
 		WT_ERR(__wt_epoch(session, &start));
+
+	/*
+	 * Wait for evictions writing versions to the history store: a page
+	 * written with versions newer than the checkpoint's snapshot must not
+	 * be part of the checkpoint.  Evictions starting after the checkpoint
+	 * ID is published don't use the history store.
+	 */
+	if (conn->hs_ckpt_lock != NULL) {
+		WT_ERR(__wt_writelock(session, conn->hs_ckpt_lock));
+		hs_locked = 1;
+	}
 	WT_ERR(__wt_txn_begin(session, txn_cfg));
 
 	/* Ensure a transaction ID is allocated prior to sharing it globally */
@@ -326,6 +337,11 @@ int  __wt_txn_checkpoint(WT_SESSION_IMPL* session, const char* cfg[])
 	txn_global->checkpoint_gen += 1;
 	WT_STAT_FAST_CONN_SET(session, txn_checkpoint_generation, txn_global->checkpoint_gen);
 
+	if (hs_locked) {
+		hs_locked = 0;
+		WT_ERR(__wt_writeunlock(session, conn->hs_ckpt_lock));
+	}
+
 	/* Tell logging that we have started a database checkpoint. */
 	if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED) && full) {
 		WT_ERR(__wt_txn_checkpoint_log(session, full, WT_TXN_LOG_CKPT_START, NULL)); /*ʼcheckpoint*/
@@ -383,6 +399,8 @@ err:	/*
 	 * consistent.
 	 */
 	session->isolation = txn->isolation = TXN_ISO_READ_UNCOMMITTED;
+	if (hs_locked)
+		WT_TRET(__wt_writeunlock(session, conn->hs_ckpt_lock));
 	if (tracking)
 		WT_TRET(__wt_meta_track_off(session, 0, ret != 0));
 